@@ -55,6 +55,11 @@ __ProtoExt__ int  EG_copyObject( const ego object, /*@null@*/ const ego oform,
                                  ego *copy );
 __ProtoExt__ int  EG_flipObject( const ego object, ego *flippedCopy );
 __ProtoExt__ int  EG_close( ego context );
+__ProtoExt__ int  EG_getSlabInfo( const ego context, int index, int *size,
+                                  int *nblock, int *inUse, int *hiWater );
+__ProtoExt__ int  EG_getMemoryStats( const ego context, int oclass, int mtype,
+                                     int *count, int *hiCount, size_t *bytes,
+                                     size_t *hiBytes );
 
 /* attribute functions */
 
@@ -73,6 +78,13 @@ __ProtoExt__ int  EG_attributeRet( const ego obj, const char *name, int *atype,
                                    int *len, /*@null@*/ const int    **ints,
                                              /*@null@*/ const double **reals, 
                                              /*@null@*/ const char   **str );
+__ProtoExt__ int  EG_attributeAtom( const ego obj, const char *name, 
+                                    int *atom );
+__ProtoExt__ int  EG_attributeRetAtom( const ego obj, int atom, int *atype,
+                                       int *len, 
+                                       /*@null@*/ const int    **ints,
+                                       /*@null@*/ const double **reals, 
+                                       /*@null@*/ const char   **str );
 __ProtoExt__ int  EG_attributeDup( const ego src, ego dst );
 
 /* geometry functions */
@@ -88,6 +100,10 @@ __ProtoExt__ int  EG_evaluate( const ego geom, const double *param,
                                double *results );
 __ProtoExt__ int  EG_invEvaluate( const ego geom, double *xyz, double *param,
                                   double *results );
+__ProtoExt__ int  EG_evaluateMany( const ego geom, int npts, int deriv,
+                                   const double *params, double *results );
+__ProtoExt__ int  EG_invEvaluateMany( const ego geom, int npts, double *xyzs,
+                                      double *params, double *results );
 __ProtoExt__ int  EG_approximate( ego context, int maxdeg, double tol,
                                   const int *sizes, const double *xyzs,
                                   ego *bspline );
@@ -132,6 +148,8 @@ __ProtoExt__ int  EG_makeTessGeom( ego obj, double *params, int *sizes,
                                    ego *tess );
 __ProtoExt__ int  EG_getTessGeom( const ego tess, int *sizes, double **xyz );
 
+__ProtoExt__ int  EG_setTessParam( ego context, int iparam, double value,
+                                   /*@null@*/ double *oldvalue );
 __ProtoExt__ int  EG_makeTessBody( ego object, double *params, ego *tess );
 __ProtoExt__ int  EG_remakeTess( ego tess, int nobj, ego *objs, 
                                  double *params );
@@ -142,9 +160,24 @@ __ProtoExt__ int  EG_getTessFace( const ego tess, int fIndex, int *len,
                                   const int **ptype, const int **pindex, 
                                   int *ntri, const int **tris, 
                                   const int **tric );
+__ProtoExt__ int  EG_getTessBodyGlobal( const ego tess, int *nvert,
+                                        const double **xyz, const int **ptype,
+                                        const int **pindex, int *ntri,
+                                        const int **tris );
+__ProtoExt__ int  EG_getTessFaceGlobal( const ego tess, int fIndex, int *len,
+                                        const int **gIndex, int *ntri,
+                                        const int **tris );
+__ProtoExt__ int  EG_getTessEdgeFloat( const ego tess, int eIndex, int *len,
+                                       const float **xyz, const float **t );
+__ProtoExt__ int  EG_getTessFaceFloat( const ego tess, int fIndex, int *len,
+                                       const float **xyz, const float **uv,
+                                       int *ntri, const int **tris );
+__ProtoExt__ int  EG_saveTess( const ego tess, const char *name );
+__ProtoExt__ int  EG_loadTess( ego body, const char *name, ego *tess );
 __ProtoExt__ int  EG_getTessQuads( const ego tess, int *nquad, 
                                    int **fIndices );
 __ProtoExt__ int  EG_makeQuads( ego tess, double *params, int fIndex );
+__ProtoExt__ int  EG_makeQuadsBody( ego tess, double *params, int *nquad );
 __ProtoExt__ int  EG_getQuads( const ego tess, int fIndex, int *len, 
                                   const double **xyz, const double **uv, 
                                   const int **ptype, const int **pindex, 
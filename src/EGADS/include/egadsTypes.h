@@ -11,6 +11,7 @@
  *
  */
 
+#include <stddef.h>
 #include "egadsErrors.h"
 
 
@@ -123,6 +124,8 @@ typedef struct {
 typedef struct {
   int     nattrs;               /* number of attributes */
   egAttr *attrs;                /* the attributes */
+  int     nhash;                /* size of the index (power of 2) */
+  int    *hash;                 /* index -- name atom & attrs slot pairs */
 } egAttrs;
 
 
@@ -133,7 +136,7 @@ typedef struct egObject {
   void   *attrs;                /* object Attributes or Reference*/
   void   *blind;		/* blind pointer to object data */
   struct egObject *topObj;      /* top of the hierarchy or context (if top) */
-  struct egObject *tref;        /* threaded list of references */
+  void   *tref;                 /* counted set of references */
   struct egObject *prev;        /* back pointer */
   struct egObject *next;        /* forward pointer */
 } egObject;
@@ -143,9 +146,18 @@ typedef struct egObject* ego;
 typedef struct {
   int      outLevel;		/* output level for messages
                                    0 none, 1 minimal, 2 verbose, 3 debug */
+  int      nThread;             /* threads used to tessellate (0 - all) */
+  int      maxEpts;             /* max points on an Edge (0 - default) */
   char     **signature;
   egObject *pool;               /* available object structures for use */
   egObject *last;               /* the last object in the list */
+  int      closing;             /* set while EG_close frees in bulk */
+  int      sweeping;            /* Context deletes holding back the pool */
+  void     *mutex;              /* guards the pool, list, slabs & refs */
+  int      nSlab;               /* number of slab entry sizes */
+  void     *slabs;              /* the slab allocators (egadsMemory.c) */
+  void     *atoms;              /* interned attribute names (egadsAttrs.c) */
+  void     *stats;              /* object & memory counts (egadsMemory.c) */
 } egCntxt;
 
 
@@ -189,6 +201,26 @@ typedef struct {
 } egTess2D;
 
 
+typedef struct {
+  double  *xyz;                 /* global vertex coordinates */
+  int     *ptype;               /* point type (0 Node, >0 Edge, -1 Face)
+                                   -- also the base of the int block */
+  int     *pindex;              /* Node, Edge or Face index */
+  int     *tris;                /* global triangle indices (1 bias) */
+  int     *fmap;                /* Face vertex -> global index (1 bias) */
+  int     *foff;                /* Face offsets into fmap then into tris */
+  int     nvert;                /* number of global vertices */
+  int     ntri;                 /* number of triangles */
+} egTessGlobal;
+
+
+typedef struct {
+  float   *xyz;                 /* Face then Edge coordinates -- the block */
+  float   *prm;                 /* Face uvs then Edge ts */
+  int     *off;                 /* Face then Edge vertex offsets */
+} egTessFloat;
+
+
 typedef struct {
   egObject *src;                /* source of the tessellation */
   double   *xyzs;               /* storage for geom */
@@ -199,6 +231,11 @@ typedef struct {
   int      nFace;               /* number of Face tessellations */
   int      nu;                  /* number of us for surface / ts for curve */
   int      nv;                  /* number of vs for surface tessellation */
+  size_t   nbytes;              /* bytes counted in the Context stats */
+  egTessGlobal *global;         /* global numbering (NULL until asked for) */
+  egTessFloat  *single;         /* single precision copy (ditto) */
+  void     *mapped;             /* loaded file the Edge & Face blocks view */
+  size_t   msize;               /* its length (0 when the blocks are owned) */
 } egTessel;
 
 #endif
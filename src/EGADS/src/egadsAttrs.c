@@ -17,6 +17,326 @@
 #include "egadsInternals.h"
 
 
+#define ATOMSIZE  64            /* initial size of the atom table hash */
+#define ATTRSIZE   8            /* smallest attribute index */
+
+/* lookups read the atom table without the Context mutex -- the table
+ * pointer and new hash entries are published with release stores */
+
+#ifdef __GNUC__
+#define ATOMLOAD(p)     __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define ATOMSTORE(p, v) __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#else
+/* MSVC -- volatile accesses are acquire/release (/volatile:ms) */
+#define ATOMLOAD(p)     (*(p))
+#define ATOMSTORE(p, v) (*(p) = (v))
+#endif
+
+/* the names used for attributes are interned per Context -- an atom is the
+ * 1-bias index into names and never changes for the life of the Context */
+
+typedef struct egAtomTab {
+  struct egAtomTab *prev;       /* retired table (freed with the Context) */
+  int              size;        /* size of hash (power of 2) */
+  char             **names;     /* the names (size/2 long) */
+  volatile int     *hash;       /* open addressed atoms (0 - empty) */
+} egAtomTab;
+
+typedef struct {
+  int                natom;     /* number of interned names */
+  egAtomTab *volatile tab;      /* current table -- never changed in place
+                                   other than filling empty hash entries */
+} egAtoms;
+
+
+static unsigned int
+EG_nameHash(const char *name)
+{
+  unsigned int key = 2166136261U;
+
+  while (*name != 0) {
+    key ^= (unsigned char) *name;
+    key *= 16777619U;
+    name++;
+  }
+  return key;
+}
+
+
+static int
+EG_atomFind(const egAtomTab *tab, const char *name, unsigned int key)
+{
+  int i, atom;
+
+  i = key & (tab->size-1);
+  while ((atom = ATOMLOAD(&tab->hash[i])) != 0) {
+    if (strcmp(tab->names[atom-1], name) == 0) return atom;
+    i = (i+1) & (tab->size-1);
+  }
+  return 0;
+}
+
+
+/* makes a larger table -- the old one is retired (not freed) because a
+ * lookup may still be reading it */
+
+static int
+EG_atomGrow(egAtoms *atoms)
+{
+  int          i, j, size, *hash;
+  char         **names;
+  egAtomTab    *tab, *old;
+
+  old   = atoms->tab;
+  size  = ATOMSIZE;
+  if (old != NULL) size = 2*old->size;
+  tab   = (egAtomTab *) EG_alloc(sizeof(egAtomTab));
+  hash  = (int *)       EG_alloc(size*sizeof(int));
+  names = (char **)     EG_alloc((size/2)*sizeof(char *));
+  if ((tab == NULL) || (hash == NULL) || (names == NULL)) {
+    EG_free(names);
+    EG_free(hash);
+    EG_free(tab);
+    return EGADS_MALLOC;
+  }
+  for (i = 0; i < size;   i++) hash[i]  = 0;
+  for (i = 0; i < size/2; i++) names[i] = NULL;
+  for (i = 0; i < atoms->natom; i++) {
+    names[i] = old->names[i];
+    j = EG_nameHash(names[i]) & (size-1);
+    while (hash[j] != 0) j = (j+1) & (size-1);
+    hash[j] = i+1;
+  }
+  tab->prev  = old;
+  tab->size  = size;
+  tab->names = names;
+  tab->hash  = hash;
+  ATOMSTORE(&atoms->tab, tab);
+  return EGADS_SUCCESS;
+}
+
+
+/* returns the atom for name in the Context of obj -- 0 if not interned */
+
+static int
+EG_atomLookup(const egObject *obj, const char *name)
+{
+  egObject  *context;
+  egCntxt   *cntx;
+  egAtoms   *atoms;
+  egAtomTab *tab;
+
+  context = EG_context(obj);
+  if (context == NULL) return 0;
+  cntx = (egCntxt *) context->blind;
+  if (cntx == NULL) return 0;
+
+  /* no mutex -- tables and names are only ever added to */
+  atoms = (egAtoms *) ATOMLOAD((void *volatile *) &cntx->atoms);
+  if (atoms == NULL) return 0;
+  tab   = ATOMLOAD(&atoms->tab);
+  if (tab   == NULL) return 0;
+  return EG_atomFind(tab, name, EG_nameHash(name));
+}
+
+
+/* interns name in the Context of obj -- 0 on an allocation failure */
+
+static int
+EG_atomIntern(const egObject *obj, const char *name)
+{
+  int          atom = 0;
+  unsigned int key;
+  egObject     *context;
+  egCntxt      *cntx;
+  egAtoms      *atoms;
+  egAtomTab    *tab;
+
+  context = EG_context(obj);
+  if (context == NULL) return 0;
+  cntx = (egCntxt *) context->blind;
+  if (cntx == NULL) return 0;
+  key  = EG_nameHash(name);
+
+  EG_mutexLock(cntx->mutex);
+  atoms = (egAtoms *) cntx->atoms;
+  if (atoms == NULL) {
+    atoms = (egAtoms *) EG_alloc(sizeof(egAtoms));
+    if (atoms == NULL) goto done;
+    atoms->natom = 0;
+    atoms->tab   = NULL;
+    ATOMSTORE((void *volatile *) &cntx->atoms, (void *) atoms);
+  }
+  if (atoms->tab != NULL) {
+    atom = EG_atomFind(atoms->tab, name, key);
+    if (atom != 0) goto done;
+  }
+  if ((atoms->tab == NULL) || (2*(atoms->natom+1) > atoms->tab->size))
+    if (EG_atomGrow(atoms) != EGADS_SUCCESS) goto done;
+  tab = atoms->tab;
+  tab->names[atoms->natom] = EG_strdup(name);
+  if (tab->names[atoms->natom] == NULL) goto done;
+  atoms->natom++;
+  atom = atoms->natom;
+  key &= tab->size-1;
+  while (tab->hash[key] != 0) key = (key+1) & (tab->size-1);
+  /* the name is set before the entry is visible to a lookup */
+  ATOMSTORE(&tab->hash[key], atom);
+
+done:
+  EG_mutexUnlock(cntx->mutex);
+  return atom;
+}
+
+
+void
+EG_attrAtomFree(egCntxt *cntx)
+{
+  int       i;
+  egAtoms   *atoms;
+  egAtomTab *tab, *prev;
+
+  atoms = (egAtoms *) cntx->atoms;
+  if (atoms == NULL) return;
+  tab   = atoms->tab;
+  if (tab != NULL)
+    for (i = 0; i < atoms->natom; i++) EG_free(tab->names[i]);
+  while (tab != NULL) {
+    prev = tab->prev;
+    EG_free(tab->names);
+    EG_free((void *) tab->hash);
+    EG_free(tab);
+    tab  = prev;
+  }
+  EG_free(atoms);
+  cntx->atoms = NULL;
+}
+
+
+/* the attribute index holds (atom, slot) pairs keyed on the atom */
+
+static int
+EG_attrSlot(const egAttrs *attrs, int atom)
+{
+  int i;
+
+  i = (int) (((unsigned int) atom*2654435761U) & (attrs->nhash-1));
+  while (attrs->hash[2*i] != 0) {
+    if (attrs->hash[2*i] == atom) return attrs->hash[2*i+1];
+    i = (i+1) & (attrs->nhash-1);
+  }
+  return -1;
+}
+
+
+static void
+EG_attrInsert(egAttrs *attrs, int atom, int slot)
+{
+  int i;
+
+  i = (int) (((unsigned int) atom*2654435761U) & (attrs->nhash-1));
+  while (attrs->hash[2*i] != 0) i = (i+1) & (attrs->nhash-1);
+  attrs->hash[2*i  ] = atom;
+  attrs->hash[2*i+1] = slot;
+}
+
+
+/* (re)builds the index from the atoms of the slots -- drops the index
+ * (and lookups fall back to the names) if anything cannot be allocated */
+
+static void
+EG_attrRehash(egAttrs *attrs, int nslot, const int *slots)
+{
+  int i, nhash;
+
+  nhash = ATTRSIZE;
+  while (nhash < 2*attrs->nattrs) nhash *= 2;
+  if (nhash != attrs->nhash) {
+    EG_free(attrs->hash);
+    attrs->nhash = 0;
+    attrs->hash  = (int *) EG_alloc(2*nhash*sizeof(int));
+    if (attrs->hash == NULL) return;
+    attrs->nhash = nhash;
+  }
+  for (i = 0; i < 2*nhash; i++) attrs->hash[i] = 0;
+  for (i = 0; i < nslot; i++)
+    if (slots[i] != 0) EG_attrInsert(attrs, slots[i], i);
+}
+
+
+void
+EG_attributeIndex(egObject *obj)
+{
+  int     i, *slots;
+  egAttrs *attrs;
+
+  attrs = (egAttrs *) obj->attrs;
+  if (attrs == NULL) return;
+  EG_free(attrs->hash);
+  attrs->nhash = 0;
+  attrs->hash  = NULL;
+  if (attrs->nattrs == 0) return;
+
+  slots = (int *) EG_alloc(attrs->nattrs*sizeof(int));
+  if (slots == NULL) return;
+  for (i = 0; i < attrs->nattrs; i++) {
+    slots[i] = EG_atomIntern(obj, attrs->attrs[i].name);
+    if (slots[i] == 0) {
+      EG_free(slots);
+      return;
+    }
+  }
+  EG_attrRehash(attrs, attrs->nattrs, slots);
+  EG_free(slots);
+}
+
+
+/* finds the slot for name -- -1 if not there */
+
+static int
+EG_attrFind(const egObject *obj, const egAttrs *attrs, const char *name)
+{
+  int i, atom;
+
+  if (attrs->hash == NULL) {
+    for (i = 0; i < attrs->nattrs; i++)
+      if (strcmp(attrs->attrs[i].name, name) == 0) return i;
+    return -1;
+  }
+
+  atom = EG_atomLookup(obj, name);
+  if (atom == 0) return -1;
+  return EG_attrSlot(attrs, atom);
+}
+
+
+static void
+EG_attrValues(const egAttr *attr, int *atype, int *len,
+              /*@null@*/ const int **ints, /*@null@*/ const double **reals,
+              /*@null@*/ const char **str)
+{
+  *atype = attr->type;
+  *len   = attr->length;
+  if (*atype == ATTRINT) {
+    if (ints != NULL) 
+      if (*len <= 1) {
+        *ints = &attr->vals.integer;
+      } else {
+        *ints =  attr->vals.integers;
+      }
+  } else if (*atype == ATTRREAL) {
+    if (reals != NULL)
+      if (*len <= 1) {
+        *reals = &attr->vals.real;
+      } else {
+        *reals =  attr->vals.reals;
+      }
+  } else {
+    if (str != NULL) *str = attr->vals.string;
+  }
+}
+
+
 
 int
 EG_attributePrint(const egObject *obj)
@@ -66,7 +386,7 @@ EG_attributeAdd(egObject *obj, const char *name, int atype, int len,
                 /*@null@*/ const int  *ints, /*@null@*/ const double *reals,
                 /*@null@*/ const char *str)
 {
-  int     i, length, outLevel, find = -1;
+  int     i, length, outLevel, atom, find = -1;
   egAttr  *attr;
   egAttrs *attrs;
 
@@ -114,13 +434,7 @@ EG_attributeAdd(egObject *obj, const char *name, int atype, int len,
     return EGADS_INDEXERR;
   }
   attrs = (egAttrs *) obj->attrs;
-
-  if (attrs != NULL)
-    for (i = 0; i < attrs->nattrs; i++)
-      if (strcmp(attrs->attrs[i].name,name) == 0) {
-        find = i;
-        break;
-      }
+  if (attrs != NULL) find = EG_attrFind(obj, attrs, name);
 
   if ((find != -1) && (attrs != NULL)) {
 
@@ -148,6 +462,8 @@ EG_attributeAdd(egObject *obj, const char *name, int atype, int len,
       }
       attrs->nattrs = 0;
       attrs->attrs  = NULL;
+      attrs->nhash  = 0;
+      attrs->hash   = NULL;
       obj->attrs    = attrs;
     }
     if (attrs->attrs == NULL) {
@@ -168,6 +484,18 @@ EG_attributeAdd(egObject *obj, const char *name, int atype, int len,
     attrs->attrs[find].name        = EG_strdup(name);
     if (attrs->attrs[find].name == NULL) return EGADS_MALLOC;
     attrs->nattrs += 1;
+    if ((attrs->hash != NULL) || (attrs->nattrs == 1)) {
+      atom = EG_atomIntern(obj, name);
+      if (atom == 0) {
+        EG_free(attrs->hash);
+        attrs->nhash = 0;
+        attrs->hash  = NULL;
+      } else if (2*attrs->nattrs > attrs->nhash) {
+        EG_attributeIndex(obj);
+      } else {
+        EG_attrInsert(attrs, atom, find);
+      }
+    }
   }
 
   attrs->attrs[find].type   = atype;
@@ -211,7 +539,7 @@ EG_attributeAdd(egObject *obj, const char *name, int atype, int len,
 int
 EG_attributeDel(egObject *obj, /*@null@*/ const char *name)
 {
-  int     i, outLevel, find = -1;
+  int     i, j, outLevel, *slots, find = -1;
   egAttrs *attrs;
 
   if (obj == NULL)               return EGADS_NULLOBJ;
@@ -239,16 +567,13 @@ EG_attributeDel(egObject *obj, /*@null@*/ const char *name)
       }
     }
     EG_free(attrs->attrs);
+    EG_free(attrs->hash);
     EG_free(attrs);
 
   } else {
 
     /* delete the named attribute */
-    for (i = 0; i < attrs->nattrs; i++)
-      if (strcmp(attrs->attrs[i].name,name) == 0) {
-        find = i;
-        break;
-      }
+    find = EG_attrFind(obj, attrs, name);
 
     if (find == -1) {
       if (outLevel > 0) 
@@ -270,6 +595,27 @@ EG_attributeDel(egObject *obj, /*@null@*/ const char *name)
       attrs->attrs[i-1] = attrs->attrs[i];
     attrs->nattrs -= 1;
 
+    /* the slots shift down -- keep the order & reindex */
+    if (attrs->hash != NULL) {
+      slots = (int *) EG_alloc((attrs->nattrs+1)*sizeof(int));
+      if (slots == NULL) {
+        EG_free(attrs->hash);
+        attrs->nhash = 0;
+        attrs->hash  = NULL;
+      } else {
+        for (i = 0; i <= attrs->nattrs; i++) slots[i] = 0;
+        for (i = 0; i < attrs->nhash; i++) {
+          j = attrs->hash[2*i+1];
+          if (attrs->hash[2*i] == 0) continue;
+          if (j == find) continue;
+          if (j >  find) j--;
+          slots[j] = attrs->hash[2*i];
+        }
+        EG_attrRehash(attrs, attrs->nattrs, slots);
+        EG_free(slots);
+      }
+    }
+
   }
 
   return EGADS_SUCCESS;
@@ -359,7 +705,7 @@ EG_attributeRet(const egObject *obj, const char *name, int *atype,
                           /*@null@*/ const double **reals, 
                           /*@null@*/ const char **str)
 {
-  int     i, outLevel, index;
+  int     outLevel, index;
   egAttrs *attrs;
 
   *atype = 0;
@@ -382,33 +728,92 @@ EG_attributeRet(const egObject *obj, const char *name, int *atype,
   attrs = (egAttrs *) obj->attrs;
   if (attrs == NULL) return EGADS_NOTFOUND;
 
-  index = -1;
-  for (i = 0; i < attrs->nattrs; i++)
-    if (strcmp(attrs->attrs[i].name, name) == 0) {
-      index = i;
-      break;
-    }
+  index = EG_attrFind(obj, attrs, name);
   if (index == -1) return EGADS_NOTFOUND;
 
-  *atype = attrs->attrs[index].type;
-  *len   = attrs->attrs[index].length;
-  if (*atype == ATTRINT) {
-    if (ints != NULL) 
-      if (*len <= 1) {
-        *ints = &attrs->attrs[index].vals.integer;
-      } else {
-        *ints =  attrs->attrs[index].vals.integers;
-      }
-  } else if (*atype == ATTRREAL) {
-    if (reals != NULL)
-      if (*len <= 1) {
-        *reals = &attrs->attrs[index].vals.real;
-      } else {
-        *reals =  attrs->attrs[index].vals.reals;
-      }
+  EG_attrValues(&attrs->attrs[index], atype, len, ints, reals, str);
+  return EGADS_SUCCESS;
+}
+
+
+int
+EG_attributeAtom(const egObject *obj, const char *name, int *atom)
+{
+  int outLevel;
+
+  *atom = 0;
+  if (obj == NULL)               return EGADS_NULLOBJ;
+  if (obj->magicnumber != MAGIC) return EGADS_NOTOBJ;
+  if (obj->oclass == EMPTY)      return EGADS_EMPTY;
+  if (obj->oclass == NIL)        return EGADS_EMPTY;
+  if (obj->oclass == REFERENCE)  return EGADS_REFERCE;
+  outLevel = EG_outLevel(obj);
+
+  if (name == NULL) {
+    if (outLevel > 0) 
+      printf(" EGADS Error: NULL Name (EG_attributeAtom)!\n");
+    return EGADS_NONAME;
+  }
+  *atom = EG_atomIntern(obj, name);
+  if (*atom == 0) {
+    if (outLevel > 0) 
+      printf(" EGADS Error: MALLOC for %s (EG_attributeAtom)!\n", name);
+    return EGADS_MALLOC;
+  }
+  return EGADS_SUCCESS;
+}
+
+
+int
+EG_attributeRetAtom(const egObject *obj, int atom, int *atype, int *len,
+                    /*@null@*/ const int **ints, 
+                    /*@null@*/ const double **reals, 
+                    /*@null@*/ const char **str)
+{
+  int      i, index;
+  egObject *context;
+  egCntxt  *cntx;
+  egAtoms  *atoms;
+  egAttrs  *attrs;
+
+  *atype = 0;
+  *len   = 0;
+  if (ints  != NULL) *ints  = NULL;
+  if (reals != NULL) *reals = NULL;
+  if (str   != NULL) *str   = NULL;
+  if (obj == NULL)               return EGADS_NULLOBJ;
+  if (obj->magicnumber != MAGIC) return EGADS_NOTOBJ;
+  if (obj->oclass == EMPTY)      return EGADS_EMPTY;
+  if (obj->oclass == NIL)        return EGADS_EMPTY;
+  if (obj->oclass == REFERENCE)  return EGADS_REFERCE;
+  if (atom <= 0)                 return EGADS_NOTFOUND;
+
+  attrs = (egAttrs *) obj->attrs;
+  if (attrs == NULL) return EGADS_NOTFOUND;
+
+  if (attrs->hash != NULL) {
+    index = EG_attrSlot(attrs, atom);
   } else {
-    if (str != NULL) *str = attrs->attrs[index].vals.string;
+
+    /* no index -- match on the interned name */
+    index   = -1;
+    context = EG_context(obj);
+    if (context == NULL) return EGADS_NOTFOUND;
+    cntx    = (egCntxt *) context->blind;
+    if (cntx == NULL) return EGADS_NOTFOUND;
+    EG_mutexLock(cntx->mutex);
+    atoms   = (egAtoms *) cntx->atoms;
+    if ((atoms != NULL) && (atom <= atoms->natom))
+      for (i = 0; i < attrs->nattrs; i++)
+        if (strcmp(attrs->attrs[i].name, atoms->tab->names[atom-1]) == 0) {
+          index = i;
+          break;
+        }
+    EG_mutexUnlock(cntx->mutex);
   }
+  if (index == -1) return EGADS_NOTFOUND;
+
+  EG_attrValues(&attrs->attrs[index], atype, len, ints, reals, str);
   return EGADS_SUCCESS;
 }
 
@@ -460,6 +865,8 @@ EG_attributeDup(const egObject *src, egObject *dst)
   }
   dattrs->nattrs = 0;
   dattrs->attrs  = NULL;
+  dattrs->nhash  = 0;
+  dattrs->hash   = NULL;
   dst->attrs     = dattrs;
   attr           = (egAttr *) EG_alloc(n*sizeof(egAttr));
   if (attr == NULL) {
@@ -501,6 +908,16 @@ EG_attributeDup(const egObject *src, egObject *dst)
   }
   dattrs->nattrs = n;
   dattrs->attrs  = attr;
+
+  /* same Context -- the atoms (and so the index) carry over */
+  if (sattrs->hash != NULL) {
+    dattrs->hash = (int *) EG_alloc(2*sattrs->nhash*sizeof(int));
+    if (dattrs->hash != NULL) {
+      dattrs->nhash = sattrs->nhash;
+      for (i = 0; i < 2*sattrs->nhash; i++)
+        dattrs->hash[i] = sattrs->hash[i];
+    }
+  }
   
   return EGADS_SUCCESS;
 }
@@ -140,10 +140,14 @@ EG_makeObject(/*@null@*/ egObject *context, egObject **obj)
   outLevel = cntx->outLevel;
 
   /* any objects in the pool? */
+  EG_mutexLock(cntx->mutex);
   object = cntx->pool;
+  /* pooled objects are held back while a Context delete sweeps */
+  if (cntx->sweeping != 0) object = NULL;
   if (object == NULL) {
-    object = (egObject *) EG_alloc(sizeof(egObject));
+    object = (egObject *) EG_slabAlloc(context, sizeof(egObject));
     if (object == NULL) {
+      EG_mutexUnlock(cntx->mutex);
       if (outLevel > 0) 
         printf(" EGADS Error: Malloc on Object (EG_makeObject)!\n");
       return EGADS_MALLOC;
@@ -151,7 +155,9 @@ EG_makeObject(/*@null@*/ egObject *context, egObject **obj)
   } else {
     cntx->pool   = object->next;
     object->prev = NULL;
+    EG_statsObject(cntx, EMPTY, 0, -1);
   }
+  EG_statsObject(cntx, CONTXT, 0, 1);
   
   prev                = cntx->last;
   object->magicnumber = MAGIC;
@@ -167,6 +173,7 @@ EG_makeObject(/*@null@*/ egObject *context, egObject **obj)
 
   *obj = object;
   cntx->last = *obj;
+  EG_mutexUnlock(cntx->mutex);
   return EGADS_SUCCESS;
 }
 
@@ -185,9 +192,22 @@ EG_open(egObject **context)
     return EGADS_MALLOC;
   }
   cntx->outLevel  = 1;
+  cntx->nThread   = 1;
+  cntx->maxEpts   = 0;
   cntx->signature = EGADSprop;
   cntx->pool      = NULL;
   cntx->last      = object;
+  cntx->closing   = 0;
+  cntx->sweeping  = 0;
+  cntx->mutex     = EG_mutexCreate();
+  cntx->atoms     = NULL;
+  if (cntx->mutex == NULL) {
+    EG_free(object);
+    EG_free(cntx);
+    return EGADS_MALLOC;
+  }
+  EG_slabInit(cntx);
+  EG_statsInit(cntx);
   
   object->magicnumber = MAGIC;
   object->oclass      = CONTXT;
@@ -204,11 +224,236 @@ EG_open(egObject **context)
 }
 
 
+/* counted reference sets -- each referrer is held once with a count. The
+ *   first few are kept in the set, more go to an open addressed hash */
+
+#define NREFINL  4              /* referrers held without the hash */
+
+typedef struct {
+  const egObject *ref;          /* the referencing object */
+  int            cnt;           /* number of references it holds */
+} egRefEnt;
+
+typedef struct {
+  int      nref;                /* total number of references */
+  int      nent;                /* number of referrers */
+  int      size;                /* hash length (0 - only inl is used) */
+  short    oclass;              /* class & type counted in the stats */
+  short    mtype;
+  egRefEnt inl[NREFINL];
+  egRefEnt *hash;
+} egRefs;
+
+
+static int
+EG_refHash(const egObject *ref, int size)
+{
+  size_t key;
+
+  key = ((size_t) ref >> 4)*2654435761U;
+  return (int) ((key ^ (key >> 16)) & (size_t) (size-1));
+}
+
+
+static /*@null@*/ egRefEnt *
+EG_refFind(const egRefs *refs, const egObject *ref)
+{
+  int i;
+
+  if (refs->size == 0) {
+    for (i = 0; i < refs->nent; i++)
+      if (refs->inl[i].ref == ref) return (egRefEnt *) &refs->inl[i];
+    return NULL;
+  }
+
+  i = EG_refHash(ref, refs->size);
+  while (refs->hash[i].ref != NULL) {
+    if (refs->hash[i].ref == ref) return &refs->hash[i];
+    i = (i+1) & (refs->size-1);
+  }
+  return NULL;
+}
+
+
+static int
+EG_refGrow(egRefs *refs, int size)
+{
+  int      i, j, n;
+  egRefEnt *old, *hash;
+
+  hash = (egRefEnt *) EG_alloc(size*sizeof(egRefEnt));
+  if (hash == NULL) return EGADS_MALLOC;
+  for (i = 0; i < size; i++) {
+    hash[i].ref = NULL;
+    hash[i].cnt = 0;
+  }
+  old = refs->inl;
+  n   = refs->nent;
+  if (refs->size != 0) {
+    old = refs->hash;
+    n   = refs->size;
+  }
+  for (i = 0; i < n; i++) {
+    if (old[i].ref == NULL) continue;
+    j = EG_refHash(old[i].ref, size);
+    while (hash[j].ref != NULL) j = (j+1) & (size-1);
+    hash[j] = old[i];
+  }
+  if (refs->size != 0) EG_free(refs->hash);
+  refs->hash = hash;
+  refs->size = size;
+
+  return EGADS_SUCCESS;
+}
+
+
+/* add a reference -- returns the number held by the object */
+
+static int
+EG_refAdd(egObject *context, egObject *object, const egObject *ref)
+{
+  int      i, stat;
+  egRefs   *refs;
+  egRefEnt *ent;
+
+  refs = (egRefs *) object->tref;
+  if (refs == NULL) {
+    refs = (egRefs *) EG_slabAlloc(context, sizeof(egRefs));
+    if (refs == NULL) return EGADS_MALLOC;
+    refs->nref   = 0;
+    refs->nent   = 0;
+    refs->size   = 0;
+    refs->hash   = NULL;
+    refs->oclass = object->oclass;
+    refs->mtype  = object->mtype;
+    object->tref = refs;
+    EG_statsObject((egCntxt *) context->blind, refs->oclass, refs->mtype, 1);
+  }
+
+  ent = EG_refFind(refs, ref);
+  if (ent == NULL) {
+    if ((refs->size == 0) && (refs->nent < NREFINL)) {
+      ent = &refs->inl[refs->nent];
+    } else {
+      if ((refs->size == 0) || (2*(refs->nent+1) > refs->size)) {
+        i    = 2*refs->size;
+        if (i == 0) i = 4*NREFINL;
+        stat = EG_refGrow(refs, i);
+        if (stat != EGADS_SUCCESS) return stat;
+      }
+      i = EG_refHash(ref, refs->size);
+      while (refs->hash[i].ref != NULL) i = (i+1) & (refs->size-1);
+      ent = &refs->hash[i];
+    }
+    ent->ref = ref;
+    ent->cnt = 0;
+    refs->nent++;
+  }
+  ent->cnt++;
+  refs->nref++;
+  EG_statsObject((egCntxt *) context->blind, REFERENCE, 0, 1);
+
+  return refs->nref;
+}
+
+
+/* remove a reference -- the set is released when the last one goes */
+
+static int
+EG_refDel(egCntxt *cntx, egObject *object, const egObject *ref)
+{
+  int      i, j, k, size;
+  egRefs   *refs;
+  egRefEnt *ent;
+
+  refs = (egRefs *) object->tref;
+  if (refs == NULL) return EGADS_NOTFOUND;
+  ent  = EG_refFind(refs, ref);
+  if (ent == NULL)  return EGADS_NOTFOUND;
+
+  refs->nref--;
+  ent->cnt--;
+  EG_statsObject(cntx, REFERENCE, 0, -1);
+  if (ent->cnt == 0) {
+    refs->nent--;
+    if (refs->size == 0) {
+      *ent = refs->inl[refs->nent];
+    } else {
+      /* shift back so that no probe sequence is broken */
+      size = refs->size;
+      i    = ent - refs->hash;
+      j    = i;
+      refs->hash[i].ref = NULL;
+      for (;;) {
+        j = (j+1) & (size-1);
+        if (refs->hash[j].ref == NULL) break;
+        k = EG_refHash(refs->hash[j].ref, size);
+        if ((i <= j) ? ((i < k) && (k <= j)) : ((i < k) || (k <= j)))
+          continue;
+        refs->hash[i]     = refs->hash[j];
+        refs->hash[j].ref = NULL;
+        i = j;
+      }
+    }
+  }
+
+  if (refs->nref == 0) {
+    EG_statsObject(cntx, refs->oclass, refs->mtype, -1);
+    if (refs->size != 0) EG_free(refs->hash);
+    EG_slabFree(refs);
+    object->tref = NULL;
+  }
+  return EGADS_SUCCESS;
+}
+
+
+/* the number of references held by others than ref */
+
+static int
+EG_refOthers(const egObject *object, const egObject *ref)
+{
+  egRefs   *refs;
+  egRefEnt *ent;
+
+  refs = (egRefs *) object->tref;
+  if (refs == NULL) return 0;
+  ent  = EG_refFind(refs, ref);
+  if (ent == NULL)  return refs->nref;
+  return refs->nref - ent->cnt;
+}
+
+
+static int
+EG_refTotal(const egObject *object)
+{
+  egRefs *refs;
+
+  refs = (egRefs *) object->tref;
+  if (refs == NULL) return 0;
+  return refs->nref;
+}
+
+
+/* drop the set outright (the slab entry goes when the Context does) */
+
+static void
+EG_refFree(egObject *object)
+{
+  egRefs *refs;
+
+  refs = (egRefs *) object->tref;
+  if (refs == NULL) return;
+  if (refs->size != 0) EG_free(refs->hash);
+  object->tref = NULL;
+}
+
+
 int
 EG_referenceObject(egObject *object, /*@null@*/ const egObject *ref)
 {
-  int      cnt, stat, outLevel;
-  egObject *next, *last, *obj, *ocontext, *rcontext;
+  int      cnt, outLevel;
+  egObject *ocontext, *rcontext;
+  egCntxt  *cntx;
   
   if (object == NULL)               return EGADS_NULLOBJ;
   if (object->magicnumber != MAGIC) return EGADS_NOTOBJ;
@@ -241,56 +486,13 @@ EG_referenceObject(egObject *object, /*@null@*/ const egObject *ref)
     return EGADS_MIXCNTX;
   }
 
-  cnt = 1;
-  obj = NULL;
-  if (object->tref == NULL) {
-    stat = EG_makeObject(ocontext, &obj);
-    if (outLevel > 2) 
-      printf(" 0 makeRef oclass %d for rclass %d = %d\n", 
-             object->oclass, ref->oclass, stat);
-    if (stat != EGADS_SUCCESS) return stat;
-    if (obj != NULL) {
-      obj->oclass  = REFERENCE;
-      obj->attrs   = (void *) ref;
-      object->tref = obj;
-    }
-  } else {
-    next = object->tref;
-    while (next != NULL) {
-    if (outLevel > 2) {
-      if (next->magicnumber != MAGIC)
-        printf(" %d: Thread not an EGO!\n", cnt);
-      if (next->oclass != REFERENCE)
-        printf(" %d: Not a Reference - class = %d!\n", cnt, next->oclass);
-      }
-      obj = (egObject *) next->attrs;
-      if (outLevel > 2) {
-        if (obj == NULL) {
-          printf(" %d: Reference is NULL!\n", cnt);
-        } else {
-          if (obj->magicnumber != MAGIC)
-            printf(" %d: Reference not an EGO!\n", cnt);
-          if ((obj->oclass == EMPTY) || (obj->oclass == NIL))
-            printf(" %d: Reference is Empty!\n", cnt);
-        }
-      }
-/*    single node edges do double reference!
-      if (obj == ref) return EGADS_SUCCESS;  */
-      last = next;
-      next = (egObject *) last->blind;          /* next reference */
-      cnt++;
-    }
-    stat = EG_makeObject(ocontext, &obj);
-    if (outLevel > 2) 
-      printf(" %d makeRef oclass %d for rclass %d = %d\n", 
-             cnt, object->oclass, ref->oclass, stat);
-    if (stat != EGADS_SUCCESS) return stat;
-    if (obj != NULL) {
-      obj->oclass = REFERENCE;
-      obj->attrs  = (void *) ref;
-      last->blind = obj;
-    }
-  }
+  cntx = (egCntxt *) ocontext->blind;
+  EG_mutexLock(cntx->mutex);
+  cnt  = EG_refAdd(ocontext, object, ref);
+  EG_mutexUnlock(cntx->mutex);
+  if (outLevel > 2)
+    printf(" makeRef oclass %d for rclass %d = %d\n",
+           object->oclass, ref->oclass, cnt);
 
   return cnt;
 }
@@ -315,93 +517,13 @@ EG_referenceTopObj(egObject *object, /*@null@*/ const egObject *ref)
 }
 
 
+/* free the object's data -- flg = 1 leaves the geometry/topology */
+
 static int
-EG_derefObj(egObject *object, /*@null@*/ const egObject *refx, int flg)
+EG_destroyObject(egObject *object, int flg, int outLevel)
 {
-  int      i, j, stat, outLevel;
-  long     ptr1, ptr2;
-  egObject *pobj, *nobj, *obj, *context;
-  egCntxt  *cntx;
+  int      i, j, stat;
   egTessel *tess;
-  const egObject *ref;
-
-  if (object == NULL)               return EGADS_NULLOBJ;
-  if (object->magicnumber != MAGIC) return EGADS_NOTOBJ;
-  if (object->oclass == CONTXT)     return EGADS_NOTCNTX;
-  if (object->oclass == EMPTY)      return EGADS_EMPTY;
-  if (object->oclass == REFERENCE)  return EGADS_REFERCE;
-  context = EG_context(object);
-  if (context == NULL)              return EGADS_NOTCNTX;
-  cntx = (egCntxt *) context->blind;
-  if (cntx == NULL)                 return EGADS_NODATA;
-  outLevel = cntx->outLevel;
-  ref      = refx;
-
-  /* context is an attempt to delete */
-  
-  if ((ref == context) && (object->tref != NULL)) {
-    nobj = object->tref;
-    pobj = NULL;
-    i = 0;
-    while (nobj != NULL) {
-      obj = (egObject *) nobj->attrs;
-      if (obj != ref) i++;
-      pobj = nobj;
-      nobj = (egObject *) pobj->blind;          /* next reference */
-    }
-    if (object->topObj == context)
-      if (i > 0) {
-        if (outLevel > 0)
-          printf(" EGADS Info: dereference with %d active objects!\n", i); 
-        return i;
-      }
-  }
-  if (ref == NULL) ref = context;
-  
-  /* we should never see a NULL reference! */
-  if (object->tref != NULL) {
-    nobj = object->tref;
-    pobj = NULL;
-    while (nobj != NULL) {
-      obj = (egObject *) nobj->attrs;
-      if (obj == ref) break;
-      pobj = nobj;
-      nobj = (egObject *) pobj->blind;          /* next reference */
-    }
-    if (nobj == NULL) {
-      if (refx != NULL) {
-        ptr1 = (long) object;
-        ptr2 = (long) ref;
-        printf(" EGADS Internal: Ref Not Found (EG_dereferenceObject)!\n");
-        printf("                 Object %lx = %d/%d,  ref %lx = %d/%d\n",
-               ptr1, object->oclass, object->mtype,
-               ptr2, ref->oclass, ref->mtype);
-      }
-      return EGADS_NOTFOUND;
-    }
-    if (pobj == NULL) {
-      object->tref = (egObject *) nobj->blind;
-    } else {
-      pobj->blind  = nobj->blind;
-    }
-    obj  = nobj;
-    pobj = obj->prev;
-    nobj = obj->next;
-    if (nobj != NULL) {
-      nobj->prev = pobj;
-    } else {
-      cntx->last = pobj;
-    }
-    pobj->next   = nobj;
-    obj->mtype   = REFERENCE;
-    obj->oclass  = EMPTY;
-    obj->blind   = NULL;
-    obj->topObj  = context;
-    obj->prev    = NULL;
-    obj->next    = cntx->pool;
-    cntx->pool   = obj;  
-  }
-  if (object->tref != NULL) return EGADS_SUCCESS;
 
   stat = EG_attributeDel(object, NULL);
   if (stat != EGADS_SUCCESS)
@@ -418,7 +540,11 @@ EG_derefObj(egObject *object, /*@null@*/ const egObject *refx, int flg)
 
     tess = (egTessel *) object->blind;
     if (tess != NULL) {
+      EG_statsTess(object, 1);
       EG_dereferenceTopObj(tess->src, object);
+      EG_freeTessGlobal(tess);
+      EG_freeTessFloat(tess);
+      EG_unmapTess(tess);
       if (tess->xyzs != NULL) EG_free(tess->xyzs);
       if (tess->tess1d != NULL) {
         for (i = 0; i < tess->nEdge; i++) {
@@ -430,27 +556,13 @@ EG_derefObj(egObject *object, /*@null@*/ const egObject *refx, int flg)
             EG_free(tess->tess1d[i].faces[0].tric);
           if (tess->tess1d[i].faces[1].tric  != NULL)
             EG_free(tess->tess1d[i].faces[1].tric);
-          if (tess->tess1d[i].xyz != NULL) 
-            EG_free(tess->tess1d[i].xyz);
-          if (tess->tess1d[i].t   != NULL) 
-            EG_free(tess->tess1d[i].t);
+          EG_freeTess1D(&tess->tess1d[i]);
         }
         EG_free(tess->tess1d);
       }
       if (tess->tess2d != NULL) {
         for (i = 0; i < 2*tess->nFace; i++) {
-          if (tess->tess2d[i].xyz    != NULL) 
-            EG_free(tess->tess2d[i].xyz);
-          if (tess->tess2d[i].uv     != NULL) 
-            EG_free(tess->tess2d[i].uv);
-          if (tess->tess2d[i].ptype  != NULL) 
-            EG_free(tess->tess2d[i].ptype);
-          if (tess->tess2d[i].pindex != NULL) 
-            EG_free(tess->tess2d[i].pindex);
-          if (tess->tess2d[i].tris   != NULL) 
-            EG_free(tess->tess2d[i].tris);
-          if (tess->tess2d[i].tric   != NULL) 
-            EG_free(tess->tess2d[i].tric);
+          EG_freeTess2D(&tess->tess2d[i]);
           if (tess->tess2d[i].patch  != NULL) {
             for (j = 0; j < tess->tess2d[i].npatch; j++) {
               if (tess->tess2d[i].patch[j].ipts != NULL) 
@@ -476,12 +588,81 @@ EG_derefObj(egObject *object, /*@null@*/ const egObject *refx, int flg)
     if (flg == 0) stat = EG_destroyTopology(object);
 
   }
+
+  return stat;
+}
+
+
+static int
+EG_derefObj(egObject *object, /*@null@*/ const egObject *refx, int flg,
+            int outLvl)
+{
+  int      i, stat, outLevel;
+  long     ptr1, ptr2;
+  egObject *pobj, *nobj, *context;
+  egCntxt  *cntx;
+  const egObject *ref;
+
+  if (object == NULL)               return EGADS_NULLOBJ;
+  if (object->magicnumber != MAGIC) return EGADS_NOTOBJ;
+  if (object->oclass == CONTXT)     return EGADS_NOTCNTX;
+  if (object->oclass == EMPTY)      return EGADS_EMPTY;
+  if (object->oclass == REFERENCE)  return EGADS_REFERCE;
+  context = EG_context(object);
+  if (context == NULL)              return EGADS_NOTCNTX;
+  cntx = (egCntxt *) context->blind;
+  if (cntx == NULL)                 return EGADS_NODATA;
+  if (cntx->closing == 1)           return EGADS_SUCCESS;
+  outLevel = cntx->outLevel;
+  if (outLvl >= 0) outLevel = outLvl;
+  ref      = refx;
+
+  /* context is an attempt to delete */
+  
+  EG_mutexLock(cntx->mutex);
+  if ((ref == context) && (object->tref != NULL)) {
+    i = EG_refOthers(object, ref);
+    if (object->topObj == context)
+      if (i > 0) {
+        EG_mutexUnlock(cntx->mutex);
+        if (outLevel > 0)
+          printf(" EGADS Info: dereference with %d active objects!\n", i); 
+        return i;
+      }
+  }
+  if (ref == NULL) ref = context;
+  
+  /* we should never see a NULL reference! */
+  if (object->tref != NULL) {
+    stat = EG_refDel(cntx, object, ref);
+    if (stat == EGADS_NOTFOUND) {
+      EG_mutexUnlock(cntx->mutex);
+      if (refx != NULL) {
+        ptr1 = (long) object;
+        ptr2 = (long) ref;
+        printf(" EGADS Internal: Ref Not Found (EG_dereferenceObject)!\n");
+        printf("                 Object %lx = %d/%d,  ref %lx = %d/%d\n",
+               ptr1, object->oclass, object->mtype,
+               ptr2, ref->oclass, ref->mtype);
+      }
+      return EGADS_NOTFOUND;
+    }
+  }
+  if (object->tref != NULL) {
+    EG_mutexUnlock(cntx->mutex);
+    return EGADS_SUCCESS;
+  }
+  EG_mutexUnlock(cntx->mutex);
+
+  /* no one else can see the object now -- its data goes unlocked */
+  stat = EG_destroyObject(object, flg, outLevel);
   object->mtype  = object->oclass;
   object->oclass = EMPTY;
   object->blind  = NULL;
   
   /* patch up the lists & put the object in the pool */
 
+  EG_mutexLock(cntx->mutex);
   pobj = object->prev;          /* always have a previous -- context! */
   nobj = object->next;
   if (nobj == NULL) {
@@ -499,6 +680,9 @@ EG_derefObj(egObject *object, /*@null@*/ const egObject *refx, int flg)
   object->prev = NULL;
   object->next = cntx->pool;
   cntx->pool   = object;
+  EG_statsObject(cntx, CONTXT, 0, -1);
+  EG_statsObject(cntx, EMPTY,  0,  1);
+  EG_mutexUnlock(cntx->mutex);
 
   return stat;
 }
@@ -519,14 +703,14 @@ EG_dereferenceTopObj(egObject *object, /*@null@*/ const egObject *ref)
   obj     = object;
   if (object->topObj != context) obj = object->topObj;
   
-  return EG_derefObj(obj, ref, 1);
+  return EG_derefObj(obj, ref, 1, -1);
 }
 
 
 int
 EG_dereferenceObject(egObject *object, /*@null@*/ const egObject *ref)
 {
-  return EG_derefObj(object, ref, 0);
+  return EG_derefObj(object, ref, 0, -1);
 }
 
 
@@ -534,8 +718,8 @@ int
 EG_deleteObject(egObject *object)
 {
   int      outLevel, total, cnt, nref, stat, oclass, mtype, nbody;
-  int      i, *senses;
-  egObject *context, *obj, *next, *pobj, **bodies;
+  int      i, n, *senses;
+  egObject *context, *obj, *next, **bodies, **objs;
   egCntxt  *cntx;
 
   if (object == NULL)               return EGADS_NULLOBJ;
@@ -553,17 +737,11 @@ EG_deleteObject(egObject *object)
       stat = EG_getTopology(object, &next, &oclass, &mtype, NULL, 
                             &nbody, &bodies, &senses);
       if (stat != EGADS_SUCCESS) return stat;
-      for (cnt = i = 0; i < nbody; i++) {
-        if (bodies[i]->tref == NULL) continue;
-        next = bodies[i]->tref;
-        pobj = NULL;
-        while (next != NULL) {
-          obj = (egObject *) next->attrs;
-          if (obj != object) cnt++;
-          pobj = next;
-          next = (egObject *) pobj->blind;      /* next reference */
-        }
-      }
+      cntx = (egCntxt *) context->blind;
+      EG_mutexLock(cntx->mutex);
+      for (cnt = i = 0; i < nbody; i++)
+        cnt += EG_refOthers(bodies[i], object);
+      EG_mutexUnlock(cntx->mutex);
       if (cnt > 0) {
         if (outLevel > 0)
           printf(" EGADS Info: Model delete w/ %d active Body Refs!\n", 
@@ -581,42 +759,71 @@ EG_deleteObject(egObject *object)
   cntx     = (egCntxt *) context->blind;
   if (cntx == NULL) return EGADS_NODATA;
   outLevel = cntx->outLevel;
-  
-  nref = 0;
+
+  /* collect the candidates once under the lock -- dereferencing never
+     makes objects and the pool is held back until the sweep is done, so
+     the ones freed by a cascade (or by another thread) are just EMPTY */
+  EG_mutexLock(cntx->mutex);
+  nref = n = 0;
   obj  = context->next;
   while (obj != NULL) {
-    next = obj->next;
-    if (obj->oclass == REFERENCE) nref++;
-    obj  = next;
+    nref += EG_refTotal(obj);
+    if ((obj->oclass >= PCURVE) && (obj->oclass <= SHELL) &&
+        (obj->topObj == context)) n++;
+    obj = obj->next;
+  }
+  if (n == 0) {
+    EG_mutexUnlock(cntx->mutex);
+    return EGADS_SUCCESS;
+  }
+  objs = (egObject **) EG_alloc(n*sizeof(egObject *));
+  if (objs == NULL) {
+    EG_mutexUnlock(cntx->mutex);
+    if (outLevel > 0)
+      printf(" EGADS Error: Malloc on %d Objects (EG_deleteObject)!\n", n);
+    return EGADS_MALLOC;
   }
+  n   = 0;
+  obj = context->next;
+  while (obj != NULL) {
+    if ((obj->oclass >= PCURVE) && (obj->oclass <= SHELL) &&
+        (obj->topObj == context)) objs[n++] = obj;
+    obj = obj->next;
+  }
+  cntx->sweeping++;
+  EG_mutexUnlock(cntx->mutex);
 
-  cntx->outLevel = total = 0;
+  /* sweep until nothing more goes (removing a referrer frees others) */
+  total = 0;
   do {
     cnt = 0;
-    obj = context->next;
-    while (obj != NULL) {
-      next = obj->next;
-      if ((obj->oclass >= PCURVE) && (obj->oclass <= SHELL) &&
-          (obj->topObj == context)) {
-        stat = EG_dereferenceObject(obj, context);
-        if (stat == EGADS_SUCCESS) {
-          cnt++;
-          break;
-        }
+    for (i = 0; i < n; i++) {
+      obj = objs[i];
+      if (obj == NULL) continue;
+      if ((obj->oclass < PCURVE) || (obj->oclass > SHELL) ||
+          (obj->topObj != context)) {
+        objs[i] = NULL;
+        continue;
+      }
+      stat = EG_derefObj(obj, context, 0, 0);
+      if (stat == EGADS_SUCCESS) {
+        objs[i] = NULL;
+        cnt++;
       }
-      obj = next;
     }
     total += cnt;
   } while (cnt != 0);
-  cntx->outLevel = outLevel;
-  
+  EG_free(objs);
+
+  EG_mutexLock(cntx->mutex);
+  cntx->sweeping--;
   cnt = 0;
   obj = context->next;
   while (obj != NULL) {
-    next = obj->next;
-    if (obj->oclass == REFERENCE) cnt++;
-    obj  = next;
+    cnt += EG_refTotal(obj);
+    obj  = obj->next;
   }
+  EG_mutexUnlock(cntx->mutex);
   
   if ((outLevel > 0) && (total != 0))
     printf(" EGADS Info: %d unattached Objects (%d References) removed!\n",
@@ -629,7 +836,8 @@ EG_deleteObject(egObject *object)
 int
 EG_removeCntxtRef(egObject *object)
 {
-  egObject *context, *nobj, *pobj, *obj;
+  int      stat;
+  egObject *context;
   egCntxt  *cntx;
   
   if (object == NULL)               return EGADS_NULLOBJ;
@@ -644,40 +852,11 @@ EG_removeCntxtRef(egObject *object)
   cntx    = (egCntxt *) context->blind;
   if (cntx == NULL)                 return EGADS_NODATA;
 
-  nobj = object->tref;
-  pobj = NULL;
-  while (nobj != NULL) {
-    obj = (egObject *) nobj->attrs;
-    if (obj == context) break;
-    pobj = nobj;
-    nobj = (egObject *) pobj->blind;          /* next reference */
-  }
-  if (nobj == NULL) return EGADS_NOTFOUND;
-  if (pobj == NULL) {
-    object->tref = (egObject *) nobj->blind;
-  } else {
-    pobj->blind  = nobj->blind;
-  }
-  obj  = nobj;
-  pobj = obj->prev;
-  nobj = obj->next;
-  if (nobj != NULL) {
-    nobj->prev = pobj;
-  } else {
-    cntx->last = pobj;
-  }
-  pobj->next   = nobj;
-  obj->mtype   = REFERENCE;
-  obj->oclass  = EMPTY;
-  obj->blind   = NULL;
-  obj->topObj  = context;
-  obj->prev    = NULL;
-  obj->next    = cntx->pool;
-  /*@ignore@*/ 
-  cntx->pool   = obj;
-  /*@end@*/
+  EG_mutexLock(cntx->mutex);
+  stat = EG_refDel(cntx, object, context);
+  EG_mutexUnlock(cntx->mutex);
 
-  return EGADS_SUCCESS;
+  return stat;
 }
 
 
@@ -907,8 +1086,8 @@ EG_flipObject(const egObject *object, egObject **copy)
 int
 EG_close(egObject *context)
 {
-  int      outLevel, cnt, ref, total, stat;
-  egObject *obj, *next, *last;
+  int      outLevel, cnt, ref, total;
+  egObject *obj, *next;
   egCntxt  *cntx;
 
   if (context == NULL)               return EGADS_NULLOBJ;
@@ -928,17 +1107,14 @@ EG_close(egObject *context)
       printf("             Class = %d\n", obj->oclass);
       return EGADS_NOTFOUND;
     }
-    if (obj->oclass == REFERENCE) {
-      ref++;
-    } else {
-      if (outLevel > 2)
-        printf(" EGADS Info: Object oclass = %d, mtype = %d Found!\n",
-               obj->oclass, obj->mtype);
-      cnt++;
-    }
-    obj = obj->next;
+    if (outLevel > 2)
+      printf(" EGADS Info: Object oclass = %d, mtype = %d Found!\n",
+             obj->oclass, obj->mtype);
+    ref += EG_refTotal(obj);
+    cnt++;
+    obj  = obj->next;
   }
-  total = ref+cnt;
+  total = cnt;
   obj   = cntx->pool;
   while (obj != NULL) {
     next = obj->next;
@@ -949,138 +1125,33 @@ EG_close(egObject *context)
     printf(" EGADS Info: %d Objects, %d Reference in Use (of %d) at Close!\n",
            cnt, ref, total);
 
-  /* delete unattached geometry and topology objects */
-  
-  EG_deleteObject(context);
-  
-  /* delete tessellation objects */
-
-  obj  = context->next;
-  last = NULL;
-  while (obj != NULL) {
-    next = obj->next;
-    if (obj->oclass == TESSELLATION)
-      if (EG_deleteObject(obj) == EGADS_SUCCESS) {
-        obj = last;
-        if (obj == NULL) {
-          next = context->next;
-        } else {
-          next = obj->next;
-        }
-      }
-    last = obj;
-    obj  = next;
-  }
-
-  /* delete all models */
-
-  obj  = context->next;
-  last = NULL;
-  while (obj != NULL) {
-    next = obj->next;
-    if (obj->oclass == MODEL)
-      if (EG_deleteObject(obj) == EGADS_SUCCESS) {
-        obj = last;
-        if (obj == NULL) {
-          next = context->next;
-        } else {
-          next = obj->next;
-        }
-      }
-    last = obj;
-    obj  = next;
-  }
-  
-  /* delete all bodies that are left */
-  
-  obj  = context->next;
-  last = NULL;
-  while (obj != NULL) {
-    next = obj->next;
-    if (obj->oclass == BODY)
-      if (EG_deleteObject(obj) == EGADS_SUCCESS) {
-        obj = last;
-        if (obj == NULL) {
-          next = context->next;
-        } else {
-          next = obj->next;
-        }
-      }
-    last = obj;
-    obj  = next;
-  }
-  
-  /* dereference until nothing is left (which should be the case) */
-
-  do {
-    cnt = 0;
-    obj = context->next;
-    while (obj != NULL) {
-      next = obj->next;
-      if (obj->oclass != REFERENCE) {
-        stat = EG_dereferenceTopObj(obj, NULL);
-        if (stat == EGADS_SUCCESS) {
-          cnt++;
-          break;
-        }
-      }
-      obj = next;
-    }
-    if (cnt != 0) continue;
-    obj = context->next;
-    while (obj != NULL) {
-      next = obj->next;
-      if (obj->oclass != REFERENCE) {
-        stat = EG_dereferenceObject(obj, NULL);
-        if (stat == EGADS_SUCCESS) {
-          cnt++;
-          break;
-        }
-      }
-      obj = next;
-    }    
-  } while (cnt != 0);
+  /* the whole Context goes -- free the data of every object in a single
+     pass with no reference bookkeeping (EG_derefObj does nothing now) */
 
-  ref = cnt = 0;
+  cntx->closing = 1;
   obj = context->next;
   while (obj != NULL) {
-    if (cnt == 0)
-      if (outLevel > 1)
-        printf(" EGADS Info: Undeleted Object(s) in cleanup (EG_close):\n");
-    if (obj->oclass == REFERENCE) {
-      ref++;
-    } else {
-      if (outLevel > 1)
-        printf("             %d: Class = %d, Type = %d\n", 
-               cnt, obj->oclass, obj->mtype);
+    next = obj->next;
+    if (obj->oclass != EMPTY) {
+      EG_refFree(obj);
+      EG_destroyObject(obj, 0, outLevel);
+      obj->mtype  = obj->oclass;
+      obj->oclass = EMPTY;
+      obj->blind  = NULL;
     }
-    obj = obj->next;
-    cnt++;
+    obj = next;
   }
-  if (outLevel > 1)
-    if ((cnt != 0) && (ref != 0))
-      printf("             In Addition to %d Refereces\n", ref);  
+  context->next = NULL;
+  cntx->last    = context;
+  cntx->pool    = NULL;
 
-  /* clean up the pool */
+  /* release the objects & the topology blinds in bulk */
   
-  obj = cntx->pool;
-  if (obj == NULL) return EGADS_SUCCESS;
-  if (obj->magicnumber != MAGIC) {
-    printf(" EGADS Info: Found bad Object in Cleanup (EG_close)!\n");
-    printf("             Class = %d\n", obj->oclass);
-    return EGADS_SUCCESS;
-  }
-  while (obj != NULL) {
-    if (obj->magicnumber != MAGIC) {
-      printf(" EGADS Info: Found BAD Object in Cleanup (EG_close)!\n");
-      printf("             Class = %d\n", obj->oclass);
-      break;
-    }
-    next = obj->next;
-    EG_free(obj);
-    obj = next;
-  }
+  EG_slabClose(cntx);
+  EG_mutexDestroy(cntx->mutex);
   EG_attributeDel(context, NULL);
+  EG_attrAtomFree(cntx);
+  EG_statsClose(cntx);
   EG_free(context);
   EG_free(cntx);
     
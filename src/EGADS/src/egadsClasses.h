@@ -11,7 +11,23 @@
  *
  */
 
+#include <new>
+
 #include "egadsOCC.h"
+#include "egadsSpline.h"
+
+
+// the topology blinds come from the Context slabs -- made with
+//   "new (context) egadsXxx" & returned with the usual delete
+#define EG_SLABCLASS \
+  static void *operator new(size_t size, egObject *context) \
+  { \
+    void *ptr = EG_slabAlloc(context, (int) size); \
+    if (ptr == NULL) throw std::bad_alloc(); \
+    return ptr; \
+  } \
+  static void operator delete(void *ptr, egObject *) { EG_slabFree(ptr); } \
+  static void operator delete(void *ptr)             { EG_slabFree(ptr); }
 
 
 class egadsPCurve
@@ -29,6 +45,7 @@ public:
   Handle(Geom_Curve) handle;
   egObject           *basis;
   int                topFlg;
+  egSpline           *spline;         /* native evaluator (or NULL) */
 };
 
 
@@ -38,30 +55,36 @@ public:
   Handle(Geom_Surface) handle;
   egObject             *basis;
   int                  topFlg;
+  egSpline             *spline;       /* native evaluator (or NULL) */
 };
 
 
 class egadsNode
 {
 public:
+  EG_SLABCLASS
   TopoDS_Vertex node;
   double        xyz[3];
+  int           bIndex;                 // index in the owning body
 };
 
 
 class egadsEdge
 {
 public:
+  EG_SLABCLASS
   TopoDS_Edge edge;
   egObject    *curve;                   // curve object
   egObject    *nodes[2];                // pointer to ego nodes
   int         topFlg;
+  int         bIndex;                   // index in the owning body
 };
 
 
 class egadsLoop
 {
 public:
+  EG_SLABCLASS
   TopoDS_Wire loop;
   egObject    *surface;                 // associated non-planar surface
                                         // will have pcurves after edges (nonNULL)
@@ -69,28 +92,33 @@ public:
   egObject    **edges;                  // edge objects (*2 if surface is nonNULL)
   int         *senses;                  // sense for each edge
   int         topFlg;
+  int         bIndex;                   // index in the owning body
 };
 
 
 class egadsFace
 {
 public:
+  EG_SLABCLASS
   TopoDS_Face face;
   egObject    *surface;                 // surface object
   int         nloops;                   // number of loops
   egObject    **loops;                  // loop objects
   int         *senses;                  // outer/inner for each loop
   int         topFlg;
+  int         bIndex;                   // index in the owning body
 };
 
 
 class egadsShell
 {
 public:
+  EG_SLABCLASS
   TopoDS_Shell shell;
   int          nfaces;                  // number of faces
   egObject    **faces;                  // face objects
   int         topFlg;
+  int         bIndex;                   // index in the owning body
 };
 
 
@@ -99,6 +127,7 @@ class egadsMap
 public:
   TopTools_IndexedMapOfShape map;
   egObject                   **objs;    // vector of egos w/ map
+  int                        *ancs[4];  // ancestor tables (EDGE - SHELL)
 };
 
 
@@ -112,6 +141,7 @@ public:
   egadsMap     faces;
   egadsMap     shells;
   int          *senses;                 // shell outer/inner (solids)
+  int          lazy;                    // egos made on first access (2-all)
 };
 
 
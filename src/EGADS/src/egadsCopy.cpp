@@ -28,7 +28,11 @@
   extern     int  EG_traverseBody( egObject *context, int i, egObject *bobj, 
                                    egObject *topObj, egadsBody *body );
   extern     int  EG_shellClosure( egadsShell *pshell, int flag );
-  extern     int  EG_attriBodyCopy( const egObject *src, egObject *dst );
+  extern     int  EG_attriBodyCopy( const egObject *src, egObject *dst,
+                                    /*@null@*/ int **imaps,
+                           /*@null@*/ BRepBuilderAPI_Transform *xForm );
+  extern     int  EG_mapIndex( const egadsMap &emap, int hint,
+                               const TopoDS_Shape &shape );
   extern     void EG_fillPCurves( TopoDS_Face face, egObject *surfo, 
                                   egObject *loopo, egObject *topObj );
   extern     void EG_completePCurve( egObject *g, Handle(Geom2d_Curve) &hCurv );
@@ -36,9 +40,69 @@
   extern     void EG_completeSurf(   egObject *g, Handle(Geom_Surface) &hSurf );  
 
 
+// fills the index table from one class of the source Body to the copy
+// (1 bias, 0 - none) -- the transform usually keeps the ordering so only
+// shapes that moved need a lookup
+
+static void
+EG_copyIndexMap(BRepBuilderAPI_Transform &xForm, 
+                const TopTools_IndexedMapOfShape &smap,
+                const TopTools_IndexedMapOfShape &dmap, int *imap)
+{
+  int i, n = smap.Extent();
+  
+  for (i = 1; i <= n; i++) {
+    imap[i-1] = 0;
+    try {
+      const TopoDS_Shape &shape = xForm.ModifiedShape(smap(i));
+      if ((i <= dmap.Extent()) && (dmap(i).IsSame(shape))) {
+        imap[i-1] = i;
+      } else {
+        imap[i-1] = dmap.FindIndex(shape);
+      }
+    }
+    catch (...) {
+      imap[i-1] = 0;
+    }
+  }
+}
+
+
+// the index tables for all classes: nodes, edges, loops, faces & shells --
+// built once for each copied Body
+
+static /*@null@*/ int *
+EG_copyIndexMaps(BRepBuilderAPI_Transform &xForm, egadsBody *sbody, 
+                 egadsBody *dbody, int **imaps)
+{
+  int n, *imap;
+  
+  n = sbody->nodes.map.Extent() + sbody->edges.map.Extent() +
+      sbody->loops.map.Extent() + sbody->faces.map.Extent() +
+      sbody->shells.map.Extent();
+  imap = (int *) EG_alloc((n+1)*sizeof(int));
+  if (imap == NULL) return NULL;
+  
+  imaps[0] = imap;
+  imaps[1] = imaps[0] + sbody->nodes.map.Extent();
+  imaps[2] = imaps[1] + sbody->edges.map.Extent();
+  imaps[3] = imaps[2] + sbody->loops.map.Extent();
+  imaps[4] = imaps[3] + sbody->faces.map.Extent();
+  EG_copyIndexMap(xForm, sbody->nodes.map,  dbody->nodes.map,  imaps[0]);
+  EG_copyIndexMap(xForm, sbody->edges.map,  dbody->edges.map,  imaps[1]);
+  EG_copyIndexMap(xForm, sbody->loops.map,  dbody->loops.map,  imaps[2]);
+  EG_copyIndexMap(xForm, sbody->faces.map,  dbody->faces.map,  imaps[3]);
+  EG_copyIndexMap(xForm, sbody->shells.map, dbody->shells.map, imaps[4]);
+  return imap;
+}
+
+
+// hints holds the expected map index of the next new Node, Edge, Loop &
+// Face -- the copy is walked in about the order its maps were made
+
 static int
-EG_copyAttrTopo(egadsBody *pbody, gp_Trsf form, const egObject *src, 
-                egObject *dst, egObject *topObj)
+EG_copyAttrTopo(egadsBody *pbody, int *hints, gp_Trsf form,
+                const egObject *src, egObject *dst, egObject *topObj)
 {
   int      index, stat, outLevel;
   egObject *context;
@@ -82,19 +146,22 @@ EG_copyAttrTopo(egadsBody *pbody, gp_Trsf form, const egObject *src,
     }
     
     TopExp::Vertices(Edge, V2, V1, Standard_True);
-    index = pbody->nodes.map.FindIndex(V1);
+    index = EG_mapIndex(pbody->nodes, hints[0], V1);
     if (index > 0) pn1 = pbody->nodes.objs[index-1];
     if (pn1 == NULL) {
       EG_makeObject(context, &pn1);
       if (pn1 != NULL) {
-        egadsNode *pnode = new egadsNode;
+        egadsNode *pnode = new (context) egadsNode;
         pnode->node      = V1;
         pn1->blind       = pnode;
         egObject *snode  = sedge->nodes[0];
         if (Edge.Orientation() != TopAbs_REVERSED) 
           snode          = sedge->nodes[1];
-        EG_copyAttrTopo(pbody, form, snode, pn1, topObj);
-        if (index > 0) pbody->nodes.objs[index-1] = pn1;
+        EG_copyAttrTopo(pbody, hints, form, snode, pn1, topObj);
+        if (index > 0) {
+          pbody->nodes.objs[index-1] = pn1;
+          hints[0] = index+1;
+        }
       }
     }
     if (V1.IsSame(V2)) {
@@ -102,19 +169,22 @@ EG_copyAttrTopo(egadsBody *pbody, gp_Trsf form, const egObject *src,
       pn2        = pn1;
     } else {
       dst->mtype = TWONODE;
-      index = pbody->nodes.map.FindIndex(V2);
+      index = EG_mapIndex(pbody->nodes, hints[0], V2);
       if (index > 0) pn2 = pbody->nodes.objs[index-1];
       if (pn2 == NULL) {
         EG_makeObject(context, &pn2);
         if (pn2 != NULL) {
-          egadsNode *pnode = new egadsNode;
+          egadsNode *pnode = new (context) egadsNode;
           pnode->node      = V2;
           pn2->blind       = pnode;
           egObject *snode  = sedge->nodes[1];
           if (Edge.Orientation() != TopAbs_REVERSED) 
             snode          = sedge->nodes[0];
-          EG_copyAttrTopo(pbody, form, snode, pn2, topObj);
-          if (index > 0) pbody->nodes.objs[index-1] = pn2;
+          EG_copyAttrTopo(pbody, hints, form, snode, pn2, topObj);
+          if (index > 0) {
+            pbody->nodes.objs[index-1] = pn2;
+            hints[0] = index+1;
+          }
         }
       }
     }
@@ -185,16 +255,20 @@ EG_copyAttrTopo(egadsBody *pbody, gp_Trsf form, const egObject *src,
       senses[k]          = 1;
       if (shapW.Orientation() == TopAbs_REVERSED) senses[k] = -1;
       if (hit == 2) edgeo[k+ne] = NULL;
-      index = pbody->edges.map.FindIndex(Edge);
+      index = EG_mapIndex(pbody->edges, hints[1], Edge);
       if (index > 0) edgeo[k] = pbody->edges.objs[index-1];
       if (edgeo[k] == NULL) {
         EG_makeObject(context, &edgeo[k]);
         if (edgeo[k] != NULL) {
-          egadsEdge *pedge = new egadsEdge;
+          egadsEdge *pedge = new (context) egadsEdge;
           pedge->edge      = Edge;
           edgeo[k]->blind  = pedge;
-          EG_copyAttrTopo(pbody, form, sloop->edges[k], edgeo[k], topObj);
-          if (index > 0) pbody->edges.objs[index-1] = edgeo[k];
+          EG_copyAttrTopo(pbody, hints, form, sloop->edges[k], edgeo[k],
+                          topObj);
+          if (index > 0) {
+            pbody->edges.objs[index-1] = edgeo[k];
+            hints[1] = index+1;
+          }
         }
       }
       if (edgeo[k] != NULL) EG_referenceObject(edgeo[k], dst);
@@ -252,19 +326,23 @@ EG_copyAttrTopo(egadsBody *pbody, gp_Trsf form, const egObject *src,
       loopo[k]           = NULL;
       senses[k]          = -1;
       if (Wire.IsSame(oWire)) senses[k] = 1;
-      index = pbody->loops.map.FindIndex(Wire);
+      index = EG_mapIndex(pbody->loops, hints[2], Wire);
       if (index > 0) loopo[k] = pbody->loops.objs[index-1];
       if (loopo[k] == NULL) {
         EG_makeObject(context, &loopo[k]);
         if (loopo[k] != NULL) {
-          egadsLoop *ploop = new egadsLoop;
+          egadsLoop *ploop = new (context) egadsLoop;
           ploop->loop      = Wire;
           ploop->surface   = geom;
           if (geom != NULL)
             if (geom->mtype == PLANE) ploop->surface = NULL;
           loopo[k]->blind  = ploop;
-          EG_copyAttrTopo(pbody, form, sface->loops[k], loopo[k], topObj);
-          if (index > 0) pbody->loops.objs[index-1] = loopo[k];
+          EG_copyAttrTopo(pbody, hints, form, sface->loops[k], loopo[k],
+                          topObj);
+          if (index > 0) {
+            pbody->loops.objs[index-1] = loopo[k];
+            hints[2] = index+1;
+          }
           EG_fillPCurves(Face, geom, loopo[k], topObj);
         }
       }
@@ -297,16 +375,20 @@ EG_copyAttrTopo(egadsBody *pbody, gp_Trsf form, const egObject *src,
       TopoDS_Shape shapf = ExpF.Current();
       TopoDS_Face  Face  = TopoDS::Face(shapf);
       faceo[k]           = NULL;
-      index = pbody->faces.map.FindIndex(Face);
+      index = EG_mapIndex(pbody->faces, hints[3], Face);
       if (index > 0) faceo[k] = pbody->faces.objs[index-1];
       if (faceo[k] == NULL) {
         EG_makeObject(context, &faceo[k]);
         if (faceo[k] != NULL) {
-          egadsFace *pface = new egadsFace;
+          egadsFace *pface = new (context) egadsFace;
           pface->face      = Face;
           faceo[k]->blind  = pface;
-          EG_copyAttrTopo(pbody, form, sshell->faces[k], faceo[k], topObj);
-          if (index > 0) pbody->faces.objs[index-1] = faceo[k];
+          EG_copyAttrTopo(pbody, hints, form, sshell->faces[k], faceo[k],
+                          topObj);
+          if (index > 0) {
+            pbody->faces.objs[index-1] = faceo[k];
+            hints[3] = index+1;
+          }
         }
       }
       if (faceo[k] != NULL) EG_referenceObject(faceo[k], dst);
@@ -327,7 +409,8 @@ EG_copyAttrTopo(egadsBody *pbody, gp_Trsf form, const egObject *src,
 int
 EG_copyTopology(const egObject *topo, /*@null@*/ double *xform, egObject **copy)
 {
-  int             i, stat, nent, outLevel;
+  int             i, stat, nent, outLevel, *imap, *imaps[5];
+  int             hints[4] = {1, 1, 1, 1};
   egObject        *obj, *context;
   egadsBody       ebody;
   TopoDS_Shape    shape, nTopo;
@@ -402,11 +485,11 @@ EG_copyTopology(const egObject *topo, /*@null@*/ double *xform, egObject **copy)
   }
   if (topo->oclass == NODE) {
  
-    egadsNode *pnode   = new egadsNode;
+    egadsNode *pnode   = new (context) egadsNode;
     TopoDS_Vertex Vert = TopoDS::Vertex(nTopo);
     pnode->node        = Vert;
     obj->blind         = pnode;
-    EG_copyAttrTopo(NULL, form, topo, obj, obj);
+    EG_copyAttrTopo(NULL, NULL, form, topo, obj, obj);
 
   } else if (topo->oclass == EDGE) {
   
@@ -415,11 +498,11 @@ EG_copyTopology(const egObject *topo, /*@null@*/ double *xform, egObject **copy)
     ebody.nodes.objs = new egObject*[nent];
     for (i = 0; i < nent; i++) ebody.nodes.objs[i] = NULL;
 
-    egadsEdge *pedge = new egadsEdge;
+    egadsEdge *pedge = new (context) egadsEdge;
     TopoDS_Edge Edge = TopoDS::Edge(nTopo);
     pedge->edge      = Edge;
     obj->blind       = pedge;
-    EG_copyAttrTopo(&ebody, form, topo, obj, obj);
+    EG_copyAttrTopo(&ebody, hints, form, topo, obj, obj);
     
     delete ebody.nodes.objs;
 
@@ -434,12 +517,12 @@ EG_copyTopology(const egObject *topo, /*@null@*/ double *xform, egObject **copy)
     ebody.edges.objs = new egObject*[nent];
     for (i = 0; i < nent; i++) ebody.edges.objs[i] = NULL;
 
-    egadsLoop *ploop = new egadsLoop;
+    egadsLoop *ploop = new (context) egadsLoop;
     TopoDS_Wire Loop = TopoDS::Wire(nTopo);
     ploop->loop      = Loop;
     ploop->surface   = NULL;
     obj->blind       = ploop;
-    EG_copyAttrTopo(&ebody, form, topo, obj, obj);
+    EG_copyAttrTopo(&ebody, hints, form, topo, obj, obj);
     
     delete ebody.edges.objs;
     delete ebody.nodes.objs;
@@ -459,11 +542,11 @@ EG_copyTopology(const egObject *topo, /*@null@*/ double *xform, egObject **copy)
     ebody.loops.objs = new egObject*[nent];
     for (i = 0; i < nent; i++) ebody.loops.objs[i] = NULL;
 
-    egadsFace *pface = new egadsFace;
+    egadsFace *pface = new (context) egadsFace;
     TopoDS_Face Face = TopoDS::Face(nTopo);
     pface->face      = Face;
     obj->blind       = pface;
-    EG_copyAttrTopo(&ebody, form, topo, obj, obj);
+    EG_copyAttrTopo(&ebody, hints, form, topo, obj, obj);
     
     delete ebody.loops.objs;
     delete ebody.edges.objs;
@@ -488,11 +571,11 @@ EG_copyTopology(const egObject *topo, /*@null@*/ double *xform, egObject **copy)
     ebody.faces.objs = new egObject*[nent];
     for (i = 0; i < nent; i++) ebody.faces.objs[i] = NULL;
 
-    egadsShell *pshell = new egadsShell;
+    egadsShell *pshell = new (context) egadsShell;
     TopoDS_Shell Shell = TopoDS::Shell(nTopo);
     pshell->shell      = Shell;
     obj->blind         = pshell;
-    EG_copyAttrTopo(&ebody, form, topo, obj, obj);
+    EG_copyAttrTopo(&ebody, hints, form, topo, obj, obj);
     
     delete ebody.faces.objs;
     delete ebody.loops.objs;
@@ -517,7 +600,14 @@ EG_copyTopology(const egObject *topo, /*@null@*/ double *xform, egObject **copy)
       delete pbody;
       return stat;
     }
-    EG_attriBodyCopy(topo, obj);
+    egadsBody *sbody = (egadsBody *) topo->blind;
+    imap = EG_copyIndexMaps(xForm, sbody, pbody, imaps);
+    if (imap == NULL) {
+      EG_attriBodyCopy(topo, obj, NULL, &xForm);
+    } else {
+      EG_attriBodyCopy(topo, obj, imaps, &xForm);
+      EG_free(imap);
+    }
 
   } else {
 
@@ -591,8 +681,15 @@ EG_copyTopology(const egObject *topo, /*@null@*/ double *xform, egObject **copy)
         delete mshape;
         return stat;
       }
-      egObject *sobj = pmodel->bodies[i];
-      EG_attriBodyCopy(sobj, pobj);
+      egObject  *sobj  = pmodel->bodies[i];
+      egadsBody *sbody = (egadsBody *) sobj->blind;
+      imap = EG_copyIndexMaps(xForm, sbody, pbody, imaps);
+      if (imap == NULL) {
+        EG_attriBodyCopy(sobj, pobj, NULL, &xForm);
+      } else {
+        EG_attriBodyCopy(sobj, pobj, imaps, &xForm);
+        EG_free(imap);
+      }
     }
     EG_attributeDup(topo, obj);
 
@@ -730,7 +827,7 @@ EG_flipAttrTopo(egadsBody *pbody, egadsBody *tbody, const egObject *src,
     if (pn1 == NULL) {
       EG_makeObject(context, &pn1);
       if (pn1 != NULL) {
-        egadsNode *pnode = new egadsNode;
+        egadsNode *pnode = new (context) egadsNode;
         pnode->node      = V1;
         pn1->blind       = pnode;
         pn1->oclass      = NODE;
@@ -748,7 +845,7 @@ EG_flipAttrTopo(egadsBody *pbody, egadsBody *tbody, const egObject *src,
       if (pn2 == NULL) {
         EG_makeObject(context, &pn2);
         if (pn2 != NULL) {
-          egadsNode *pnode = new egadsNode;
+          egadsNode *pnode = new (context) egadsNode;
           pnode->node      = V2;
           pn2->blind       = pnode;
           pn2->oclass      = NODE;
@@ -826,7 +923,7 @@ EG_flipAttrTopo(egadsBody *pbody, egadsBody *tbody, const egObject *src,
       if (edgeo[k] == NULL) {
         EG_makeObject(context, &edgeo[k]);
         if (edgeo[k] != NULL) {
-          egadsEdge *pedge = new egadsEdge;
+          egadsEdge *pedge = new (context) egadsEdge;
           pedge->edge      = Edge;
           edgeo[k]->blind  = pedge;
           edgeo[k]->oclass = EDGE;
@@ -913,7 +1010,7 @@ EG_flipAttrTopo(egadsBody *pbody, egadsBody *tbody, const egObject *src,
       if (loopo[k] == NULL) {
         EG_makeObject(context, &loopo[k]);
         if (loopo[k] != NULL) {
-          egadsLoop *ploop = new egadsLoop;
+          egadsLoop *ploop = new (context) egadsLoop;
           ploop->loop      = Wire;
           ploop->surface   = geom;
           if (geom != NULL)
@@ -962,7 +1059,7 @@ EG_flipAttrTopo(egadsBody *pbody, egadsBody *tbody, const egObject *src,
       if (faceo[k] == NULL) {
         EG_makeObject(context, &faceo[k]);
         if (faceo[k] != NULL) {
-          egadsFace *pface = new egadsFace;
+          egadsFace *pface = new (context) egadsFace;
           pface->face      = Face;
           faceo[k]->blind  = pface;
           faceo[k]->oclass = FACE;
@@ -1051,7 +1148,7 @@ EG_flipTopology(const egObject *topo, egObject **copy)
     ebody.edges.objs = new egObject*[nent];
     for (i = 0; i < nent; i++) ebody.edges.objs[i] = NULL;
     
-    egadsLoop *ploop = new egadsLoop;
+    egadsLoop *ploop = new (context) egadsLoop;
     TopoDS_Wire Loop = TopoDS::Wire(nTopo);
     ploop->loop      = Loop;
     ploop->surface   = NULL;
@@ -1095,7 +1192,7 @@ EG_flipTopology(const egObject *topo, egObject **copy)
     ebody.loops.objs = new egObject*[nent];
     for (i = 0; i < nent; i++) ebody.loops.objs[i] = NULL;
     
-    egadsFace *pface = new egadsFace;
+    egadsFace *pface = new (context) egadsFace;
     TopoDS_Face Face = TopoDS::Face(nTopo);
     pface->face      = Face;
     obj->blind       = pface;
@@ -1148,7 +1245,7 @@ EG_flipTopology(const egObject *topo, egObject **copy)
     ebody.faces.objs = new egObject*[nent];
     for (i = 0; i < nent; i++) ebody.faces.objs[i] = NULL;
     
-    egadsShell *pshell = new egadsShell;
+    egadsShell *pshell = new (context) egadsShell;
     TopoDS_Shell Shell = TopoDS::Shell(nTopo);
     pshell->shell      = Shell;
     obj->blind         = pshell;
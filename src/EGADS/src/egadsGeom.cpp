@@ -18,6 +18,7 @@
 
 #define PARAMACC 1.0e-4         // parameter accuracy
 #define KNACC    1.0e-12	// knot accuracy
+#define WARMACC  1.0e-10        // stalled warm step (relative to range)
 
 
   extern "C" int EG_destroyGeometry( egObject *geom );
@@ -43,9 +44,40 @@
   extern "C" int EG_isoCline( const egObject *surface, int UV, double value, 
                               egObject **newcurve );
   extern "C" int EG_convertToBSpline( egObject *geom, egObject **bspline ); 
+  extern "C" const void *EG_geomKey( const egObject *geom );
 
 
 
+/* build the native evaluator for non-rational/non-periodic BSplines --
+ * left NULL (and OCC used) for anything EG_splineMake does not accept */
+
+static void
+EG_nativeSpline(egObject *geom)
+{
+  int      stat, oclass, mtype, *ivec;
+  double   *rvec;
+  egObject *ref;
+  egSpline *spline;
+
+  if (geom->mtype != BSPLINE) return;
+  if ((geom->oclass != CURVE) && (geom->oclass != SURFACE)) return;
+  stat = EG_getGeometry(geom, &oclass, &mtype, &ref, &ivec, &rvec);
+  if (stat != EGADS_SUCCESS) return;
+  stat = EG_splineMake(oclass == CURVE ? 1 : 2, ivec, rvec, &spline);
+  EG_free(ivec);
+  EG_free(rvec);
+  if (stat != EGADS_SUCCESS) return;
+
+  if (oclass == CURVE) {
+    egadsCurve *pcurve = (egadsCurve *) geom->blind;
+    pcurve->spline     = spline;
+  } else {
+    egadsSurface *psurf = (egadsSurface *) geom->blind;
+    psurf->spline       = spline;
+  }
+}
+
+
 int 
 EG_destroyGeometry(egObject *geom)
 {
@@ -73,7 +105,10 @@ EG_destroyGeometry(egObject *geom)
       } else {
         EG_dereferenceTopObj(obj, geom);
       }
-    if (pcurve != NULL) delete pcurve;
+    if (pcurve != NULL) {
+      EG_splineFree(pcurve->spline);
+      delete pcurve;
+    }
 
   } else {
   
@@ -85,7 +120,10 @@ EG_destroyGeometry(egObject *geom)
       } else {
         EG_dereferenceTopObj(obj, geom);
       }
-    if (psurf != NULL) delete psurf;
+    if (psurf != NULL) {
+      EG_splineFree(psurf->spline);
+      delete psurf;
+    }
 
   }
   return EGADS_SUCCESS;
@@ -225,6 +263,7 @@ EG_completeCurve(egObject *geom, Handle(Geom_Curve) &hCurve)
   pcurve->handle     = hCurve;
   pcurve->basis      = NULL;
   pcurve->topFlg     = 0;
+  pcurve->spline     = NULL;
   geom->blind        = pcurve;
 
   // stand alone geometry
@@ -261,6 +300,7 @@ EG_completeCurve(egObject *geom, Handle(Geom_Curve) &hCurve)
   Handle(Geom_BSplineCurve) hBSpline = Handle(Geom_BSplineCurve)::DownCast(hCurve);
   if (!hBSpline.IsNull()) {
     geom->mtype = BSPLINE;
+    EG_nativeSpline(geom);
     return;
   }
   
@@ -310,6 +350,7 @@ void EG_completeSurf(egObject *geom, Handle(Geom_Surface) &hSurf)
   psurf->handle       = hSurf;
   psurf->basis        = NULL;
   psurf->topFlg       = 0;
+  psurf->spline       = NULL;
   geom->blind         = psurf;
   
   // stand alone geometry
@@ -352,6 +393,7 @@ void EG_completeSurf(egObject *geom, Handle(Geom_Surface) &hSurf)
     Handle(Geom_BSplineSurface)::DownCast(hSurf);
   if (!hBSpline.IsNull()) {
     geom->mtype = BSPLINE;
+    EG_nativeSpline(geom);
     return;
   }
 
@@ -1789,7 +1831,9 @@ EG_makeGeometry(egObject *context, int oclass, int mtype,
     pcurve->handle     = hCurve;
     pcurve->basis      = basis;
     pcurve->topFlg     = 1;
+    pcurve->spline     = NULL;
     obj->blind         = pcurve;
+    EG_nativeSpline(obj);
     EG_referenceObject(obj, context);
     if (basis != NULL) EG_referenceTopObj(basis, obj);
 
@@ -2056,7 +2100,9 @@ EG_makeGeometry(egObject *context, int oclass, int mtype,
     psurf->handle       = hSurf;
     psurf->basis        = basis;
     psurf->topFlg       = 1;
+    psurf->spline       = NULL;
     obj->blind          = psurf;
+    EG_nativeSpline(obj);
     EG_referenceObject(obj, context);
     if (basis != NULL) EG_referenceTopObj(basis, obj);
 
@@ -2131,6 +2177,34 @@ EG_getRange(const egObject *geom, double *range, int *periodic)
 }
 
 
+/* the OCC geometry behind an object -- split & periodic Faces (and their
+ *   surface objects) share one and so its evaluation caches */
+
+const void *
+EG_geomKey(const egObject *geom)
+{
+  if (geom == NULL)               return NULL;
+  if (geom->magicnumber != MAGIC) return NULL;
+  if (geom->blind == NULL)        return NULL;
+
+  if (geom->oclass == PCURVE) {
+    egadsPCurve *ppcurv = (egadsPCurve *) geom->blind;
+    return ppcurv->handle.operator->();
+  } else if (geom->oclass == CURVE) {
+    egadsCurve *pcurve = (egadsCurve *) geom->blind;
+    return pcurve->handle.operator->();
+  } else if (geom->oclass == SURFACE) {
+    egadsSurface *psurf = (egadsSurface *) geom->blind;
+    return psurf->handle.operator->();
+  } else if (geom->oclass == FACE) {
+    egadsFace *pface = (egadsFace *) geom->blind;
+    return EG_geomKey(pface->surface);
+  }
+
+  return NULL;
+}
+
+
 int
 EG_evaluate(const egObject *geom, const double *param, 
                                         double *result)
@@ -2167,6 +2241,10 @@ EG_evaluate(const egObject *geom, const double *param,
     // 1D -- curves & Edges
     if (geom->oclass == CURVE) {
       egadsCurve *pcurve = (egadsCurve *) geom->blind;
+      if (pcurve->spline != NULL) {
+        EG_splineEval(pcurve->spline, 2, 1, param, result);
+        return EGADS_SUCCESS;
+      }
       Handle(Geom_Curve) hCurve = pcurve->handle;
       hCurve->D2(*param, P0, V1, V2);
     } else {
@@ -2187,6 +2265,10 @@ EG_evaluate(const egObject *geom, const double *param,
           printf(" EGADS Warning: No curve Data for Edge (EG_evaluate)!\n");
         return EGADS_NODATA;
       }
+      if (pcurve->spline != NULL) {
+        EG_splineEval(pcurve->spline, 2, 1, param, result);
+        return EGADS_SUCCESS;
+      }
       Handle(Geom_Curve) hCurve = pcurve->handle;
       hCurve->D2(*param, P0, V1, V2);
 #endif
@@ -2206,6 +2288,10 @@ EG_evaluate(const egObject *geom, const double *param,
     // 2D -- surfaces & Faces
     if (geom->oclass == SURFACE) {
       egadsSurface *psurf = (egadsSurface *) geom->blind;
+      if (psurf->spline != NULL) {
+        EG_splineEval(psurf->spline, 2, 1, param, result);
+        return EGADS_SUCCESS;
+      }
       Handle(Geom_Surface) hSurface = psurf->handle;
       hSurface->D2(param[0], param[1], P0, U1, V1, U2, V2, UV);
     } else {
@@ -2226,6 +2312,10 @@ EG_evaluate(const egObject *geom, const double *param,
           printf(" EGADS Warning: No Surf Data for Face (EG_evaluate)!\n");
         return EGADS_NODATA;
       }
+      if (psurf->spline != NULL) {
+        EG_splineEval(psurf->spline, 2, 1, param, result);
+        return EGADS_SUCCESS;
+      }
       Handle(Geom_Surface) hSurface = psurf->handle;
       hSurface->D2(param[0], param[1], P0, U1, V1, U2, V2, UV);
 #endif
@@ -2693,6 +2783,488 @@ EG_invEvaluate(const egObject *geom, double *xyz,
 }
 
 
+static void
+EG_evalCurve(Handle_Geom_Curve hCurve, int deriv, double t, double *result)
+{
+  gp_Pnt P0;
+  gp_Vec V1, V2;
+
+  if (deriv == 0) {
+    hCurve->D0(t, P0);
+  } else if (deriv == 1) {
+    hCurve->D1(t, P0, V1);
+  } else {
+    hCurve->D2(t, P0, V1, V2);
+  }
+  result[0] = P0.X();
+  result[1] = P0.Y();
+  result[2] = P0.Z();
+  if (deriv == 0) return;
+  result[3] = V1.X();
+  result[4] = V1.Y();
+  result[5] = V1.Z();
+  if (deriv == 1) return;
+  result[6] = V2.X();
+  result[7] = V2.Y();
+  result[8] = V2.Z();
+}
+
+
+static void
+EG_evalSurface(Handle_Geom_Surface hSurface, int deriv, const double *uv,
+               double *result)
+{
+  gp_Pnt P0;
+  gp_Vec V1, V2, U1, U2, UV;
+
+  if (deriv == 0) {
+    hSurface->D0(uv[0], uv[1], P0);
+  } else if (deriv == 1) {
+    hSurface->D1(uv[0], uv[1], P0, U1, V1);
+  } else {
+    hSurface->D2(uv[0], uv[1], P0, U1, V1, U2, V2, UV);
+  }
+  result[ 0] = P0.X();
+  result[ 1] = P0.Y();
+  result[ 2] = P0.Z();
+  if (deriv == 0) return;
+  result[ 3] = U1.X();
+  result[ 4] = U1.Y();
+  result[ 5] = U1.Z();
+  result[ 6] = V1.X();
+  result[ 7] = V1.Y();
+  result[ 8] = V1.Z();
+  if (deriv == 1) return;
+  result[ 9] = U2.X();
+  result[10] = U2.Y();
+  result[11] = U2.Z();
+  result[12] = UV.X();
+  result[13] = UV.Y();
+  result[14] = UV.Z();
+  result[15] = V2.X();
+  result[16] = V2.Y();
+  result[17] = V2.Z();
+}
+
+
+int
+EG_evaluateMany(const egObject *geom, int npts, int deriv, 
+                const double *params, double *results)
+{
+  int      i, outLevel;
+  egObject *obj;
+
+  if  (geom == NULL)               return EGADS_NULLOBJ;
+  if  (geom->magicnumber != MAGIC) return EGADS_NOTOBJ;
+  if ((geom->oclass != PCURVE) &&
+      (geom->oclass != CURVE)  && (geom->oclass != SURFACE) &&
+      (geom->oclass != EDGE)   && (geom->oclass != FACE))
+                                   return EGADS_NOTGEOM;
+  if (geom->blind == NULL)         return EGADS_NODATA;
+  outLevel = EG_outLevel(geom);
+  if ((npts < 0) || (deriv < 0) || (deriv > 2)) {
+    if (outLevel > 0)
+      printf(" EGADS Error: npts = %d, deriv = %d (EG_evaluateMany)!\n",
+             npts, deriv);
+    return EGADS_RANGERR;
+  }
+  if (npts == 0) return EGADS_SUCCESS;
+  
+  if (geom->oclass == PCURVE) {
+    gp_Pnt2d P2d;
+    gp_Vec2d V12d, V22d;
+
+    egadsPCurve *ppcurv = (egadsPCurve *) geom->blind;
+    Handle(Geom2d_Curve) hCurve = ppcurv->handle;
+    for (i = 0; i < npts; i++) {
+      double *result = &results[2*(deriv+1)*i];
+      if (deriv == 0) {
+        hCurve->D0(params[i], P2d);
+      } else if (deriv == 1) {
+        hCurve->D1(params[i], P2d, V12d);
+      } else {
+        hCurve->D2(params[i], P2d, V12d, V22d);
+      }
+      result[0] = P2d.X();
+      result[1] = P2d.Y();
+      if (deriv == 0) continue;
+      result[2] = V12d.X();
+      result[3] = V12d.Y();
+      if (deriv == 1) continue;
+      result[4] = V22d.X();
+      result[5] = V22d.Y();
+    }
+  
+  } else if ((geom->oclass == CURVE) || (geom->oclass == EDGE)) {
+  
+    // 1D -- curves & Edges (the handle is found once)
+    obj = (egObject *) geom;
+    if (geom->oclass == EDGE) {
+      egadsEdge *pedge = (egadsEdge *) geom->blind;
+      obj = pedge->curve;
+      if (obj == NULL) {
+        if (outLevel > 0)
+          printf(" EGADS Warning: No curve Object for Edge (EG_evaluateMany)!\n");
+        return EGADS_NULLOBJ;
+      }
+    }
+    egadsCurve *pcurve = (egadsCurve *) obj->blind;
+    if (pcurve == NULL) {
+      if (outLevel > 0)
+        printf(" EGADS Warning: No curve Data for Edge (EG_evaluateMany)!\n");
+      return EGADS_NODATA;
+    }
+    if (pcurve->spline != NULL) {
+      EG_splineEval(pcurve->spline, deriv, npts, params, results);
+      return EGADS_SUCCESS;
+    }
+    Handle(Geom_Curve) hCurve = pcurve->handle;
+    for (i = 0; i < npts; i++)
+      EG_evalCurve(hCurve, deriv, params[i], &results[3*(deriv+1)*i]);
+  
+  } else {
+  
+    // 2D -- surfaces & Faces (the handle is found once)
+    obj = (egObject *) geom;
+    if (geom->oclass == FACE) {
+      egadsFace *pface = (egadsFace *) geom->blind;
+      obj = pface->surface;
+      if (obj == NULL) {
+        if (outLevel > 0)
+          printf(" EGADS Warning: No Surf Object for Face (EG_evaluateMany)!\n");
+        return EGADS_NULLOBJ;
+      }
+    }
+    egadsSurface *psurf = (egadsSurface *) obj->blind;
+    if (psurf == NULL) {
+      if (outLevel > 0)
+        printf(" EGADS Warning: No Surf Data for Face (EG_evaluateMany)!\n");
+      return EGADS_NODATA;
+    }
+    if (psurf->spline != NULL) {
+      EG_splineEval(psurf->spline, deriv, npts, params, results);
+      return EGADS_SUCCESS;
+    }
+    Handle(Geom_Surface) hSurface = psurf->handle;
+    int stride = 3;
+    if (deriv == 1) stride =  9;
+    if (deriv == 2) stride = 18;
+    for (i = 0; i < npts; i++)
+      EG_evalSurface(hSurface, deriv, &params[2*i], &results[stride*i]);
+
+  }
+  
+  return EGADS_SUCCESS;
+}
+
+
+static void
+EG_periodicParam(double period, double lo, double hi, double *t)
+{
+  if ((*t+PARAMACC < lo) || (*t-PARAMACC > hi)) {
+    if (period != 0.0)
+      if (*t+PARAMACC < lo) {
+        if (*t+period-PARAMACC < hi) *t += period;
+      } else {
+        if (*t-period+PARAMACC > lo) *t -= period;
+      }
+  }
+}
+
+
+static int
+EG_warmCurve(Handle_Geom_Curve hCurve, const double *coor, 
+             double tmin, double tmax, double *t, double *xyz)
+{
+  int    i;
+  double a, b, dt, pw[3];
+  gp_Pnt pnt;
+  gp_Vec t1, t2;
+
+  // newton-raphson from the last answer -- accepted only if we land on
+  // the curve (a minimum off of it may not be the nearest point), otherwise
+  // the full projection is done
+  for (i = 0; i < 10; i++) {
+    if ((*t < tmin) || (*t > tmax)) return EGADS_OUTSIDE;
+    hCurve->D2(*t, pnt, t1, t2);
+    pw[0] = pnt.X() - coor[0];
+    pw[1] = pnt.Y() - coor[1];
+    pw[2] = pnt.Z() - coor[2];
+    if (sqrt(pw[0]*pw[0] + pw[1]*pw[1] + pw[2]*pw[2]) < 
+        Precision::Confusion()) break;
+    b     = -( pw[0]*t1.X() +  pw[1]*t1.Y() +  pw[2]*t1.Z());
+    a     =  (t1.X()*t1.X() + t1.Y()*t1.Y() + t1.Z()*t1.Z()) +
+             ( pw[0]*t2.X() +  pw[1]*t2.Y() +  pw[2]*t2.Z());
+    if (a <= 0.0) return EGADS_EMPTY;
+    dt    = b/a;
+    if (fabs(dt) <= WARMACC*(tmax-tmin)) return EGADS_EMPTY;
+    *t   += dt;
+  }
+  if (i == 10) return EGADS_EMPTY;
+
+  xyz[0] = pnt.X();
+  xyz[1] = pnt.Y();
+  xyz[2] = pnt.Z();
+  return EGADS_SUCCESS;
+}
+
+
+static int
+EG_warmSurface(Handle_Geom_Surface hSurface, const double *range,
+               const double *point, double *uv, double *coor)
+{
+  int    count;
+  gp_Pnt P0;
+  gp_Vec V1, V2, U1, U2, UV;
+  double a00, a10, a11, b0, b1, det, du, dv, dx[3];
+  
+  // newton iteration from the last answer -- accepted only if we land on
+  // the surface (a minimum off of it may not be the nearest point),
+  // otherwise the full projection is done
+  for (count = 0; count < 10; count++) {
+    if ((uv[0] < range[0]) || (uv[0] > range[1]) ||
+        (uv[1] < range[2]) || (uv[1] > range[3])) return EGADS_OUTSIDE;
+    hSurface->D2(uv[0], uv[1], P0, U1, V1, U2, V2, UV);
+    dx[0] = P0.X() - point[0];
+    dx[1] = P0.Y() - point[1];
+    dx[2] = P0.Z() - point[2];
+    if (sqrt(dx[0]*dx[0] + dx[1]*dx[1] + dx[2]*dx[2]) < 
+        Precision::Confusion()) break;
+
+    b0  = -dx[0]*U1.X() -  dx[1]*U1.Y() -  dx[2]*U1.Z();
+    b1  = -dx[0]*V1.X() -  dx[1]*V1.Y() -  dx[2]*V1.Z();
+    a00 = U1.X()*U1.X() + U1.Y()*U1.Y() + U1.Z()*U1.Z() +
+           dx[0]*U2.X() +  dx[1]*U2.Y() +  dx[2]*U2.Z();
+    a10 = U1.X()*V1.X() + U1.Y()*V1.Y() + U1.Z()*V1.Z() +
+           dx[0]*UV.X() +  dx[1]*UV.Y() +  dx[2]*UV.Z();
+    a11 = V1.X()*V1.X() + V1.Y()*V1.Y() + V1.Z()*V1.Z() +
+           dx[0]*V2.X() +  dx[1]*V2.Y() +  dx[2]*V2.Z();
+
+    det    = a00*a11 - a10*a10;
+    if ((a00 <= 0.0) || (det <= 0.0)) return EGADS_EMPTY;
+    det    = 1.0/det;
+    du     = det*(b0*a11 - b1*a10);
+    dv     = det*(b1*a00 - b0*a10);
+    if ((fabs(du) <= WARMACC*(range[1]-range[0])) &&
+        (fabs(dv) <= WARMACC*(range[3]-range[2]))) return EGADS_EMPTY;
+    uv[0] += du;
+    uv[1] += dv;
+  }
+  if (count == 10) return EGADS_EMPTY;
+
+  coor[0] = P0.X();
+  coor[1] = P0.Y();
+  coor[2] = P0.Z();
+  return EGADS_SUCCESS;
+}
+
+
+int
+EG_invEvaluateMany(const egObject *geom, int npts, double *xyzs, 
+                   double *params, double *results)
+{
+  int           i, outLevel, stat, warm;
+  Standard_Real t, uv[2], range[4], srange[4];
+  egObject      *obj;
+
+  if  (geom == NULL)               return EGADS_NULLOBJ;
+  if  (geom->magicnumber != MAGIC) return EGADS_NOTOBJ;
+  if ((geom->oclass != PCURVE) &&
+      (geom->oclass != CURVE)  && (geom->oclass != SURFACE) &&
+      (geom->oclass != EDGE)   && (geom->oclass != FACE))
+                                   return EGADS_NOTGEOM;
+  if (geom->blind == NULL)         return EGADS_NODATA;
+  outLevel = EG_outLevel(geom);
+  if (npts < 0) {
+    if (outLevel > 0)
+      printf(" EGADS Error: npts = %d (EG_invEvaluateMany)!\n", npts);
+    return EGADS_RANGERR;
+  }
+  
+  if (geom->oclass == PCURVE) {
+  
+    // 2D on PCurves -- the projector cannot be reused
+    for (i = 0; i < npts; i++) {
+      stat = EG_invEvaluate(geom, &xyzs[2*i], &params[i], &results[2*i]);
+      if (stat != EGADS_SUCCESS) return stat;
+    }
+    return EGADS_SUCCESS;
+  }
+  
+  if ((geom->oclass == CURVE) || (geom->oclass == EDGE)) {
+  
+    // 1D -- curves & Edges
+    obj = (egObject *) geom;
+    if (geom->oclass == EDGE) {
+      egadsEdge *pedge = (egadsEdge *) geom->blind;
+      obj = pedge->curve;
+      if (obj == NULL) {
+        if (outLevel > 0)
+          printf(" EGADS Warning: No curve Object for Edge (EG_invEvaluateMany)!\n");
+        return EGADS_NULLOBJ;
+      }
+    }
+    egadsCurve *pcurve = (egadsCurve *) obj->blind;
+    if (pcurve == NULL) {
+      if (outLevel > 0)
+        printf(" EGADS Warning: No curve Data for Edge (EG_invEvaluateMany)!\n");
+      return EGADS_NODATA;
+    }
+    Handle(Geom_Curve) hCurve = pcurve->handle;
+    srange[0] = hCurve->FirstParameter();
+    srange[1] = hCurve->LastParameter();
+    range[0]  = srange[0];
+    range[1]  = srange[1];
+    if (geom->oclass == EDGE) {
+      egadsEdge *pedge = (egadsEdge *) geom->blind;
+      BRep_Tool::Range(pedge->edge, range[0], range[1]);
+    }
+    double period = 0.0;
+    if (hCurve->IsPeriodic()) period = hCurve->Period();
+
+    // one projector for all of the points
+    GeomAPI_ProjectPointOnCurve projPnt;
+    projPnt.Init(hCurve, srange[0], srange[1]);
+
+    for (warm = i = 0; i < npts; i++) {
+      double *xyz    = &xyzs[3*i];
+      double *result = &results[3*i];
+      if (warm == 1) {
+        t = params[i-1];
+        if (EG_warmCurve(hCurve, xyz, range[0], range[1], &t, 
+                         result) == EGADS_SUCCESS) {
+          params[i] = t;
+          continue;
+        }
+      }
+      warm = 0;
+      gp_Pnt pnt(xyz[0], xyz[1], xyz[2]);
+      projPnt.Perform(pnt);
+      if (projPnt.NbPoints() == 0) {
+        stat = EG_invEvaluate(geom, xyz, &params[i], result);
+        if (stat != EGADS_SUCCESS) return stat;
+        warm = 1;
+        continue;
+      }
+      pnt = projPnt.NearestPoint();
+      t   = projPnt.LowerDistanceParameter();
+      if (period != 0.0) EG_periodicParam(period, range[0], range[1], &t);
+
+      /* clip it? */
+      if (geom->oclass == EDGE)
+        if ((t < range[0]) || (t > range[1])) {
+          if (t < range[0]) t = range[0];
+          if (t > range[1]) t = range[1];
+          hCurve->D0(t, pnt);
+        }
+
+      result[0] = pnt.X();
+      result[1] = pnt.Y();
+      result[2] = pnt.Z();
+      params[i] = t;
+      warm      = 1;
+    }
+
+  } else {
+  
+    // 2D -- surfaces & Faces
+    obj = (egObject *) geom;
+    if (geom->oclass == FACE) {
+      egadsFace *pface = (egadsFace *) geom->blind;
+      obj = pface->surface;
+      if (obj == NULL) {
+        if (outLevel > 0)
+          printf(" EGADS Warning: No Surf Object for Face (EG_invEvaluateMany)!\n");
+        return EGADS_NULLOBJ;
+      }
+    }
+    egadsSurface *psurf = (egadsSurface *) obj->blind;
+    if (psurf == NULL) {
+      if (outLevel > 0)
+        printf(" EGADS Warning: No Surf Data for Face (EG_invEvaluateMany)!\n");
+      return EGADS_NODATA;
+    }
+    Handle(Geom_Surface) hSurface = psurf->handle;
+    hSurface->Bounds(srange[0],srange[1], srange[2],srange[3]);
+    range[0] = srange[0];
+    range[1] = srange[1];
+    range[2] = srange[2];
+    range[3] = srange[3];
+    double uperiod = 0.0, vperiod = 0.0;
+    if (hSurface->IsUPeriodic()) uperiod = hSurface->UPeriod();
+    if (hSurface->IsVPeriodic()) vperiod = hSurface->VPeriod();
+
+    // one projector (and Face classifier) for all of the points
+    GeomAPI_ProjectPointOnSurf projPnt;
+    projPnt.Init(hSurface, srange[0], srange[1], srange[2], srange[3]);
+    TopOpeBRep_PointClassifier pClass;
+    Standard_Real tol = 0.0;
+    egadsFace *pface  = NULL;
+    if (geom->oclass == FACE) {
+      pface = (egadsFace *) geom->blind;
+      BRepTools::UVBounds(pface->face, range[0],range[1], 
+                                       range[2],range[3]);
+      tol = BRep_Tool::Tolerance(pface->face);
+      pClass.Load(pface->face);
+    }
+
+    for (warm = i = 0; i < npts; i++) {
+      double *xyz    = &xyzs[3*i];
+      double *result = &results[3*i];
+      if (warm == 1) {
+        uv[0] = params[2*i-2];
+        uv[1] = params[2*i-1];
+        if (EG_warmSurface(hSurface, range, xyz, uv, 
+                           result) == EGADS_SUCCESS) {
+          gp_Pnt2d pnt2d(uv[0], uv[1]);
+          if ((pface == NULL) ||
+              (pClass.Classify(pface->face, pnt2d, tol) != TopAbs_OUT)) {
+            params[2*i  ] = uv[0];
+            params[2*i+1] = uv[1];
+            continue;
+          }
+        }
+      }
+      warm = 0;
+      gp_Pnt pnt(xyz[0], xyz[1], xyz[2]);
+      projPnt.Perform(pnt);
+      if (!projPnt.IsDone() || (projPnt.NbPoints() == 0)) {
+        stat = EG_invEvaluate(geom, xyz, &params[2*i], result);
+        if (stat != EGADS_SUCCESS) return stat;
+        warm = 1;
+        continue;
+      }
+      pnt = projPnt.NearestPoint();
+      projPnt.LowerDistanceParameters(uv[0], uv[1]);
+      if (uperiod != 0.0)
+        EG_periodicParam(uperiod, range[0], range[1], &uv[0]);
+      if (vperiod != 0.0)
+        EG_periodicParam(vperiod, range[2], range[3], &uv[1]);
+      if (pface != NULL) {
+        gp_Pnt2d pnt2d(uv[0], uv[1]);
+        if (pClass.Classify(pface->face, pnt2d, tol) == TopAbs_OUT) {
+          /* outside the Face -- the clipping is done the usual way */
+          stat = EG_invEvaluate(geom, xyz, &params[2*i], result);
+          if (stat != EGADS_SUCCESS) return stat;
+          warm = 1;
+          continue;
+        }
+      }
+
+      result[0]     = pnt.X();
+      result[1]     = pnt.Y();
+      result[2]     = pnt.Z();
+      params[2*i  ] = uv[0];
+      params[2*i+1] = uv[1];
+      warm          = 1;
+    }
+
+  }
+  
+  return EGADS_SUCCESS;
+}
+
+
 int  
 EG_approximate(egObject *context, int maxdeg, double tol, const int *sizes, 
                const double *data, egObject **bspline)
@@ -2752,7 +3324,9 @@ EG_approximate(egObject *context, int maxdeg, double tol, const int *sizes,
     pcurve->handle     = hCurve;
     pcurve->basis      = NULL;
     pcurve->topFlg     = 0;
+    pcurve->spline     = NULL;
     obj->blind         = pcurve;
+    EG_nativeSpline(obj);
     EG_referenceObject(obj, context);
 
   } else {
@@ -2802,7 +3376,9 @@ EG_approximate(egObject *context, int maxdeg, double tol, const int *sizes,
     psurf->handle       = hSurf;
     psurf->basis        = NULL;
     psurf->topFlg       = 0;
+    psurf->spline       = NULL;
     obj->blind          = psurf;
+    EG_nativeSpline(obj);
     EG_referenceObject(obj, context);
 
   }
@@ -3049,6 +3625,7 @@ EG_convertToBSpline(egObject *object, egObject **bspline)
     pcurv->handle     = hBSpline;
     pcurv->basis      = NULL;
     pcurv->topFlg     = 0;
+    pcurv->spline     = NULL;
     obj->blind        = pcurv;
 
   } else {
@@ -3078,11 +3655,13 @@ EG_convertToBSpline(egObject *object, egObject **bspline)
     psurf->handle       = hBSpline;
     psurf->basis        = NULL;
     psurf->topFlg       = 0;
+    psurf->spline       = NULL;
     obj->blind          = psurf;
 
   }
   
   *bspline = obj;
+  EG_nativeSpline(obj);
   EG_referenceObject(obj, context);
     
   return EGADS_SUCCESS;
@@ -59,6 +59,7 @@
   extern     int  EG_traverseBody( egObject *context, int i, egObject *bobj, 
                                    egObject *topObj, egadsBody *body );
   extern     int  EG_attriBodyDup( const egObject *src, egObject *dst );
+  extern     int  EG_fillBody( const egObject *body );
   extern     void EG_completePCurve( egObject *g, Handle(Geom2d_Curve) &hCurv );
   extern     void EG_completeSurf(   egObject *g, Handle(Geom_Surface) &hSurf );
      
@@ -330,6 +331,9 @@ EG_modelBoolean(const egObject *src, const egObject *tool, int oper,
       printf(" EGADS Error: Context mismatch (EG_solidBoolean)!\n");
     return EGADS_MIXCNTX;
   }
+  // lazy Bodies -- the maps are walked below
+  EG_fillBody(src);
+  EG_fillBody(tool);
   egadsModel      *pmdl = (egadsModel *) src->blind;
   TopoDS_Compound ssrc  = TopoDS::Compound(pmdl->shape);
   
@@ -742,6 +746,9 @@ EG_solidBoolean(const egObject *src, const egObject *tool, int oper,
       printf(" EGADS Error: Context mismatch (EG_solidBoolean)!\n");
     return EGADS_MIXCNTX;
   }
+  // lazy Bodies -- the maps are walked below
+  EG_fillBody(src);
+  EG_fillBody(tool);
   if ((oper == SUBTRACTION) && ((tool->oclass == FACE) ||
       ((tool->oclass == BODY) && (tool->mtype == FACEBODY)))) {
     if (tool->oclass == FACE) {
@@ -1119,6 +1126,9 @@ EG_intersection(const egObject *src, const egObject *tool, int *nEdge,
       printf(" EGADS Error: Context mismatch (EG_intersection)!\n");
     return EGADS_MIXCNTX;
   }
+  // lazy Bodies -- the maps are walked below
+  EG_fillBody(src);
+  EG_fillBody(tool);
   const egObject *face;
   if (tool->oclass == BODY) {
     if (tool->mtype != FACEBODY) {
@@ -1490,6 +1500,7 @@ EG_imprintBody(const egObject *src, int nedge, const egObject **facEdg,
       return EGADS_NODATA;
     }
   }
+  EG_fillBody(src);
   egadsBody *pbody = (egadsBody *) src->blind;
   for (i = 0; i < nedge; i++) {
     if (facEdg[2*i  ]->oclass != FACE) {
@@ -1616,6 +1627,7 @@ EG_filletBody(const egObject *src, int nedge, const egObject **edges,
       printf(" EGADS Error: NULL Edge Pointer (EG_filletBody)!\n");
     return EGADS_NULLOBJ;
   }
+  EG_fillBody(src);
   egadsBody *pbody = (egadsBody *) src->blind;
   for (k = i = 0; i < nedge; i++) {
     if (edges[i] == NULL) {
@@ -1838,6 +1850,7 @@ EG_chamferBody(const egObject *src, int nedge, const egObject **edges,
       printf(" EGADS Error: NULL Face Pointer (EG_chamferBody)!\n");
     return EGADS_NULLOBJ;
   }
+  EG_fillBody(src);
   egadsBody *pbody = (egadsBody *) src->blind;
   for (k = i = 0; i < nedge; i++) {
 
@@ -2087,6 +2100,7 @@ EG_hollowBody(const egObject *src, int nface, const egObject **faces,
     return EGADS_NULLOBJ;
   }
   TopTools_ListOfShape aList;
+  EG_fillBody(src);
   egadsBody *pbody = (egadsBody *) src->blind;
   for (i = 0; i < nface; i++) {
     if (faces[i] == NULL) {
@@ -29,6 +29,52 @@
   extern     void EG_splitPeriodics( egadsBody *body );
   extern     int  EG_traverseBody( egObject *context, int i, egObject *bobj, 
                                    egObject *topObj, egadsBody *body );
+  extern     int  EG_traverseLazy( egObject *context, int i, egObject *bobj, 
+                                   egObject *topObj, egadsBody *body );
+  extern     int  EG_fillBodyObj( egObject *bobj, int oclass, int index );
+  extern     int  EG_fillBody( const egObject *body );
+
+
+// the index of shape in a Body map (1 bias, 0 - not there) -- related
+// Bodies usually keep the map ordering so the hinted index is tried first
+
+int
+EG_mapIndex(const egadsMap &emap, int hint, const TopoDS_Shape &shape)
+{
+  if ((hint > 0) && (hint <= emap.map.Extent()))
+    if (emap.map(hint).IsSame(shape)) return hint;
+  return emap.map.FindIndex(shape);
+}
+
+
+// the Body index of obj as a hint (0 - the ego was not made by a Body
+// and so its index was never set)
+
+static int
+EG_attriHint(const egObject *obj)
+{
+  if (obj->topObj == NULL) return 0;
+  if ((obj->topObj->oclass != BODY) && (obj->topObj->oclass != MODEL))
+    return 0;
+
+  if (obj->oclass == NODE) {
+    egadsNode *pnode = (egadsNode *) obj->blind;
+    return pnode->bIndex;
+  } else if (obj->oclass == EDGE) {
+    egadsEdge *pedge = (egadsEdge *) obj->blind;
+    return pedge->bIndex;
+  } else if (obj->oclass == LOOP) {
+    egadsLoop *ploop = (egadsLoop *) obj->blind;
+    return ploop->bIndex;
+  } else if (obj->oclass == FACE) {
+    egadsFace *pface = (egadsFace *) obj->blind;
+    return pface->bIndex;
+  } else if (obj->oclass == SHELL) {
+    egadsShell *pshell = (egadsShell *) obj->blind;
+    return pshell->bIndex;
+  }
+  return 0;
+}
 
 
 static void
@@ -39,14 +85,14 @@ EG_attriBodyTrav(const egObject *obj, egadsBody *pbody)
   if (obj->oclass == NODE) {
   
     egadsNode *pnode = (egadsNode *) obj->blind;
-    int index = pbody->nodes.map.FindIndex(pnode->node);
+    int index = EG_mapIndex(pbody->nodes, EG_attriHint(obj), pnode->node);
     if (index == 0) return;
     EG_attributeDup(obj, pbody->nodes.objs[index-1]);
   
   } else if (obj->oclass == EDGE) {
   
     egadsEdge *pedge = (egadsEdge *) obj->blind;
-    int index = pbody->edges.map.FindIndex(pedge->edge);
+    int index = EG_mapIndex(pbody->edges, EG_attriHint(obj), pedge->edge);
     if (index != 0)
       EG_attributeDup(obj, pbody->edges.objs[index-1]);
     EG_attriBodyTrav(pedge->nodes[0], pbody);
@@ -55,7 +101,7 @@ EG_attriBodyTrav(const egObject *obj, egadsBody *pbody)
   } else if (obj->oclass == LOOP) {
   
     egadsLoop *ploop = (egadsLoop *) obj->blind;
-    int index = pbody->loops.map.FindIndex(ploop->loop);
+    int index = EG_mapIndex(pbody->loops, EG_attriHint(obj), ploop->loop);
     if (index != 0)
       EG_attributeDup(obj, pbody->loops.objs[index-1]);
     for (int i = 0; i < ploop->nedges; i++)
@@ -64,7 +110,7 @@ EG_attriBodyTrav(const egObject *obj, egadsBody *pbody)
   } else if (obj->oclass == FACE) {
   
     egadsFace *pface = (egadsFace *) obj->blind;
-    int index = pbody->faces.map.FindIndex(pface->face);
+    int index = EG_mapIndex(pbody->faces, EG_attriHint(obj), pface->face);
     if (index != 0)
       EG_attributeDup(obj, pbody->faces.objs[index-1]);
     for (int i = 0; i < pface->nloops; i++)
@@ -73,7 +119,7 @@ EG_attriBodyTrav(const egObject *obj, egadsBody *pbody)
   } else if (obj->oclass == SHELL) {
   
     egadsShell *pshell = (egadsShell *) obj->blind;
-    int index = pbody->shells.map.FindIndex(pshell->shell);
+    int index = EG_mapIndex(pbody->shells, EG_attriHint(obj), pshell->shell);
     if (index != 0)
       EG_attributeDup(obj, pbody->shells.objs[index-1]);
     for (int i = 0; i < pshell->nfaces; i++)
@@ -83,12 +129,51 @@ EG_attriBodyTrav(const egObject *obj, egadsBody *pbody)
 }
 
 
+// copies the attributes of one class of Body objects -- the index table
+// from EG_copyTopology is used when given, otherwise only the source
+// objects with attributes are looked up in the destination (through the
+// transform when the destination is a transformed copy)
+
+static void
+EG_attriMapCopy(egadsMap &smap, egadsMap &dmap, /*@null@*/ const int *imap,
+                /*@null@*/ BRepBuilderAPI_Transform *xForm)
+{
+  int          i, j, nents;
+  egObject     *aobj;
+  egAttrs      *attrs;
+  TopoDS_Shape shape;
+
+  nents = smap.map.Extent();
+  for (i = 0; i < nents; i++) {
+    aobj = smap.objs[i];
+    if (aobj        == NULL) continue;    // not filled (lazy)
+    if (aobj->attrs == NULL) continue;
+    attrs = (egAttrs *) aobj->attrs;
+    if (attrs->nattrs <= 0) continue;
+    if (imap != NULL) {
+      j = imap[i];
+      if (j == 0) continue;
+      EG_attributeDup(aobj, dmap.objs[j-1]);
+      continue;
+    }
+    shape = smap.map(i+1);
+    if (xForm != NULL)
+      try {
+        shape = xForm->ModifiedShape(shape);
+      }
+      catch (...) {
+        continue;
+      }
+    j = EG_mapIndex(dmap, i+1, shape);
+    if (j == 0) continue;                 // not in the dst body
+    EG_attributeDup(aobj, dmap.objs[j-1]);
+  }
+}
+
+
 int
 EG_attriBodyDup(const egObject *src, egObject *dst)
 {
-  int          i, j, nents, nattr;
-  egObject     *aobj, *dobj;
-  egAttrs      *attrs;
   TopoDS_Shape shape;
   
   if ((src == NULL) || (dst == NULL)) return EGADS_NULLOBJ;
@@ -123,6 +208,7 @@ EG_attriBodyDup(const egObject *src, egObject *dst)
     return EGADS_NODATA;
   }
   egadsBody *pbody = (egadsBody *) dst->blind;
+  EG_fillBody(dst);
   
   if (src->oclass == BODY) {
   
@@ -131,75 +217,11 @@ EG_attriBodyDup(const egObject *src, egObject *dst)
     shape = pbody->shape;
     if (shape.IsSame(pbods->shape)) EG_attributeDup(src, dst);
     
-    nents = pbods->shells.map.Extent();
-    for (i = 0; i < nents; i++) {
-      aobj = pbods->shells.objs[i];
-      if (aobj->attrs == NULL) continue;
-      attrs = (egAttrs *) aobj->attrs;
-      nattr = attrs->nattrs;
-      if (nattr <= 0) continue;
-      shape = pbods->shells.map(i+1);
-      j     = pbody->shells.map.FindIndex(shape);
-      if (j == 0) continue;                     // not in the dst body
-      dobj = pbody->shells.objs[j-1];
-      EG_attributeDup(aobj, dobj);
-    }
-
-    nents = pbods->faces.map.Extent();
-    for (i = 0; i < nents; i++) {
-      aobj = pbods->faces.objs[i];
-      if (aobj->attrs == NULL) continue;
-      attrs = (egAttrs *) aobj->attrs;
-      nattr = attrs->nattrs;
-      if (nattr <= 0) continue;
-      shape = pbods->faces.map(i+1);
-      j     = pbody->faces.map.FindIndex(shape);
-      if (j == 0) continue;                     // not in the dst body
-      dobj = pbody->faces.objs[j-1];
-      EG_attributeDup(aobj, dobj);
-    }
-    
-    nents = pbods->loops.map.Extent();
-    for (i = 0; i < nents; i++) {
-      aobj = pbods->loops.objs[i];
-      if (aobj->attrs == NULL) continue;
-      attrs = (egAttrs *) aobj->attrs;
-      nattr = attrs->nattrs;
-      if (nattr <= 0) continue;
-      shape = pbods->loops.map(i+1);
-      j     = pbody->loops.map.FindIndex(shape);
-      if (j == 0) continue;                     // not in the dst body
-      dobj = pbody->loops.objs[j-1];
-      EG_attributeDup(aobj, dobj);
-    }
-
-    nents = pbods->edges.map.Extent();
-    for (i = 0; i < nents; i++) {
-      aobj = pbods->edges.objs[i];
-      if (aobj->attrs == NULL) continue;
-      attrs = (egAttrs *) aobj->attrs;
-      nattr = attrs->nattrs;
-      if (nattr <= 0) continue;
-      shape = pbods->edges.map(i+1);
-      j     = pbody->edges.map.FindIndex(shape);
-      if (j == 0) continue;                     // not in the dst body
-      dobj = pbody->edges.objs[j-1];
-      EG_attributeDup(aobj, dobj);
-    }
-  
-    nents = pbods->nodes.map.Extent();
-    for (i = 0; i < nents; i++) {
-      aobj = pbods->nodes.objs[i];
-      if (aobj->attrs == NULL) continue;
-      attrs = (egAttrs *) aobj->attrs;
-      nattr = attrs->nattrs;
-      if (nattr <= 0) continue;
-      shape = pbods->nodes.map(i+1);
-      j     = pbody->nodes.map.FindIndex(shape);
-      if (j == 0) continue;                     // not in the dst body
-      dobj = pbody->nodes.objs[j-1];
-      EG_attributeDup(aobj, dobj);
-    }
+    EG_attriMapCopy(pbods->shells, pbody->shells, NULL, NULL);
+    EG_attriMapCopy(pbods->faces,  pbody->faces,  NULL, NULL);
+    EG_attriMapCopy(pbods->loops,  pbody->loops,  NULL, NULL);
+    EG_attriMapCopy(pbods->edges,  pbody->edges,  NULL, NULL);
+    EG_attriMapCopy(pbods->nodes,  pbody->nodes,  NULL, NULL);
 
   } else {
   
@@ -213,11 +235,9 @@ EG_attriBodyDup(const egObject *src, egObject *dst)
 
 
 int
-EG_attriBodyCopy(const egObject *src, egObject *dst)
+EG_attriBodyCopy(const egObject *src, egObject *dst, /*@null@*/ int **imaps,
+                 /*@null@*/ BRepBuilderAPI_Transform *xForm)
 {
-  int      i, nents, nattr;
-  egObject *aobj, *dobj;
-  egAttrs  *attrs;
   
   if ((src == NULL) || (dst == NULL)) return EGADS_NULLOBJ;
   if  (src->magicnumber != MAGIC)     return EGADS_NOTOBJ;
@@ -261,63 +281,27 @@ EG_attriBodyCopy(const egObject *src, egObject *dst)
     return EGADS_NODATA;
   }
   EG_attributeDup(src, dst);
+  EG_fillBody(dst);
   egadsBody *pbods = (egadsBody *) src->blind;
   egadsBody *pbody = (egadsBody *) dst->blind;
   
-  nents = pbods->shells.map.Extent();
-  for (i = 0; i < nents; i++) {
-    aobj = pbods->shells.objs[i];
-    if (aobj->attrs == NULL) continue;
-    attrs = (egAttrs *) aobj->attrs;
-    nattr = attrs->nattrs;
-    if (nattr <= 0) continue;
-    dobj = pbody->shells.objs[i];
-    EG_attributeDup(aobj, dobj);
-  }
-
-  nents = pbods->faces.map.Extent();
-  for (i = 0; i < nents; i++) {
-    aobj = pbods->faces.objs[i];
-    if (aobj->attrs == NULL) continue;
-    attrs = (egAttrs *) aobj->attrs;
-    nattr = attrs->nattrs;
-    if (nattr <= 0) continue;
-    dobj = pbody->faces.objs[i];
-    EG_attributeDup(aobj, dobj);
-  }
-    
-  nents = pbods->loops.map.Extent();
-  for (i = 0; i < nents; i++) {
-    aobj = pbods->loops.objs[i];
-    if (aobj->attrs == NULL) continue;
-    attrs = (egAttrs *) aobj->attrs;
-    nattr = attrs->nattrs;
-    if (nattr <= 0) continue;
-    dobj = pbody->loops.objs[i];
-    EG_attributeDup(aobj, dobj);
+  if (imaps != NULL) {
+    EG_attriMapCopy(pbods->shells, pbody->shells, imaps[4], NULL);
+    EG_attriMapCopy(pbods->faces,  pbody->faces,  imaps[3], NULL);
+    EG_attriMapCopy(pbods->loops,  pbody->loops,  imaps[2], NULL);
+    EG_attriMapCopy(pbods->edges,  pbody->edges,  imaps[1], NULL);
+    EG_attriMapCopy(pbods->nodes,  pbody->nodes,  imaps[0], NULL);
+    return EGADS_SUCCESS;
   }
 
-  nents = pbods->edges.map.Extent();
-  for (i = 0; i < nents; i++) {
-    aobj = pbods->edges.objs[i];
-    if (aobj->attrs == NULL) continue;
-    attrs = (egAttrs *) aobj->attrs;
-    nattr = attrs->nattrs;
-    if (nattr <= 0) continue;
-    dobj = pbody->edges.objs[i];
-    EG_attributeDup(aobj, dobj);
-  }
+  // the same shape -- the Body maps match with no transform lookups
+  if (pbody->shape.IsSame(pbods->shape)) xForm = NULL;
   
-  nents = pbods->nodes.map.Extent();
-  for (i = 0; i < nents; i++) {
-    aobj = pbods->nodes.objs[i];
-    if (aobj->attrs == NULL) continue;
-    attrs = (egAttrs *) aobj->attrs;
-    nattr = attrs->nattrs;
-    if (nattr <= 0) continue;
-    dobj = pbody->nodes.objs[i];
-    EG_attributeDup(aobj, dobj);
-  }
+  EG_attriMapCopy(pbods->shells, pbody->shells, NULL, xForm);
+  EG_attriMapCopy(pbods->faces,  pbody->faces,  NULL, xForm);
+  EG_attriMapCopy(pbods->loops,  pbody->loops,  NULL, xForm);
+  EG_attriMapCopy(pbods->edges,  pbody->edges,  NULL, xForm);
+  EG_attriMapCopy(pbods->nodes,  pbody->nodes,  NULL, xForm);
   
   return EGADS_SUCCESS;
 }
@@ -432,7 +416,10 @@ EG_readAttrs(egObject *obj, int nattr, FILE *fp)
   if (attrs != NULL) {
     attrs->nattrs = n;
     attrs->attrs  = attr;
+    attrs->nhash  = 0;
+    attrs->hash   = NULL;
     obj->attrs    = attrs;
+    EG_attributeIndex(obj);
   }
 }
 
@@ -682,7 +669,11 @@ EG_loadModel(egObject *context, int bflg, const char *name,
     egadsBody *pbody = (egadsBody *) pobj->blind;
     pobj->topObj     = omodel;
     if (((bflg&1) == 0) && (egads == 0)) EG_splitPeriodics(pbody);
-    stat = EG_traverseBody(context, i, pobj, omodel, pbody);
+    if ((bflg&2) == 0) {
+      stat = EG_traverseBody(context, i, pobj, omodel, pbody);
+    } else {
+      stat = EG_traverseLazy(context, i, pobj, omodel, pbody);
+    }
     if (stat != EGADS_SUCCESS) {
       mshape->nbody = i;
       EG_destroyTopology(omodel);
@@ -753,14 +744,19 @@ EG_loadModel(egObject *context, int bflg, const char *name,
         if (j     != 3) break;
         if (otype == 0) break;
         if (otype == 1) {
+          EG_fillBodyObj(pobj, SHELL, oindex);
           aobj = pbody->shells.objs[oindex];
         } else if (otype == 2) {
+          EG_fillBodyObj(pobj, FACE,  oindex);
           aobj = pbody->faces.objs[oindex];
         } else if (otype == 3) {
+          EG_fillBodyObj(pobj, LOOP,  oindex);
           aobj = pbody->loops.objs[oindex];
         } else if (otype == 4) {
+          EG_fillBodyObj(pobj, EDGE,  oindex);
           aobj = pbody->edges.objs[oindex];
         } else {
+          EG_fillBodyObj(pobj, NODE,  oindex);
           aobj = pbody->nodes.objs[oindex];
         }
         EG_readAttrs(aobj, nattr, fp);
@@ -843,6 +839,7 @@ EG_writeAttrs(const egObject *obj, FILE *fp)
     
     for (i = 0; i < nshell; i++) {
       egObject *aobj = pbody->shells.objs[i];
+      if (aobj        == NULL) continue;    // not filled (lazy)
       if (aobj->attrs == NULL) continue;
       attrs = (egAttrs *) aobj->attrs;
       nattr = attrs->nattrs;
@@ -853,6 +850,7 @@ EG_writeAttrs(const egObject *obj, FILE *fp)
 
     for (i = 0; i < nface; i++) {
       egObject *aobj = pbody->faces.objs[i];
+      if (aobj        == NULL) continue;    // not filled (lazy)
       if (aobj->attrs == NULL) continue;
       attrs = (egAttrs *) aobj->attrs;
       nattr = attrs->nattrs;
@@ -863,6 +861,7 @@ EG_writeAttrs(const egObject *obj, FILE *fp)
     
     for (i = 0; i < nloop; i++) {
       egObject *aobj = pbody->loops.objs[i];
+      if (aobj        == NULL) continue;    // not filled (lazy)
       if (aobj->attrs == NULL) continue;
       attrs = (egAttrs *) aobj->attrs;
       nattr = attrs->nattrs;
@@ -873,6 +872,7 @@ EG_writeAttrs(const egObject *obj, FILE *fp)
         
     for (i = 0; i < nedge; i++) {
       egObject *aobj = pbody->edges.objs[i];
+      if (aobj        == NULL) continue;    // not filled (lazy)
       if (aobj->attrs == NULL) continue;
       attrs = (egAttrs *) aobj->attrs;
       nattr = attrs->nattrs;
@@ -883,6 +883,7 @@ EG_writeAttrs(const egObject *obj, FILE *fp)
         
     for (int i = 0; i < nnode; i++) {
       egObject *aobj = pbody->nodes.objs[i];
+      if (aobj        == NULL) continue;    // not filled (lazy)
       if (aobj->attrs == NULL) continue;
       attrs = (egAttrs *) aobj->attrs;
       nattr = attrs->nattrs;
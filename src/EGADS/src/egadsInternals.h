@@ -34,6 +34,24 @@ __ProtoExt__ /*@null@*/ /*@only@*/
 __ProtoExt__ void EG_free( /*@null@*/ /*@only@*/ void *pointer );
 __ProtoExt__ /*@null@*/ /*@only@*/ 
              char *EG_strdup( /*@null@*/ const char *str );
+__ProtoExt__ void EG_slabInit( egCntxt *cntx );
+__ProtoExt__ /*@null@*/ /*@only@*/
+             void *EG_slabAlloc( egObject *context, int nbytes );
+__ProtoExt__ void EG_slabFree( /*@null@*/ /*@only@*/ void *ptr );
+__ProtoExt__ void EG_slabClose( egCntxt *cntx );
+__ProtoExt__ void EG_statsInit( egCntxt *cntx );
+__ProtoExt__ void EG_statsClose( egCntxt *cntx );
+__ProtoExt__ void EG_statsObject( egCntxt *cntx, int oclass, int mtype,
+                                  int delta );
+__ProtoExt__ void EG_statsTess( egObject *tess, int remove );
+__ProtoExt__ int  EG_allocTess1D( egTess1D *tess1d, int npts );
+__ProtoExt__ void EG_freeTess1D( egTess1D *tess1d );
+__ProtoExt__ int  EG_allocTess2D( egTess2D *tess2d, int npts, int ntris );
+__ProtoExt__ void EG_freeTess2D( egTess2D *tess2d );
+__ProtoExt__ void EG_freeTessGlobal( egTessel *btess );
+__ProtoExt__ void EG_freeTessFloat( egTessel *btess );
+__ProtoExt__ int  EG_ownTess( egTessel *btess );
+__ProtoExt__ void EG_unmapTess( egTessel *btess );
 
 __ProtoExt__ /*@kept@*/ /*@null@*/ egObject *
                   EG_context( const egObject *object );
@@ -53,6 +71,17 @@ __ProtoExt__ int  EG_removeCntxtRef( egObject *object );
 __ProtoExt__ int  EG_attributeDel( egObject *obj, /*@null@*/ const char *name );
 __ProtoExt__ int  EG_attributeDup( const egObject *src, egObject *dst );
 __ProtoExt__ int  EG_attributePrint( const egObject *src );
+__ProtoExt__ void EG_attributeIndex( egObject *obj );
+__ProtoExt__ void EG_attrAtomFree( egCntxt *cntx );
+
+__ProtoExt__ int  EG_numProcs( );
+__ProtoExt__ /*@null@*/ /*@only@*/
+             void *EG_mutexCreate( );
+__ProtoExt__ void EG_mutexLock( /*@null@*/ void *mutex );
+__ProtoExt__ void EG_mutexUnlock( /*@null@*/ void *mutex );
+__ProtoExt__ void EG_mutexDestroy( /*@null@*/ /*@only@*/ void *mutex );
+__ProtoExt__ int  EG_runThreads( int nthread, void (*entry)(void *),
+                                 void *arg );
 
 #ifdef __cplusplus
 }
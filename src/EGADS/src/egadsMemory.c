@@ -14,6 +14,7 @@
 #include <string.h>
 
 #include "egadsTypes.h"
+#include "egadsInternals.h"
 
 
 /*@null@*/ /*@out@*/ /*@only@*/ void *
@@ -64,3 +65,404 @@ EG_strdup(/*@null@*/ const char *str)
   return dup;
 }
 
+
+
+/* slab allocation of fixed size entries -- used for the egObjects and the
+ *   topology blind data. Each entry is preceded by a header that points
+ *   to its slab so it can be returned without the Context. The blocks are
+ *   all released together at EG_close. */
+
+#ifndef SLABLEN
+#define SLABLEN   256           /* entries per slab block */
+#endif
+#define SLABHEAD  16            /* entry & block headers (keeps alignment) */
+#define MAXSLAB   8             /* entry sizes handled by slabs */
+#define SLABSIZE(n) (SLABHEAD + (((int) (n)+SLABHEAD-1)/SLABHEAD)*SLABHEAD)
+
+typedef struct {
+  int  size;                    /* entry size (including the header) */
+  int  nblock;                  /* number of blocks allocated */
+  int  inUse;                   /* entries handed out */
+  int  hiWater;                 /* the largest inUse */
+  char *free;                   /* returned entries (threaded) */
+  char *fill;                   /* the untouched part of the last block */
+  char *end;
+  char *blocks;                 /* blocks threaded through the header */
+  void *mutex;                  /* the Context's lock */
+} egSlab;
+
+
+/* find (or start) the slab for an entry size */
+
+static /*@null@*/ egSlab *
+EG_slabFind(egCntxt *cntx, int size)
+{
+  int    i;
+  egSlab *slab;
+
+  slab = (egSlab *) cntx->slabs;
+  if (slab == NULL) return NULL;
+  for (i = 0; i < cntx->nSlab; i++)
+    if (slab[i].size == size) return &slab[i];
+  if (i == MAXSLAB) return NULL;
+
+  slab[i].size    = size;
+  slab[i].nblock  = 0;
+  slab[i].inUse   = 0;
+  slab[i].hiWater = 0;
+  slab[i].free    = NULL;
+  slab[i].fill    = NULL;
+  slab[i].end     = NULL;
+  slab[i].blocks  = NULL;
+  slab[i].mutex   = cntx->mutex;
+  cntx->nSlab++;
+  return &slab[i];
+}
+
+
+void
+EG_slabInit(egCntxt *cntx)
+{
+  cntx->nSlab = 0;
+  cntx->slabs = EG_alloc(MAXSLAB*sizeof(egSlab));
+  /* the objects are always the first */
+  EG_slabFind(cntx, SLABSIZE(sizeof(egObject)));
+}
+
+
+/*@null@*/ void *
+EG_slabAlloc(egObject *context, int nbytes)
+{
+  char    *entry, *block;
+  egCntxt *cntx;
+  egSlab  *slab;
+
+  if (context == NULL) return NULL;
+  cntx = (egCntxt *) context->blind;
+  if (cntx == NULL)    return NULL;
+
+  EG_mutexLock(cntx->mutex);
+  slab = EG_slabFind(cntx, SLABSIZE(nbytes));
+
+  /* too many sizes -- a single allocation with no owner */
+  if (slab == NULL) {
+    EG_mutexUnlock(cntx->mutex);
+    entry = (char *) EG_alloc(SLABHEAD+nbytes);
+    if (entry == NULL) return NULL;
+    *((egSlab **) entry) = NULL;
+    return entry + SLABHEAD;
+  }
+
+  if (slab->free != NULL) {
+    entry      = slab->free;
+    slab->free = *((char **) (entry+SLABHEAD));
+  } else {
+    if (slab->fill == slab->end) {
+      block = (char *) EG_alloc(SLABHEAD + SLABLEN*slab->size);
+      if (block == NULL) {
+        EG_mutexUnlock(cntx->mutex);
+        return NULL;
+      }
+      *((char **) block) = slab->blocks;
+      slab->blocks = block;
+      slab->fill   = block + SLABHEAD;
+      slab->end    = slab->fill + SLABLEN*slab->size;
+      slab->nblock++;
+    }
+    entry       = slab->fill;
+    slab->fill += slab->size;
+  }
+  *((egSlab **) entry) = slab;
+  slab->inUse++;
+  if (slab->inUse > slab->hiWater) slab->hiWater = slab->inUse;
+  EG_mutexUnlock(cntx->mutex);
+
+  return entry + SLABHEAD;
+}
+
+
+void
+EG_slabFree(/*@null@*/ void *ptr)
+{
+  char   *entry;
+  egSlab *slab;
+
+  if (ptr == NULL) return;
+  entry = (char *) ptr - SLABHEAD;
+  slab  = *((egSlab **) entry);
+  if (slab == NULL) {
+    EG_free(entry);
+    return;
+  }
+  EG_mutexLock(slab->mutex);
+  *((char **) ptr) = slab->free;
+  slab->free       = entry;
+  slab->inUse--;
+  EG_mutexUnlock(slab->mutex);
+}
+
+
+void
+EG_slabClose(egCntxt *cntx)
+{
+  int    i;
+  char   *block, *next;
+  egSlab *slab;
+
+  slab = (egSlab *) cntx->slabs;
+  if (slab == NULL) return;
+  for (i = 0; i < cntx->nSlab; i++) {
+    block = slab[i].blocks;
+    while (block != NULL) {
+      next = *((char **) block);
+      EG_free(block);
+      block = next;
+    }
+  }
+  EG_free(slab);
+  cntx->nSlab = 0;
+  cntx->slabs = NULL;
+}
+
+
+int
+EG_getSlabInfo(const egObject *context, int index, int *size, int *nblock,
+               int *inUse, int *hiWater)
+{
+  egCntxt *cntx;
+  egSlab  *slab;
+
+  *size = *nblock = *inUse = *hiWater = 0;
+  if (context == NULL)               return EGADS_NULLOBJ;
+  if (context->magicnumber != MAGIC) return EGADS_NOTOBJ;
+  if (context->oclass != CONTXT)     return EGADS_NOTCNTX;
+  cntx = (egCntxt *) context->blind;
+  if (cntx == NULL)                  return EGADS_NODATA;
+  if ((index < 0) || (index >= cntx->nSlab)) return EGADS_INDEXERR;
+
+  EG_mutexLock(cntx->mutex);
+  slab     = &((egSlab *) cntx->slabs)[index];
+  *size    = slab->size - SLABHEAD;
+  *nblock  = slab->nblock;
+  *inUse   = slab->inUse;
+  *hiWater = slab->hiWater;
+  EG_mutexUnlock(cntx->mutex);
+  return EGADS_SUCCESS;
+}
+
+
+
+/* object & memory statistics -- kept up to date as objects are handed out,
+ *   referenced and pooled (and as tessellations change) so that they can
+ *   be read at any time without walking the object list. An object is
+ *   counted in its class once it is first referenced. */
+
+#define STATCLASS (MODEL+1)     /* CONTXT through MODEL */
+#define STATTYPE  14            /* mtype+1 for SREVERSE - EXTRUSION, all */
+#define STATALL   (STATTYPE-1)
+
+typedef struct {
+  int    count[STATCLASS][STATTYPE];
+  int    hiCount[STATCLASS][STATTYPE];
+  size_t tess;                  /* bytes in the tessellation arrays */
+  size_t hiTess;
+  size_t total;                 /* bytes in the objects & tessellations */
+  size_t hiTotal;
+} egStats;
+
+
+void
+EG_statsInit(egCntxt *cntx)
+{
+  int     i, j;
+  egStats *stats;
+
+  stats = (egStats *) EG_alloc(sizeof(egStats));
+  if (stats != NULL) {
+    for (i = 0; i < STATCLASS; i++)
+      for (j = 0; j < STATTYPE; j++)
+        stats->count[i][j] = stats->hiCount[i][j] = 0;
+    stats->tess  = stats->hiTess  = 0;
+    stats->total = stats->hiTotal = 0;
+  }
+  cntx->stats = stats;
+}
+
+
+void
+EG_statsClose(egCntxt *cntx)
+{
+  EG_free(cntx->stats);
+  cntx->stats = NULL;
+}
+
+
+static void
+EG_statsBump(egStats *stats, int oclass, int slot, int delta)
+{
+  stats->count[oclass][slot] += delta;
+  if (stats->count[oclass][slot] > stats->hiCount[oclass][slot])
+    stats->hiCount[oclass][slot] = stats->count[oclass][slot];
+}
+
+
+/* the Context mutex must be held
+ *   CONTXT    -- objects handed out by EG_makeObject
+ *   EMPTY     -- objects in the pool
+ *   REFERENCE -- references held */
+
+void
+EG_statsObject(egCntxt *cntx, int oclass, int mtype, int delta)
+{
+  egStats *stats;
+
+  stats = (egStats *) cntx->stats;
+  if (stats == NULL) return;
+  if ((oclass < CONTXT) || (oclass > MODEL)) return;
+
+  EG_statsBump(stats, oclass, STATALL, delta);
+  if ((mtype >= SREVERSE) && (mtype < STATALL-1))
+    EG_statsBump(stats, oclass, mtype+1, delta);
+  if (oclass == CONTXT) {
+    stats->total += delta*sizeof(egObject);
+    if (stats->total > stats->hiTotal) stats->hiTotal = stats->total;
+  }
+}
+
+
+static size_t
+EG_tessBytes(const egTessel *btess)
+{
+  int    i, j, k;
+  size_t n;
+
+  n = sizeof(egTessel);
+  if (btess->xyzs != NULL) {
+    i  = btess->nu;
+    if (btess->nv > 0) i *= btess->nv;
+    n += 3*i*sizeof(double);
+  }
+  if (btess->tess1d != NULL) {
+    n += btess->nEdge*sizeof(egTess1D);
+    for (i = 0; i < btess->nEdge; i++) {
+      n += btess->tess1d[i].npts*4*sizeof(double);
+      for (k = 0; k < 2; k++) {
+        if (btess->tess1d[i].faces[k].faces != NULL)
+          n += btess->tess1d[i].faces[k].nface*sizeof(int);
+        if (btess->tess1d[i].faces[k].tric  != NULL) {
+          j  = btess->tess1d[i].faces[k].nface;
+          if (j < 1) j = 1;
+          n += j*(btess->tess1d[i].npts-1)*sizeof(int);
+        }
+      }
+    }
+  }
+  if (btess->tess2d != NULL) {
+    n += 2*btess->nFace*sizeof(egTess2D);
+    for (i = 0; i < 2*btess->nFace; i++) {
+      n += btess->tess2d[i].npts *(5*sizeof(double) + 2*sizeof(int));
+      n += btess->tess2d[i].ntris*6*sizeof(int);
+      if (btess->tess2d[i].patch == NULL) continue;
+      n += btess->tess2d[i].npatch*sizeof(egPatch);
+      for (j = 0; j < btess->tess2d[i].npatch; j++)
+        n += (btess->tess2d[i].patch[j].nu*btess->tess2d[i].patch[j].nv +
+              2*btess->tess2d[i].patch[j].nu +
+              2*btess->tess2d[i].patch[j].nv)*sizeof(int);
+    }
+  }
+  if (btess->global != NULL) {
+    i  = btess->global->foff[btess->nFace];
+    n += sizeof(egTessGlobal) + btess->global->nvert*3*sizeof(double);
+    n += (3*i + 3*btess->global->ntri + 2*btess->nFace+2)*sizeof(int);
+  }
+  if (btess->single != NULL) {
+    j  = btess->nFace;
+    if (btess->tess2d == NULL) j = 0;
+    i  = btess->single->off[j+btess->nEdge];
+    n += sizeof(egTessFloat) + (4*i + btess->single->off[j])*sizeof(float);
+    n += (j+btess->nEdge+1)*sizeof(int);
+  }
+  return n;
+}
+
+
+/* recount a tessellation after it changes (remove -- it is going away) */
+
+void
+EG_statsTess(egObject *tess, int remove)
+{
+  size_t   n;
+  egObject *context;
+  egCntxt  *cntx;
+  egStats  *stats;
+  egTessel *btess;
+
+  btess = (egTessel *) tess->blind;
+  if (btess == NULL) return;
+  context = EG_context(tess);
+  if (context == NULL) return;
+  cntx = (egCntxt *) context->blind;
+  if (cntx == NULL) return;
+  n = 0;
+  if (remove == 0) n = EG_tessBytes(btess);
+
+  EG_mutexLock(cntx->mutex);
+  stats = (egStats *) cntx->stats;
+  if (stats != NULL) {
+    stats->tess  += n - btess->nbytes;
+    stats->total += n - btess->nbytes;
+    if (stats->tess  > stats->hiTess)  stats->hiTess  = stats->tess;
+    if (stats->total > stats->hiTotal) stats->hiTotal = stats->total;
+  }
+  btess->nbytes = n;
+  EG_mutexUnlock(cntx->mutex);
+}
+
+
+int
+EG_getMemoryStats(const egObject *context, int oclass, int mtype, int *count,
+                  int *hiCount, size_t *bytes, size_t *hiBytes)
+{
+  int     slot;
+  egCntxt *cntx;
+  egStats *stats;
+
+  *count = *hiCount = 0;
+  *bytes = *hiBytes = 0;
+  if (context == NULL)               return EGADS_NULLOBJ;
+  if (context->magicnumber != MAGIC) return EGADS_NOTOBJ;
+  if (context->oclass != CONTXT)     return EGADS_NOTCNTX;
+  cntx = (egCntxt *) context->blind;
+  if (cntx == NULL)                  return EGADS_NODATA;
+  if ((oclass < CONTXT) || (oclass > MODEL) || (oclass == NIL) ||
+      ((oclass > REFERENCE) && (oclass < PCURVE)) ||
+      ((oclass > SURFACE)   && (oclass < NODE))) return EGADS_INDEXERR;
+  slot = STATALL;
+  if ((oclass != CONTXT) && (oclass != EMPTY) && (oclass != REFERENCE) &&
+      (mtype >= SREVERSE)) {
+    if (mtype >= STATALL-1) return EGADS_INDEXERR;
+    slot = mtype+1;
+  }
+
+  EG_mutexLock(cntx->mutex);
+  stats = (egStats *) cntx->stats;
+  if (stats == NULL) {
+    EG_mutexUnlock(cntx->mutex);
+    return EGADS_MALLOC;
+  }
+  *count   = stats->count[oclass][slot];
+  *hiCount = stats->hiCount[oclass][slot];
+  if (oclass == CONTXT) {
+    *bytes   = stats->total;
+    *hiBytes = stats->hiTotal;
+  } else if (oclass != REFERENCE) {
+    *bytes   = *count  *sizeof(egObject);
+    *hiBytes = *hiCount*sizeof(egObject);
+    if (oclass == TESSELLATION) {
+      *bytes   += stats->tess;
+      *hiBytes += stats->hiTess;
+    }
+  }
+  EG_mutexUnlock(cntx->mutex);
+  return EGADS_SUCCESS;
+}
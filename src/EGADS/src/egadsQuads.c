@@ -20,6 +20,7 @@
 #define MAXSIDE 501
 
 #define AREA2D(a,b,c)   ((a[0]-c[0])*(b[1]-c[1]) -  (a[1]-c[1])*(b[0]-c[0]))
+#define AREA2DS(u,v,a,b,c) ((u[a]-u[c])*(v[b]-v[c]) - (v[a]-v[c])*(u[b]-u[c]))
 #define CROSS(a,b,c)      a[0] = (b[1]*c[2]) - (b[2]*c[1]);\
                           a[1] = (b[2]*c[0]) - (b[0]*c[2]);\
                           a[2] = (b[0]*c[1]) - (b[1]*c[0])
@@ -35,30 +36,56 @@ typedef struct {
 
 typedef struct {
   double uv[2];         /* (u,v) for node */
-  double duv[2];        /* delta for coordinate update */
-  double area;          /* accumulated area; -1 is boundary node */
-  double xyz[3];	/* xyz for the node */
+  double area;          /* 0 is interior node; -1 is boundary node */
 } Node;
 
 
-  static Quad   *quads;
-  static Node   *verts;
-  static double flip;
-  static int    nvert, nquad, sizes[8], last[MAXSIDE], unmap = 0;
-  static int    *vpatch, patch[17][2], npatch;
+typedef struct {
+  Quad   *quads;        /* the quads */
+  Node   *verts;        /* the vertices */
+  double flip;          /* -1 if sides 1 & 3 were swapped */
+  int    nvert;         /* number of vertices */
+  int    nquad;         /* number of quads */
+  int    sizes[8];      /* template block side lengths */
+  int    last[MAXSIDE]; /* scratch for the current block side */
+  int    *vpatch;       /* patch vertex indices */
+  int    patch[17][2];  /* patch sizes */
+  int    npatch;        /* number of patches */
+} quadMesh;
+
+
+typedef struct {
+  int    nint;          /* number of interior vertices */
+  int    *vint;         /* vertex index of each interior vertex */
+  int    *qoff;         /* CSR offsets into qadj (nint+1) */
+  int    *qadj;         /* the quads touching each interior vertex */
+  double *u;            /* vertex u */
+  double *v;            /* vertex v */
+  double *uv;           /* packed (u,v) for the batched evaluation */
+  double *xyz;          /* the evaluated vertex xyz */
+  double *qa;           /* quad weights */
+  double *qu;           /* quad weighted u centroid */
+  double *qv;           /* quad weighted v centroid */
+  /*@null@*/
+  double *qx;           /* fixed XYZ quad weight (mix passes) */
+} smoothWork;
 
-  extern int    EG_evaluate( const egObject *geom, const double *param, 
-                             double *results );
+
+  static int    unmap = 0;
+
+  extern int    EG_evaluateMany( const egObject *geom, int npts, int deriv,
+                                 const double *params, double *results );
 
 
 /* Compute arclength basis functions for TFI use */
 
 static void 
-EG_arcBasis(int nx, int ny, int *sideptr[], double *abasis[2])
+EG_arcBasis(quadMesh *qm, int nx, int ny, int *sideptr[], double *abasis[2])
 {
   int    i, j, k, i0, im, j0, jm, nny = ny+1;
   double xi, et;
   double anorm;
+  Node   *verts = qm->verts;
 
   for (j = k = 0; j <= ny; j += ny, k = 2) {		/* j const boundaries */
     abasis[0][j] = 0.0;					/* i == 0 */
@@ -251,15 +278,15 @@ EG_dQuadTFI(int *elen, double *uv, int npts, double *uvx)
 /* get the vertex count for the suite of blocks */
 
 static int
-EG_getVertCnt(int len, int blocks[][6])
+EG_getVertCnt(quadMesh *qm, int len, int blocks[][6])
 {
   int k, cnt;
   
-  npatch = len;
+  qm->npatch = len;
   for (cnt = k = 0; k < len; k++) {
-    patch[k][0] = sizes[blocks[k][0]] + 1;
-    patch[k][1] = sizes[blocks[k][1]] + 1;
-    cnt += patch[k][0]*patch[k][1];
+    qm->patch[k][0] = qm->sizes[blocks[k][0]] + 1;
+    qm->patch[k][1] = qm->sizes[blocks[k][1]] + 1;
+    cnt += qm->patch[k][0]*qm->patch[k][1];
   }
 
   return cnt;
@@ -269,16 +296,18 @@ EG_getVertCnt(int len, int blocks[][6])
 /* sets the individual quads by looping through the blocks */
 
 static void 
-EG_setQuads(int len, int blocks[][6], int *sideptr[])
+EG_setQuads(quadMesh *qm, int len, int blocks[][6], int *sideptr[])
 {
   int    i, j, k, i0, i1, i2, i3, ilast, nx, ny;
   int    ll, lr, ur, ul, j0, jm, ii, im, iv, sav;
   double et, xi;
+  Quad   *quads = qm->quads;
+  Node   *verts = qm->verts;
 
-  nquad = iv = 0; 
+  qm->nquad = iv = 0; 
   for (k = 0; k < len; k++) {
-    nx = sizes[blocks[k][0]];
-    ny = sizes[blocks[k][1]];
+    nx = qm->sizes[blocks[k][0]];
+    ny = qm->sizes[blocks[k][1]];
     i0 = blocks[k][2];
     i1 = blocks[k][3];
     i2 = blocks[k][4];
@@ -287,7 +316,7 @@ EG_setQuads(int len, int blocks[][6], int *sideptr[])
     lr = sideptr[i2][nx];
     ur = sideptr[i3][nx];
     ul = sideptr[i3][0];
-    for (i = 0; i < nx+1; i++) last[i] = sideptr[i2][i];
+    for (i = 0; i < nx+1; i++) qm->last[i] = sideptr[i2][i];
     for (j = 0; j < ny; j++) {
       ii    = sideptr[i0][j+1];
       if (i1 > 0) {
@@ -297,135 +326,115 @@ EG_setQuads(int len, int blocks[][6], int *sideptr[])
       }
       et    = ((double) (j+1)) / ((double) ny);
       ilast = sideptr[i0][j+1];
-      sav   = nquad;
+      sav   = qm->nquad;
       for (i = 0; i < nx; i++) {
         j0 = sideptr[i2][i+1];
         jm = sideptr[i3][i+1];
         xi = ((double) (i+1)) / ((double) nx);
-        quads[nquad].nodes[0] = last[i  ];
-        quads[nquad].nodes[1] = last[i+1];
+        quads[qm->nquad].nodes[0] = qm->last[i  ];
+        quads[qm->nquad].nodes[1] = qm->last[i+1];
         if (j == ny-1) {
-          quads[nquad].nodes[2] = sideptr[i3][i+1];
-          quads[nquad].nodes[3] = sideptr[i3][i  ];
+          quads[qm->nquad].nodes[2] = sideptr[i3][i+1];
+          quads[qm->nquad].nodes[3] = sideptr[i3][i  ];
         } else {
           if (i == nx-1) {
             if (i1 > 0) {
-              quads[nquad].nodes[2] = sideptr[i1][j+1];
-              last[i]  = ilast;
-              last[nx] = sideptr[i1][j+1];
+              quads[qm->nquad].nodes[2] = sideptr[i1][j+1];
+              qm->last[i]  = ilast;
+              qm->last[nx] = sideptr[i1][j+1];
             } else {
-              quads[nquad].nodes[2] = sideptr[-i1][ny-j-1];
-              last[i]  = ilast;
-              last[nx] = sideptr[-i1][ny-j-1];
+              quads[qm->nquad].nodes[2] = sideptr[-i1][ny-j-1];
+              qm->last[i]  = ilast;
+              qm->last[nx] = sideptr[-i1][ny-j-1];
             }
           } else {
-            quads[nquad].nodes[2] = nvert;
-            verts[nvert].uv[0]    = (1.0-xi)            * verts[ii].uv[0] +
-                                    (    xi)            * verts[im].uv[0] +
-                                               (1.0-et) * verts[j0].uv[0] +
-                                               (    et) * verts[jm].uv[0] -
-                                    (1.0-xi) * (1.0-et) * verts[ll].uv[0] -
-                                    (1.0-xi) * (    et) * verts[ul].uv[0] -
-                                    (    xi) * (1.0-et) * verts[lr].uv[0] -
-                                    (    xi) * (    et) * verts[ur].uv[0];
-            verts[nvert].uv[1]    = (1.0-xi)            * verts[ii].uv[1] +
-                                    (    xi)            * verts[im].uv[1] +
-                                               (1.0-et) * verts[j0].uv[1] +
-                                               (    et) * verts[jm].uv[1] -
-                                    (1.0-xi) * (1.0-et) * verts[ll].uv[1] -
-                                    (1.0-xi) * (    et) * verts[ul].uv[1] -
-                                    (    xi) * (1.0-et) * verts[lr].uv[1] -
-                                    (    xi) * (    et) * verts[ur].uv[1];
-            verts[nvert].area     = 0.0;
-            nvert++;
+            quads[qm->nquad].nodes[2] = qm->nvert;
+            verts[qm->nvert].uv[0]    = (1.0-xi)            * verts[ii].uv[0] +
+                                        (    xi)            * verts[im].uv[0] +
+                                                   (1.0-et) * verts[j0].uv[0] +
+                                                   (    et) * verts[jm].uv[0] -
+                                        (1.0-xi) * (1.0-et) * verts[ll].uv[0] -
+                                        (1.0-xi) * (    et) * verts[ul].uv[0] -
+                                        (    xi) * (1.0-et) * verts[lr].uv[0] -
+                                        (    xi) * (    et) * verts[ur].uv[0];
+            verts[qm->nvert].uv[1]    = (1.0-xi)            * verts[ii].uv[1] +
+                                        (    xi)            * verts[im].uv[1] +
+                                                   (1.0-et) * verts[j0].uv[1] +
+                                                   (    et) * verts[jm].uv[1] -
+                                        (1.0-xi) * (1.0-et) * verts[ll].uv[1] -
+                                        (1.0-xi) * (    et) * verts[ul].uv[1] -
+                                        (    xi) * (1.0-et) * verts[lr].uv[1] -
+                                        (    xi) * (    et) * verts[ur].uv[1];
+            verts[qm->nvert].area     = 0.0;
+            qm->nvert++;
           }
-          quads[nquad].nodes[3] = ilast;
-          last[i] = ilast;
-          ilast   = nvert-1;
+          quads[qm->nquad].nodes[3] = ilast;
+          qm->last[i] = ilast;
+          ilast       = qm->nvert-1;
         }
-        nquad++;
+        qm->nquad++;
       }
       if (j == 0) {
-        vpatch[iv] = quads[sav].nodes[0];
+        qm->vpatch[iv] = quads[sav].nodes[0];
         iv++;
         for (i = 0; i < nx; i++, iv++) 
-          vpatch[iv] = quads[sav+i].nodes[1];
+          qm->vpatch[iv] = quads[sav+i].nodes[1];
       }
-      vpatch[iv] = quads[sav].nodes[3];
+      qm->vpatch[iv] = quads[sav].nodes[3];
       iv++;
       for (i = 0; i < nx; i++, sav++, iv++)
-        vpatch[iv] = quads[sav].nodes[2];
+        qm->vpatch[iv] = quads[sav].nodes[2];
     }
   }
 }
 
 
-/* perform the laplacian smoothing on the grid vertices */
+/* one set of area weighted Jacobi iterations -- the quad weights and
+   weighted centroids are computed straight through the quads and then
+   gathered at each interior vertex via the CSR map (no scatter), returns
+   the residual of the first iteration */
 
-static void
-EG_smoothQuads(const egObject *face, int len, int npass)
+static double
+EG_smoothJacobi(quadMesh *qm, smoothWork *sw, int len, double wuv)
 {
-  int           i, j, i0, i1, i2, i3, status, pass, outLevel;
-  double        qarea, sum, big, delta1, sums[2], x1[3], x2[3], xn[3];
-  double        tAreaUV, tAreaXYZ, holdArea, results[18];
-  static double wXYZ = 0.75;
-
-  outLevel = EG_outLevel(face);
-
-  /* outer iteration -- pass 1 (uv only) */
+  int    i, j, k, m, q, i0, i1, i2, i3;
+  double qarea, big, delta1, su, sv, sa;
+  double *u = sw->u, *v = sw->v, *qa = sw->qa, *qu = sw->qu, *qv = sw->qv;
 
+  delta1 = 0.0;
   for (i = 0; i < len; i++) {
 
-    /* initialize deltas */
-    for (j = 0; j < nvert; j++) { 
-      verts[j].duv[0] = verts[j].duv[1] = 0.0;
-      if (verts[j].area > 0.0) verts[j].area = 0.0;
+    /* quad weights & weighted centroids */
+    for (j = 0; j < qm->nquad; j++) {
+      i0    = qm->quads[j].nodes[0];
+      i1    = qm->quads[j].nodes[1];
+      i2    = qm->quads[j].nodes[2];
+      i3    = qm->quads[j].nodes[3];
+      qarea = fabs(AREA2DS(u, v, i0, i1, i2) + AREA2DS(u, v, i0, i2, i3));
+      if (sw->qx != NULL) qarea = qarea*wuv + sw->qx[j];
+      qa[j] = qarea;
+      qu[j] = qarea*(u[i0] + u[i1] + u[i2] + u[i3])/4.0;
+      qv[j] = qarea*(v[i0] + v[i1] + v[i2] + v[i3])/4.0;
     }
-    /* calculate and distribute change */
-    for (j = 0; j < nquad; j++) {
-      i0    = quads[j].nodes[0];
-      i1    = quads[j].nodes[1];
-      i2    = quads[j].nodes[2];
-      i3    = quads[j].nodes[3];
-      qarea = flip*(AREA2D(verts[i0].uv, verts[i1].uv, verts[i2].uv) +
-                    AREA2D(verts[i0].uv, verts[i2].uv, verts[i3].uv));
-      if (qarea <= 0.0) {
-        qarea = -qarea;
-#ifdef DEBUG
-        printf(" Quad %d: Neg Area = %le\n", j, qarea);
-#endif
-      }
 
-      sum = qarea*(verts[i0].uv[0] + verts[i1].uv[0] + verts[i2].uv[0] +
-                   verts[i3].uv[0])/4.0;
-      verts[i0].duv[0] += sum;
-      verts[i1].duv[0] += sum;
-      verts[i2].duv[0] += sum;
-      verts[i3].duv[0] += sum;
-      sum = qarea*(verts[i0].uv[1] + verts[i1].uv[1] + verts[i2].uv[1] +
-                   verts[i3].uv[1])/4.0;
-      verts[i0].duv[1] += sum;
-      verts[i1].duv[1] += sum;
-      verts[i2].duv[1] += sum;
-      verts[i3].duv[1] += sum;
-
-      if (verts[i0].area >= 0.0) verts[i0].area += qarea;
-      if (verts[i1].area >= 0.0) verts[i1].area += qarea;
-      if (verts[i2].area >= 0.0) verts[i2].area += qarea;
-      if (verts[i3].area >= 0.0) verts[i3].area += qarea;
-    }
-    /* update distributions */
+    /* gather at the interior vertices */
     big = 0.0;
-    for (j = 0; j < nvert; j++) {
-      if (verts[j].area <= 0.0) continue;
-      sums[0] = verts[j].duv[0]/verts[j].area;
-      sums[1] = verts[j].duv[1]/verts[j].area;
-      sum     = fabs(sums[0] - verts[j].uv[0]);
-      if (big < sum) big = sum;
-      sum     = fabs(sums[1] - verts[j].uv[1]);
-      if (big < sum) big = sum;
-      verts[j].uv[0] = sums[0];
-      verts[j].uv[1] = sums[1];
+    for (k = 0; k < sw->nint; k++) {
+      su = sv = sa = 0.0;
+      for (m = sw->qoff[k]; m < sw->qoff[k+1]; m++) {
+        q   = sw->qadj[m];
+        su += qu[q];
+        sv += qv[q];
+        sa += qa[q];
+      }
+      if (sa <= 0.0) continue;
+      j  = sw->vint[k];
+      su = su/sa;
+      sv = sv/sa;
+      if (big < fabs(su - u[j])) big = fabs(su - u[j]);
+      if (big < fabs(sv - v[j])) big = fabs(sv - v[j]);
+      u[j] = su;
+      v[j] = sv;
     }
     if (i == 0) {
       delta1 = big;
@@ -435,151 +444,162 @@ EG_smoothQuads(const egObject *face, int len, int npass)
     }
   }
 
-  /* pseudo non-linear loop */
+  return delta1;
+}
+
+
+/* perform the laplacian smoothing on the grid vertices */
+
+static void
+EG_smoothQuads(quadMesh *qm, const egObject *face, int len, int npass)
+{
+  int           i, j, k, i0, i1, i2, i3, status, pass, outLevel, *iwork;
+  double        holdArea, tAreaUV, tAreaXYZ, delta0, delta, x1[3], x2[3];
+  double        xn[3], *dwork, *x;
+  smoothWork    sw;
+  Node          *verts = qm->verts;
+  static double wXYZ   = 0.75;
+
+  outLevel = EG_outLevel(face);
+  if ((len <= 0) || (qm->nquad == 0)) return;
+
+  /* vertex -> quad map for the interior (area not -1) vertices */
+
+  for (sw.nint = j = 0; j < qm->nvert; j++)
+    if (verts[j].area >= 0.0) sw.nint++;
+  if (sw.nint == 0) return;
+  iwork = (int *) EG_alloc((qm->nvert + 2*sw.nint + 1 + 4*qm->nquad)*
+                           sizeof(int));
+  if (iwork == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Info: Malloc on %d Verts (EG_smoothQuads)!\n",
+             qm->nvert);
+    return;
+  }
+  dwork = (double *) EG_alloc((7*qm->nvert + 4*qm->nquad)*sizeof(double));
+  if (dwork == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Info: Malloc on %d Verts (EG_smoothQuads)!\n",
+             qm->nvert);
+    EG_free(iwork);
+    return;
+  }
+  sw.vint = iwork   +   qm->nvert;
+  sw.qoff = sw.vint +   sw.nint;
+  sw.qadj = sw.qoff +   sw.nint + 1;
+  sw.u    = dwork;
+  sw.v    = sw.u    +   qm->nvert;
+  sw.uv   = sw.v    +   qm->nvert;
+  sw.xyz  = sw.uv   + 2*qm->nvert;
+  sw.qa   = sw.xyz  + 3*qm->nvert;
+  sw.qu   = sw.qa   +   qm->nquad;
+  sw.qv   = sw.qu   +   qm->nquad;
+  sw.qx   = NULL;
+
+  for (k = j = 0; j < qm->nvert; j++) {
+    iwork[j] = -1;
+    sw.u[j]  = verts[j].uv[0];
+    sw.v[j]  = verts[j].uv[1];
+    if (verts[j].area < 0.0) continue;
+    iwork[j]   = k;
+    sw.vint[k] = j;
+    k++;
+  }
+  for (k = 0; k <= sw.nint; k++) sw.qoff[k] = 0;
+  for (j = 0; j < qm->nquad; j++)
+    for (i = 0; i < 4; i++) {
+      k = iwork[qm->quads[j].nodes[i]];
+      if (k >= 0) sw.qoff[k+1]++;
+    }
+  for (k = 0; k < sw.nint; k++) sw.qoff[k+1] += sw.qoff[k];
+  for (j = 0; j < qm->nquad; j++)
+    for (i = 0; i < 4; i++) {
+      k = iwork[qm->quads[j].nodes[i]];
+      if (k >= 0) sw.qadj[sw.qoff[k]++] = j;
+    }
+  for (k = sw.nint; k > 0; k--) sw.qoff[k] = sw.qoff[k-1];
+  sw.qoff[0] = 0;
+
+  /* outer iteration -- pass 1 (uv only) */
+
+  delta0 = EG_smoothJacobi(qm, &sw, len, 1.0);
+
+  /* pseudo non-linear loop -- stop when a pass no longer moves the grid */
 
   for (pass = 0; pass < npass; pass++) {
+    if (delta0 == 0.0) break;
 
-    /* get xyz */
-    for (j = 0; j < nvert; j++) {
-      status = EG_evaluate(face, verts[j].uv, results);
-      if (status != EGADS_SUCCESS) {
-        if (outLevel > 0)
-          printf(" EGADS Info: EG_evaluate = %d (EG_smoothQuad)!\n", 
-                 status);
-        return;
-      }
-      verts[j].xyz[0] = results[0];
-      verts[j].xyz[1] = results[1];
-      verts[j].xyz[2] = results[2];
+    /* get xyz in one batch */
+    for (j = 0; j < qm->nvert; j++) {
+      sw.uv[2*j  ] = sw.u[j];
+      sw.uv[2*j+1] = sw.v[j];
+    }
+    status = EG_evaluateMany(face, qm->nvert, 0, sw.uv, sw.xyz);
+    if (status != EGADS_SUCCESS) {
+      if (outLevel > 0)
+        printf(" EGADS Info: EG_evaluateMany = %d (EG_smoothQuads)!\n",
+               status);
+      break;
     }
 
+    /* the XYZ quad weights are fixed for the pass */
+    x       = sw.xyz;
+    sw.qx   = sw.qa + 3*qm->nquad;
     tAreaUV = tAreaXYZ = 0.0;
-    for (j  = 0; j < nquad; j++) {
-      i0        = quads[j].nodes[0];
-      i1        = quads[j].nodes[1];
-      i2        = quads[j].nodes[2];
-      i3        = quads[j].nodes[3];
-      holdArea  = flip*(AREA2D(verts[i0].uv, verts[i1].uv, verts[i2].uv) +
-                        AREA2D(verts[i0].uv, verts[i2].uv, verts[i3].uv));
-      if (holdArea < 0.0) holdArea = -holdArea;
-      tAreaUV  += holdArea;
-      x1[0]     = verts[i1].xyz[0] - verts[i0].xyz[0];
-      x2[0]     = verts[i2].xyz[0] - verts[i0].xyz[0];
-      x1[1]     = verts[i1].xyz[1] - verts[i0].xyz[1];
-      x2[1]     = verts[i2].xyz[1] - verts[i0].xyz[1];
-      x1[2]     = verts[i1].xyz[2] - verts[i0].xyz[2];
-      x2[2]     = verts[i2].xyz[2] - verts[i0].xyz[2];
+    for (j = 0; j < qm->nquad; j++) {
+      i0        = qm->quads[j].nodes[0];
+      i1        = qm->quads[j].nodes[1];
+      i2        = qm->quads[j].nodes[2];
+      i3        = qm->quads[j].nodes[3];
+      tAreaUV  += fabs(AREA2DS(sw.u, sw.v, i0, i1, i2) +
+                       AREA2DS(sw.u, sw.v, i0, i2, i3));
+      x1[0]     = x[3*i1  ] - x[3*i0  ];
+      x2[0]     = x[3*i2  ] - x[3*i0  ];
+      x1[1]     = x[3*i1+1] - x[3*i0+1];
+      x2[1]     = x[3*i2+1] - x[3*i0+1];
+      x1[2]     = x[3*i1+2] - x[3*i0+2];
+      x2[2]     = x[3*i2+2] - x[3*i0+2];
       CROSS(xn, x1, x2);
       holdArea  = DOT(xn, xn);
-      if (holdArea <  0.0) holdArea = -holdArea;
-      tAreaXYZ += holdArea;
-      x1[0]     = verts[i3].xyz[0] - verts[i0].xyz[0];
-      x1[1]     = verts[i3].xyz[1] - verts[i0].xyz[1];
-      x1[2]     = verts[i3].xyz[2] - verts[i0].xyz[2];
+      x1[0]     = x[3*i3  ] - x[3*i0  ];
+      x1[1]     = x[3*i3+1] - x[3*i0+1];
+      x1[2]     = x[3*i3+2] - x[3*i0+2];
       CROSS(xn, x2, x1);
-      holdArea  = DOT(xn, xn);
-      if (holdArea <  0.0) holdArea = -holdArea;
+      holdArea += DOT(xn, xn);
+      sw.qx[j]  = holdArea;
       tAreaXYZ += holdArea;
     }
 #ifdef DEBUG
     printf(" ** %d   Areas = %le  %le **\n", pass, tAreaUV, tAreaXYZ);
 #endif
+    if ((tAreaUV == 0.0) || (tAreaXYZ == 0.0)) break;
+    for (j = 0; j < qm->nquad; j++) sw.qx[j] *= wXYZ/tAreaXYZ;
 
     /* outer iteration -- pass 2 (mix) */
-    for (i = 0; i < len; i++) {
-
-      /* initialize deltas */
-      for (j = 0; j < nvert; j++) { 
-        verts[j].duv[0] = verts[j].duv[1] = 0.0;
-        if (verts[j].area > 0.0) verts[j].area = 0.0;
-      }
-      /* calculate and distribute change */
-      for (j = 0; j < nquad; j++) {
-        i0    = quads[j].nodes[0];
-        i1    = quads[j].nodes[1];
-        i2    = quads[j].nodes[2];
-        i3    = quads[j].nodes[3];
-        qarea = flip*(AREA2D(verts[i0].uv, verts[i1].uv, verts[i2].uv) +
-                      AREA2D(verts[i0].uv, verts[i2].uv, verts[i3].uv));
-        if (qarea <= 0.0) {
-          qarea = -qarea;
-#ifdef DEBUG
-          printf(" Quad %d: Neg Area = %le\n", j, qarea);
-#endif
-        }
-        qarea *= (1.0-wXYZ)/tAreaUV;
-
-        x1[0]     = verts[i1].xyz[0] - verts[i0].xyz[0];
-        x2[0]     = verts[i2].xyz[0] - verts[i0].xyz[0];
-        x1[1]     = verts[i1].xyz[1] - verts[i0].xyz[1];
-        x2[1]     = verts[i2].xyz[1] - verts[i0].xyz[1];
-        x1[2]     = verts[i1].xyz[2] - verts[i0].xyz[2];
-        x2[2]     = verts[i2].xyz[2] - verts[i0].xyz[2];
-        CROSS(xn, x1, x2);
-        holdArea  = DOT(xn, xn);
-        if (holdArea <  0.0) holdArea = -holdArea;
-        qarea    += holdArea*wXYZ/tAreaXYZ;
-        x1[0]     = verts[i3].xyz[0] - verts[i0].xyz[0];
-        x1[1]     = verts[i3].xyz[1] - verts[i0].xyz[1];
-        x1[2]     = verts[i3].xyz[2] - verts[i0].xyz[2];
-        CROSS(xn, x2, x1);
-        holdArea  = DOT(xn, xn);
-        if (holdArea <  0.0) holdArea = -holdArea;
-        qarea    += holdArea*wXYZ/tAreaXYZ;
-
-        sum = qarea*(verts[i0].uv[0] + verts[i1].uv[0] + verts[i2].uv[0] +
-                     verts[i3].uv[0])/4.0;
-        verts[i0].duv[0] += sum;
-        verts[i1].duv[0] += sum;
-        verts[i2].duv[0] += sum;
-        verts[i3].duv[0] += sum;
-        sum = qarea*(verts[i0].uv[1] + verts[i1].uv[1] + verts[i2].uv[1] +
-                     verts[i3].uv[1])/4.0;
-        verts[i0].duv[1] += sum;
-        verts[i1].duv[1] += sum;
-        verts[i2].duv[1] += sum;
-        verts[i3].duv[1] += sum;
-
-        if (verts[i0].area >= 0.0) verts[i0].area += qarea;
-        if (verts[i1].area >= 0.0) verts[i1].area += qarea;
-        if (verts[i2].area >= 0.0) verts[i2].area += qarea;
-        if (verts[i3].area >= 0.0) verts[i3].area += qarea;
-      }
-      /* update distributions */
-      big = 0.0;
-      for (j = 0; j < nvert; j++) {
-        if (verts[j].area <= 0.0) continue;
-        sums[0] = verts[j].duv[0]/verts[j].area;
-        sums[1] = verts[j].duv[1]/verts[j].area;
-        sum     = fabs(sums[0] - verts[j].uv[0]);
-        if (big < sum) big = sum;
-        sum     = fabs(sums[1] - verts[j].uv[1]);
-        if (big < sum) big = sum;
-        verts[j].uv[0] = sums[0];
-        verts[j].uv[1] = sums[1];
-      }
-      if (i == 0) {
-        delta1 = big;
-        if (delta1 == 0.0) break;
-      } else {
-        if (big/delta1 < 1.e-3) break;
-      }
-    }
-
+    delta = EG_smoothJacobi(qm, &sw, len, (1.0-wXYZ)/tAreaUV);
+    if (delta < 1.e-3*delta0) break;
   }
 
+  for (j = 0; j < qm->nvert; j++) {
+    verts[j].uv[0] = sw.u[j];
+    verts[j].uv[1] = sw.v[j];
+  }
+  EG_free(dwork);
+  EG_free(iwork);
 }
 
 
 /* general blocking case */
 
 static int
-EG_quadFillG(const egObject *face, int nsp, int *indices, int *elens, 
-             double *uv, int *npts, double **uvs)
+EG_quadFillG(quadMesh *qm, const egObject *face, int nsp, int *indices,
+             int *elens, double *uv, int *npts, double **uvs)
 {
   int    i, j, k, len, N, M, P, Q, outLevel;
   int    i0, i1, cipt[26], *sideptr[42];
   double sums[2], cpts[26][2], *uvb;
+  Quad   *quads;
+  Node   *verts;
   static int sides[42][3] = {  0,  0,  4,   1,  4, 13,   2, 13, 19, 
                                3, 19, 20,   6, 20, 21,   4, 21, 22,
                                5, 22, 24,   2, 23, 24,   7, 18, 23,
@@ -644,79 +664,79 @@ EG_quadFillG(const egObject *face, int nsp, int *indices, int *elens,
     return -2;
   }
 
-  sizes[0] = sizes[1] = sizes[2] = N/3;
-  if (sizes[0]+sizes[1]+sizes[2] != N) sizes[0]++;
-  if (sizes[0]+sizes[1]+sizes[2] != N) sizes[2]++;
-  sizes[3] = sizes[4] = sizes[5] = M/3;
-  if (sizes[3]+sizes[4]+sizes[5] != M) sizes[3]++;
-  if (sizes[3]+sizes[4]+sizes[5] != M) sizes[5]++;
-  sizes[6] = P;
-  sizes[7] = Q;
+  qm->sizes[0] = qm->sizes[1] = qm->sizes[2] = N/3;
+  if (qm->sizes[0]+qm->sizes[1]+qm->sizes[2] != N) qm->sizes[0]++;
+  if (qm->sizes[0]+qm->sizes[1]+qm->sizes[2] != N) qm->sizes[2]++;
+  qm->sizes[3] = qm->sizes[4] = qm->sizes[5] = M/3;
+  if (qm->sizes[3]+qm->sizes[4]+qm->sizes[5] != M) qm->sizes[3]++;
+  if (qm->sizes[3]+qm->sizes[4]+qm->sizes[5] != M) qm->sizes[5]++;
+  qm->sizes[6] = P;
+  qm->sizes[7] = Q;
   for (i = 0; i < 8; i++) 
-    if (sizes[i] > MAXSIDE-1) return -3;
+    if (qm->sizes[i] > MAXSIDE-1) return -3;
 
   /* set the 26 critical points -- 16 exterior */
 
   cpts[ 0][0] = uv[0];
   cpts[ 0][1] = uv[1];
   cipt[ 0]    = indices[0];
-  len  = sizes[0];
+  len  = qm->sizes[0];
   cpts[ 4][0] = uv[2*len  ];
   cpts[ 4][1] = uv[2*len+1];
   cipt[ 4]    = indices[len];
-  len += sizes[1];
+  len += qm->sizes[1];
   cpts[13][0] = uv[2*len  ];
   cpts[13][1] = uv[2*len+1];
   cipt[13]    = indices[len];
-  len += sizes[2];
+  len += qm->sizes[2];
   cpts[19][0] = uv[2*len  ];
   cpts[19][1] = uv[2*len+1];
   cipt[19]    = indices[len];
-  len += sizes[3];
+  len += qm->sizes[3];
   cpts[20][0] = uv[2*len  ];
   cpts[20][1] = uv[2*len+1];
   cipt[20]    = indices[len];
-  len += sizes[6];
+  len += qm->sizes[6];
   cpts[21][0] = uv[2*len  ];
   cpts[21][1] = uv[2*len+1];
   cipt[21]    = indices[len];
-  len += sizes[4];
+  len += qm->sizes[4];
   cpts[22][0] = uv[2*len  ];
   cpts[22][1] = uv[2*len+1];
   cipt[22]    = indices[len];
-  len += sizes[5];
+  len += qm->sizes[5];
   cpts[24][0] = uv[2*len  ];
   cpts[24][1] = uv[2*len+1];
   cipt[24]    = indices[len];
-  len += sizes[2];
+  len += qm->sizes[2];
   cpts[23][0] = uv[2*len  ];
   cpts[23][1] = uv[2*len+1];
   cipt[23]    = indices[len];
-  len += sizes[7];
+  len += qm->sizes[7];
   cpts[18][0] = uv[2*len  ];
   cpts[18][1] = uv[2*len+1];
   cipt[18]    = indices[len];
-  len += sizes[1];
+  len += qm->sizes[1];
   cpts[25][0] = uv[2*len  ];
   cpts[25][1] = uv[2*len+1];
   cipt[25]    = indices[len];
-  len += sizes[6];
+  len += qm->sizes[6];
   cpts[11][0] = uv[2*len  ];
   cpts[11][1] = uv[2*len+1];
   cipt[11]    = indices[len];
-  len += sizes[7];
+  len += qm->sizes[7];
   cpts[ 7][0] = uv[2*len  ];
   cpts[ 7][1] = uv[2*len+1];
   cipt[ 7]    = indices[len];
-  len += sizes[0];
+  len += qm->sizes[0];
   cpts[ 3][0] = uv[2*len  ];
   cpts[ 3][1] = uv[2*len+1];
   cipt[ 3]    = indices[len];
-  len += sizes[5];
+  len += qm->sizes[5];
   cpts[ 2][0] = uv[2*len  ];
   cpts[ 2][1] = uv[2*len+1];
   cipt[ 2]    = indices[len];
-  len += sizes[4];
+  len += qm->sizes[4];
   cpts[ 1][0] = uv[2*len  ];
   cpts[ 1][1] = uv[2*len+1];
   cipt[ 1]    = indices[len];
@@ -737,29 +757,31 @@ EG_quadFillG(const egObject *face, int nsp, int *indices, int *elens,
       cpts[interior[j][0]][1] = sums[1]/len;
     }
 
-  len    = EG_getVertCnt(17, blocks);
-  vpatch = (int *) EG_alloc(len*sizeof(int));
-  if (vpatch == NULL) return -1;
+  len    = EG_getVertCnt(qm, 17, blocks);
+  qm->vpatch = (int *) EG_alloc(len*sizeof(int));
+  if (qm->vpatch == NULL) return -1;
   
   /* allocate our temporary storage */
 
   len   = MAX(elens[1], elens[2]);
   quads = (Quad *) EG_alloc(len*len*sizeof(Quad));
   if (quads == NULL) {
-    EG_free(vpatch);
+    EG_free(qm->vpatch);
     return -1;
   }
   verts = (Node *) EG_alloc((len+1)*(len+1)*sizeof(Node));
   if (verts == NULL) {
     EG_free(quads);
-    EG_free(vpatch);
+    EG_free(qm->vpatch);
     return -1;
   }
+  qm->quads = quads;
+  qm->verts = verts;
 
   /* initialize the vertices */
 
-  nvert = elens[0] + elens[1] + elens[2] + elens[3];
-  for (i = 0; i < nvert; i++) {
+  qm->nvert = elens[0] + elens[1] + elens[2] + elens[3];
+  for (i = 0; i < qm->nvert; i++) {
     j = indices[i];
     verts[j].uv[0] = uv[2*i  ];
     verts[j].uv[1] = uv[2*i+1];
@@ -767,24 +789,24 @@ EG_quadFillG(const egObject *face, int nsp, int *indices, int *elens,
   }
   for (i = 0; i < 10; i++) {
     j = interior[i][0];
-    verts[nvert].uv[0] = cpts[j][0];
-    verts[nvert].uv[1] = cpts[j][1];
-    verts[nvert].area  = 0.0;
-    cipt[j]            = nvert;
-    nvert++;
+    verts[qm->nvert].uv[0] = cpts[j][0];
+    verts[qm->nvert].uv[1] = cpts[j][1];
+    verts[qm->nvert].area  = 0.0;
+    cipt[j]                = qm->nvert;
+    qm->nvert++;
   }
 
   /* set the exterior block sides */
 
   for (i = 0; i < 42; i++) sideptr[i] = NULL;
   for (j = i = 0; i < 16; i++) {
-    len = sizes[sides[i][0]] + 1;
+    len = qm->sizes[sides[i][0]] + 1;
     sideptr[i] = (int *) EG_alloc(len*sizeof(int));
     if (sideptr[i] == NULL) {
       for (k = 0; k < i; k++) EG_free(sideptr[k]);
       EG_free(verts);
       EG_free(quads);
-      EG_free(vpatch);
+      EG_free(qm->vpatch);
       return -1;
     }
     if (i >= 7) {
@@ -803,60 +825,62 @@ EG_quadFillG(const egObject *face, int nsp, int *indices, int *elens,
   /* do the interior sides */
 
   for (i = 16; i < 42; i++) {
-    len = sizes[sides[i][0]] + 1;
+    len = qm->sizes[sides[i][0]] + 1;
     sideptr[i] = (int *) EG_alloc(len*sizeof(int));
     if (sideptr[i] == NULL) {
       for (k = 0; k < i; k++) EG_free(sideptr[k]);
       EG_free(verts);
       EG_free(quads);
-      EG_free(vpatch);
+      EG_free(qm->vpatch);
       return -1;
     }
     i0 = sides[i][1];
     i1 = sides[i][2];
     sideptr[i][0] = cipt[i0];
     for (j = 1; j < len-1; j++) {
-      verts[nvert].uv[0] = cpts[i0][0] + j*(cpts[i1][0]-cpts[i0][0])/(len-1);
-      verts[nvert].uv[1] = cpts[i0][1] + j*(cpts[i1][1]-cpts[i0][1])/(len-1);
-      verts[nvert].area  = 0.0;
-      sideptr[i][j]      = nvert;
-      nvert++;
+      verts[qm->nvert].uv[0] = cpts[i0][0] +
+                               j*(cpts[i1][0]-cpts[i0][0])/(len-1);
+      verts[qm->nvert].uv[1] = cpts[i0][1] +
+                               j*(cpts[i1][1]-cpts[i0][1])/(len-1);
+      verts[qm->nvert].area  = 0.0;
+      sideptr[i][j]          = qm->nvert;
+      qm->nvert++;
     }
     sideptr[i][len-1] = cipt[i1];
   }
 
   /* start filling the quads by specifying the 17 blocks */
 
-  EG_setQuads(17, blocks, sideptr);
+  EG_setQuads(qm, 17, blocks, sideptr);
 
   /* free up our integrated sides */
   for (i = 0; i < 42; i++) EG_free(sideptr[i]);
 
   /* get the actual storage that we return the data with */
 
-  uvb = (double *) EG_alloc(2*nvert*sizeof(double));
+  uvb = (double *) EG_alloc(2*qm->nvert*sizeof(double));
   if (uvb == NULL) {
     EG_free(verts);
     EG_free(quads);
-    EG_free(vpatch);
+    EG_free(qm->vpatch);
     return -1;    
   }
 
   /* calculate the actual coordinates */
 
   len = elens[1]*elens[2];
-  EG_smoothQuads(face, len, nsp);
+  EG_smoothQuads(qm, face, len, nsp);
 
   /* fill the memory to be returned */
 
-  for (j = 0; j < nvert; j++) {
+  for (j = 0; j < qm->nvert; j++) {
     uvb[2*j  ] = verts[j].uv[0];
     uvb[2*j+1] = verts[j].uv[1];
   }
 
   /* cleanup and exit */
 
-  *npts = nvert;
+  *npts = qm->nvert;
   *uvs  = uvb;
   EG_free(verts);
 
@@ -867,12 +891,14 @@ EG_quadFillG(const egObject *face, int nsp, int *indices, int *elens,
 /* No P case */
 
 static int
-EG_quadFillQ(const egObject *face, int nsp, int *indices, int *elens, 
-             double *uv, int *npts, double **uvs)
+EG_quadFillQ(quadMesh *qm, const egObject *face, int nsp, int *indices,
+             int *elens, double *uv, int *npts, double **uvs)
 {
   int    i, j, k, len, N, M, P, Q, outLevel;
   int    i0, i1, cipt[20], *sideptr[31];
   double sums[2], cpts[20][2], *uvb;
+  Quad   *quads;
+  Node   *verts;
   static int sides[31][3] = {  0,  0,  1,   1,  1,  2,   2,  2,  3, 
                                3,  3,  4,   4,  4,  5,   5,  5,  6,
                                2,  7,  6,   7,  8,  7,   1,  9,  8,
@@ -926,71 +952,71 @@ EG_quadFillQ(const egObject *face, int nsp, int *indices, int *elens,
   }
   if (P != 0) return -2;
 
-  sizes[0] = sizes[1] = sizes[2] = N/3;
-  if (sizes[0]+sizes[1]+sizes[2] != N) sizes[0]++;
-  if (sizes[0]+sizes[1]+sizes[2] != N) sizes[2]++;
-  sizes[3] = sizes[4] = sizes[5] = M/3;
-  if (sizes[3]+sizes[4]+sizes[5] != M) sizes[3]++;
-  if (sizes[3]+sizes[4]+sizes[5] != M) sizes[5]++;
-  sizes[6] = P;
-  sizes[7] = Q;
+  qm->sizes[0] = qm->sizes[1] = qm->sizes[2] = N/3;
+  if (qm->sizes[0]+qm->sizes[1]+qm->sizes[2] != N) qm->sizes[0]++;
+  if (qm->sizes[0]+qm->sizes[1]+qm->sizes[2] != N) qm->sizes[2]++;
+  qm->sizes[3] = qm->sizes[4] = qm->sizes[5] = M/3;
+  if (qm->sizes[3]+qm->sizes[4]+qm->sizes[5] != M) qm->sizes[3]++;
+  if (qm->sizes[3]+qm->sizes[4]+qm->sizes[5] != M) qm->sizes[5]++;
+  qm->sizes[6] = P;
+  qm->sizes[7] = Q;
   for (i = 0; i < 8; i++)
-    if (sizes[i] > MAXSIDE-1) return -3;
+    if (qm->sizes[i] > MAXSIDE-1) return -3;
 
   /* set the 20 critical points -- 14 exterior */
 
   cpts[ 0][0] = uv[0];
   cpts[ 0][1] = uv[1];
   cipt[ 0]    = indices[0];;
-  len  = sizes[0];
+  len  = qm->sizes[0];
   cpts[ 1][0] = uv[2*len  ];
   cpts[ 1][1] = uv[2*len+1];
   cipt[ 1]    = indices[len];
-  len += sizes[1];
+  len += qm->sizes[1];
   cpts[ 2][0] = uv[2*len  ];
   cpts[ 2][1] = uv[2*len+1];
   cipt[ 2]    = indices[len];
-  len += sizes[2];
+  len += qm->sizes[2];
   cpts[ 3][0] = uv[2*len  ];
   cpts[ 3][1] = uv[2*len+1];
   cipt[ 3]    = indices[len];
-  len += sizes[3];
+  len += qm->sizes[3];
   cpts[ 4][0] = uv[2*len  ];
   cpts[ 4][1] = uv[2*len+1];
   cipt[ 4]    = indices[len];
-  len += sizes[4];
+  len += qm->sizes[4];
   cpts[ 5][0] = uv[2*len  ];
   cpts[ 5][1] = uv[2*len+1];
   cipt[ 5]    = indices[len];
-  len += sizes[5];
+  len += qm->sizes[5];
   cpts[ 6][0] = uv[2*len  ];
   cpts[ 6][1] = uv[2*len+1];
   cipt[ 6]    = indices[len];
-  len += sizes[2];
+  len += qm->sizes[2];
   cpts[ 7][0] = uv[2*len  ];
   cpts[ 7][1] = uv[2*len+1];
   cipt[ 7]    = indices[len];
-  len += sizes[7];
+  len += qm->sizes[7];
   cpts[ 8][0] = uv[2*len  ];
   cpts[ 8][1] = uv[2*len+1];
   cipt[ 8]    = indices[len];
-  len += sizes[1];
+  len += qm->sizes[1];
   cpts[ 9][0] = uv[2*len  ];
   cpts[ 9][1] = uv[2*len+1];
   cipt[ 9]    = indices[len];
-  len += sizes[7];
+  len += qm->sizes[7];
   cpts[10][0] = uv[2*len  ];
   cpts[10][1] = uv[2*len+1];
   cipt[10]    = indices[len];
-  len += sizes[0];
+  len += qm->sizes[0];
   cpts[11][0] = uv[2*len  ];
   cpts[11][1] = uv[2*len+1];
   cipt[11]    = indices[len];
-  len += sizes[5];
+  len += qm->sizes[5];
   cpts[12][0] = uv[2*len  ];
   cpts[12][1] = uv[2*len+1];
   cipt[12]    = indices[len];
-  len += sizes[4];
+  len += qm->sizes[4];
   cpts[13][0] = uv[2*len  ];
   cpts[13][1] = uv[2*len+1];
   cipt[13]    = indices[len];
@@ -1011,29 +1037,31 @@ EG_quadFillQ(const egObject *face, int nsp, int *indices, int *elens,
       cpts[interior[j][0]][1] = sums[1]/len;
     }
     
-  len    = EG_getVertCnt(12, blocks);
-  vpatch = (int *) EG_alloc(len*sizeof(int));
-  if (vpatch == NULL) return -1;
+  len    = EG_getVertCnt(qm, 12, blocks);
+  qm->vpatch = (int *) EG_alloc(len*sizeof(int));
+  if (qm->vpatch == NULL) return -1;
 
   /* allocate our temporary storage */
 
   len   = MAX(elens[1], elens[2]);
   quads = (Quad *) EG_alloc(len*len*sizeof(Quad));
   if (quads == NULL) {
-    EG_free(vpatch);
+    EG_free(qm->vpatch);
     return -1;
   }
   verts = (Node *) EG_alloc((len+1)*(len+1)*sizeof(Node));
   if (verts == NULL) {
     EG_free(quads);
-    EG_free(vpatch);
+    EG_free(qm->vpatch);
     return -1;
   }
+  qm->quads = quads;
+  qm->verts = verts;
 
   /* initialize the vertices */
 
-  nvert = elens[0] + elens[1] + elens[2] + elens[3];
-  for (i = 0; i < nvert; i++) {
+  qm->nvert = elens[0] + elens[1] + elens[2] + elens[3];
+  for (i = 0; i < qm->nvert; i++) {
     j = indices[i];
     verts[j].uv[0] = uv[2*i  ];
     verts[j].uv[1] = uv[2*i+1];
@@ -1041,24 +1069,24 @@ EG_quadFillQ(const egObject *face, int nsp, int *indices, int *elens,
   }
   for (i = 0; i < 6; i++) {
     j = interior[i][0];
-    verts[nvert].uv[0] = cpts[j][0];
-    verts[nvert].uv[1] = cpts[j][1];
-    verts[nvert].area  = 0.0;
-    cipt[j]            = nvert;
-    nvert++;
+    verts[qm->nvert].uv[0] = cpts[j][0];
+    verts[qm->nvert].uv[1] = cpts[j][1];
+    verts[qm->nvert].area  = 0.0;
+    cipt[j]                = qm->nvert;
+    qm->nvert++;
   }
 
   /* set the exterior block sides */
 
   for (i = 0; i < 31; i++) sideptr[i] = NULL;
   for (j = i = 0; i < 14; i++) {
-    len = sizes[sides[i][0]] + 1;
+    len = qm->sizes[sides[i][0]] + 1;
     sideptr[i] = (int *) EG_alloc(len*sizeof(int));
     if (sideptr[i] == NULL) {
       for (k = 0; k < i; k++) EG_free(sideptr[k]);
       EG_free(verts);
       EG_free(quads);
-      EG_free(vpatch);
+      EG_free(qm->vpatch);
       return -1;
     }
     if (i >= 6) {
@@ -1077,7 +1105,7 @@ EG_quadFillQ(const egObject *face, int nsp, int *indices, int *elens,
   /* do the interior sides */
 
   for (i = 14; i < 31; i++) {
-    len = sizes[sides[i][0]] + 1;
+    len = qm->sizes[sides[i][0]] + 1;
     sideptr[i] = (int *) EG_alloc(len*sizeof(int));
     if (sideptr[i] == NULL) {
       for (k = 0; k < i; k++) EG_free(sideptr[k]);
@@ -1089,47 +1117,49 @@ EG_quadFillQ(const egObject *face, int nsp, int *indices, int *elens,
     i1 = sides[i][2];
     sideptr[i][0] = cipt[i0];
     for (j = 1; j < len-1; j++) {
-      verts[nvert].uv[0] = cpts[i0][0] + j*(cpts[i1][0]-cpts[i0][0])/(len-1);
-      verts[nvert].uv[1] = cpts[i0][1] + j*(cpts[i1][1]-cpts[i0][1])/(len-1);
-      verts[nvert].area  = 0.0;
-      sideptr[i][j]      = nvert;
-      nvert++;
+      verts[qm->nvert].uv[0] = cpts[i0][0] +
+                               j*(cpts[i1][0]-cpts[i0][0])/(len-1);
+      verts[qm->nvert].uv[1] = cpts[i0][1] +
+                               j*(cpts[i1][1]-cpts[i0][1])/(len-1);
+      verts[qm->nvert].area  = 0.0;
+      sideptr[i][j]          = qm->nvert;
+      qm->nvert++;
     }
     sideptr[i][len-1] = cipt[i1];
   }
 
   /* start filling the quads by specifying the 12 blocks */
 
-  EG_setQuads(12, blocks, sideptr);
+  EG_setQuads(qm, 12, blocks, sideptr);
 
   /* free up our integrated sides */
   for (i = 0; i < 31; i++) EG_free(sideptr[i]);
 
   /* get the actual storage that we return the data with */
 
-  uvb = (double *) EG_alloc(2*nvert*sizeof(double));
+  uvb = (double *) EG_alloc(2*qm->nvert*sizeof(double));
   if (uvb == NULL) {
     EG_free(verts);
     EG_free(quads);
-    EG_free(vpatch);
+    EG_free(qm->vpatch);
     return -1;    
   }
 
   /* calculate the actual coordinates */
 
   len = elens[1]*elens[2];
-  EG_smoothQuads(face, len, nsp);
+  EG_smoothQuads(qm, face, len, nsp);
 
   /* fill the memory to be returned */
 
-  for (j = 0; j < nvert; j++) {
+  for (j = 0; j < qm->nvert; j++) {
     uvb[2*j  ] = verts[j].uv[0];
     uvb[2*j+1] = verts[j].uv[1];
   }
 
   /* cleanup and exit */
 
-  *npts = nvert;
+  *npts = qm->nvert;
   *uvs  = uvb;
   EG_free(verts);
   
@@ -1140,12 +1170,14 @@ EG_quadFillQ(const egObject *face, int nsp, int *indices, int *elens,
 /* No Q case */
 
 static int
-EG_quadFillP(const egObject *face, int nsp, int *indices, int *elens, 
-             double *uv, int *npts, double **uvs)
+EG_quadFillP(quadMesh *qm, const egObject *face, int nsp, int *indices,
+             int *elens, double *uv, int *npts, double **uvs)
 {
   int    i, j, k, len, N, M, P, Q, outLevel;
   int    i0, i1, cipt[21], *sideptr[33];
   double sums[2], cpts[21][2], *uvb;
+  Quad   *quads;
+  Node   *verts;
   static int sides[33][3] = {  0,  0,  1,   1,  1,  2,   2,  2,  3, 
                                3,  3,  4,   6,  4,  5,   4,  5,  6,
                                5,  6,  7,   2,  8,  7,   1,  9,  8,
@@ -1201,71 +1233,71 @@ EG_quadFillP(const egObject *face, int nsp, int *indices, int *elens,
   }
   if (Q != 0) return -2;
 
-  sizes[0] = sizes[1] = sizes[2] = N/3;
-  if (sizes[0]+sizes[1]+sizes[2] != N) sizes[0]++;
-  if (sizes[0]+sizes[1]+sizes[2] != N) sizes[2]++;
-  sizes[3] = sizes[4] = sizes[5] = M/3;
-  if (sizes[3]+sizes[4]+sizes[5] != M) sizes[3]++;
-  if (sizes[3]+sizes[4]+sizes[5] != M) sizes[5]++;
-  sizes[6] = P;
-  sizes[7] = Q;
+  qm->sizes[0] = qm->sizes[1] = qm->sizes[2] = N/3;
+  if (qm->sizes[0]+qm->sizes[1]+qm->sizes[2] != N) qm->sizes[0]++;
+  if (qm->sizes[0]+qm->sizes[1]+qm->sizes[2] != N) qm->sizes[2]++;
+  qm->sizes[3] = qm->sizes[4] = qm->sizes[5] = M/3;
+  if (qm->sizes[3]+qm->sizes[4]+qm->sizes[5] != M) qm->sizes[3]++;
+  if (qm->sizes[3]+qm->sizes[4]+qm->sizes[5] != M) qm->sizes[5]++;
+  qm->sizes[6] = P;
+  qm->sizes[7] = Q;
   for (i = 0; i < 8; i++)
-    if (sizes[i] > MAXSIDE-1) return -3;
+    if (qm->sizes[i] > MAXSIDE-1) return -3;
 
   /* set the 21 critical points -- 14 exterior */
 
   cpts[ 0][0] = uv[0];
   cpts[ 0][1] = uv[1];
   cipt[ 0]    = indices[0];
-  len  = sizes[0];
+  len  = qm->sizes[0];
   cpts[ 1][0] = uv[2*len  ];
   cpts[ 1][1] = uv[2*len+1];
   cipt[ 1]    = indices[len];
-  len += sizes[1];
+  len += qm->sizes[1];
   cpts[ 2][0] = uv[2*len  ];
   cpts[ 2][1] = uv[2*len+1];
   cipt[ 2]    = indices[len];
-  len += sizes[2];
+  len += qm->sizes[2];
   cpts[ 3][0] = uv[2*len  ];
   cpts[ 3][1] = uv[2*len+1];
   cipt[ 3]    = indices[len];
-  len += sizes[3];
+  len += qm->sizes[3];
   cpts[ 4][0] = uv[2*len  ];
   cpts[ 4][1] = uv[2*len+1];
   cipt[ 4]    = indices[len];
-  len += sizes[6];
+  len += qm->sizes[6];
   cpts[ 5][0] = uv[2*len  ];
   cpts[ 5][1] = uv[2*len+1];
   cipt[ 5]    = indices[len];
-  len += sizes[4];
+  len += qm->sizes[4];
   cpts[ 6][0] = uv[2*len  ];
   cpts[ 6][1] = uv[2*len+1];
   cipt[ 6]    = indices[len];
-  len += sizes[5];
+  len += qm->sizes[5];
   cpts[ 7][0] = uv[2*len  ];
   cpts[ 7][1] = uv[2*len+1];
   cipt[ 7]    = indices[len];
-  len += sizes[2];
+  len += qm->sizes[2];
   cpts[ 8][0] = uv[2*len  ];
   cpts[ 8][1] = uv[2*len+1];
   cipt[ 8]    = indices[len];
-  len += sizes[1];
+  len += qm->sizes[1];
   cpts[ 9][0] = uv[2*len  ];
   cpts[ 9][1] = uv[2*len+1];
   cipt[ 9]    = indices[len];
-  len += sizes[6];
+  len += qm->sizes[6];
   cpts[10][0] = uv[2*len  ];
   cpts[10][1] = uv[2*len+1];
   cipt[10]    = indices[len];
-  len += sizes[0];
+  len += qm->sizes[0];
   cpts[11][0] = uv[2*len  ];
   cpts[11][1] = uv[2*len+1];
   cipt[11]    = indices[len];
-  len += sizes[5];
+  len += qm->sizes[5];
   cpts[12][0] = uv[2*len  ];
   cpts[12][1] = uv[2*len+1];
   cipt[12]    = indices[len];
-  len += sizes[4];
+  len += qm->sizes[4];
   cpts[13][0] = uv[2*len  ];
   cpts[13][1] = uv[2*len+1];
   cipt[13]    = indices[len];
@@ -1286,29 +1318,31 @@ EG_quadFillP(const egObject *face, int nsp, int *indices, int *elens,
       cpts[interior[j][0]][1] = sums[1]/len;
     }
     
-  len    = EG_getVertCnt(13, blocks);
-  vpatch = (int *) EG_alloc(len*sizeof(int));
-  if (vpatch == NULL) return -1;
+  len    = EG_getVertCnt(qm, 13, blocks);
+  qm->vpatch = (int *) EG_alloc(len*sizeof(int));
+  if (qm->vpatch == NULL) return -1;
 
   /* allocate our temporary storage */
 
   len   = MAX(elens[1], elens[2]);
   quads = (Quad *) EG_alloc(len*len*sizeof(Quad));
   if (quads == NULL) {
-    EG_free(vpatch);
+    EG_free(qm->vpatch);
     return -1;
   }
   verts = (Node *) EG_alloc((len+1)*(len+1)*sizeof(Node));
   if (verts == NULL) {
     EG_free(quads);
-    EG_free(vpatch);
+    EG_free(qm->vpatch);
     return -1;
   }
+  qm->quads = quads;
+  qm->verts = verts;
 
   /* initialize the vertices */
 
-  nvert = elens[0] + elens[1] + elens[2] + elens[3];
-  for (i = 0; i < nvert; i++) {
+  qm->nvert = elens[0] + elens[1] + elens[2] + elens[3];
+  for (i = 0; i < qm->nvert; i++) {
     j = indices[i];
     verts[j].uv[0] = uv[2*i  ];
     verts[j].uv[1] = uv[2*i+1];
@@ -1316,18 +1350,18 @@ EG_quadFillP(const egObject *face, int nsp, int *indices, int *elens,
   }
   for (i = 0; i < 7; i++) {
     j = interior[i][0];
-    verts[nvert].uv[0] = cpts[j][0];
-    verts[nvert].uv[1] = cpts[j][1];
-    verts[nvert].area  = 0.0;
-    cipt[j] = nvert;
-    nvert++;
+    verts[qm->nvert].uv[0] = cpts[j][0];
+    verts[qm->nvert].uv[1] = cpts[j][1];
+    verts[qm->nvert].area  = 0.0;
+    cipt[j] = qm->nvert;
+    qm->nvert++;
   }
 
   /* set the exterior block sides */
 
   for (i = 0; i < 33; i++) sideptr[i] = NULL;
   for (j = i = 0; i < 14; i++) {
-    len = sizes[sides[i][0]] + 1;
+    len = qm->sizes[sides[i][0]] + 1;
     sideptr[i] = (int *) EG_alloc(len*sizeof(int));
     if (sideptr[i] == NULL) {
       for (k = 0; k < i; k++) EG_free(sideptr[k]);
@@ -1351,7 +1385,7 @@ EG_quadFillP(const egObject *face, int nsp, int *indices, int *elens,
   /* do the interior sides */
 
   for (i = 14; i < 33; i++) {
-    len = sizes[sides[i][0]] + 1;
+    len = qm->sizes[sides[i][0]] + 1;
     sideptr[i] = (int *) EG_alloc(len*sizeof(int));
     if (sideptr[i] == NULL) {
       for (k = 0; k < i; k++) EG_free(sideptr[k]);
@@ -1363,47 +1397,49 @@ EG_quadFillP(const egObject *face, int nsp, int *indices, int *elens,
     i1 = sides[i][2];
     sideptr[i][0] = cipt[i0];
     for (j = 1; j < len-1; j++) {
-      verts[nvert].uv[0] = cpts[i0][0] + j*(cpts[i1][0]-cpts[i0][0])/(len-1);
-      verts[nvert].uv[1] = cpts[i0][1] + j*(cpts[i1][1]-cpts[i0][1])/(len-1);
-      verts[nvert].area  = 0.0;
-      sideptr[i][j]      = nvert;
-      nvert++;
+      verts[qm->nvert].uv[0] = cpts[i0][0] +
+                               j*(cpts[i1][0]-cpts[i0][0])/(len-1);
+      verts[qm->nvert].uv[1] = cpts[i0][1] +
+                               j*(cpts[i1][1]-cpts[i0][1])/(len-1);
+      verts[qm->nvert].area  = 0.0;
+      sideptr[i][j]          = qm->nvert;
+      qm->nvert++;
     }
     sideptr[i][len-1] = cipt[i1];
   }
 
   /* start filling the quads by specifying the 13 blocks */
 
-  EG_setQuads(13, blocks, sideptr);
+  EG_setQuads(qm, 13, blocks, sideptr);
 
   /* free up our integrated sides */
   for (i = 0; i < 33; i++) EG_free(sideptr[i]);
 
   /* get the actual storage that we return the data with */
 
-  uvb = (double *) EG_alloc(2*nvert*sizeof(double));
+  uvb = (double *) EG_alloc(2*qm->nvert*sizeof(double));
   if (uvb == NULL) {
     EG_free(verts);
     EG_free(quads);
-    EG_free(vpatch);
+    EG_free(qm->vpatch);
     return -1;    
   }
 
   /* calculate the actual coordinates */
 
   len = elens[1]*elens[2];
-  EG_smoothQuads(face, len, nsp);
+  EG_smoothQuads(qm, face, len, nsp);
 
   /* fill the memory to be returned */
 
-  for (j = 0; j < nvert; j++) {
+  for (j = 0; j < qm->nvert; j++) {
     uvb[2*j  ] = verts[j].uv[0];
     uvb[2*j+1] = verts[j].uv[1];
   }
 
   /* cleanup and exit */
 
-  *npts = nvert;
+  *npts = qm->nvert;
   *uvs  = uvb;
   EG_free(verts);
 
@@ -1414,12 +1450,14 @@ EG_quadFillP(const egObject *face, int nsp, int *indices, int *elens,
 /* TFI case */
 
 static int
-EG_quadFillT(int *elens, double *uv, int *npts, double **uvs)
+EG_quadFillT(quadMesh *qm, int *elens, double *uv, int *npts, double **uvs)
 {
   int    i, j, k, m, nx, ny, len, ilast;
   int    cipt[4], *sideptr[4];
   int    ll, lr, ur, ul, j0, jm, i0, im, iv, sav;
   double et, xi, *uvb, *uv0, *uv1, *uv2, *abasis[2];
+  Quad   *quads;
+  Node   *verts;
 
   nx = elens[0];
   ny = elens[1];
@@ -1437,36 +1475,38 @@ EG_quadFillT(int *elens, double *uv, int *npts, double **uvs)
   cipt[ 2] = len;
   len     += nx;
   cipt[ 3] = len;
-  sizes[0] = sizes[2] = nx;
-  sizes[1] = sizes[3] = ny;
+  qm->sizes[0] = qm->sizes[2] = nx;
+  qm->sizes[1] = qm->sizes[3] = ny;
   
   len    = (nx+1)*(ny+1);
-  vpatch = (int *) EG_alloc(len*sizeof(int));
-  if (vpatch == NULL) return -1;
+  qm->vpatch = (int *) EG_alloc(len*sizeof(int));
+  if (qm->vpatch == NULL) return -1;
 
   /* allocate our temporary storage */
 
   len   = nx*ny;
   quads = (Quad *) EG_alloc(len*sizeof(Quad));
   if (quads == NULL) {
-    EG_free(vpatch);
+    EG_free(qm->vpatch);
     return -1;
   }
   len   = (nx+1)*(ny+1) + 1;
   verts = (Node *) EG_alloc(len*sizeof(Node));
   if (verts == NULL) {
     EG_free(quads);
-    EG_free(vpatch);
+    EG_free(qm->vpatch);
     return -1;
   }
-  npatch      = 1;
-  patch[0][0] = nx + 1;
-  patch[0][1] = ny + 1;
+  qm->quads = quads;
+  qm->verts = verts;
+  qm->npatch      = 1;
+  qm->patch[0][0] = nx + 1;
+  qm->patch[0][1] = ny + 1;
 
   /* initialize the vertices */
 
-  nvert = elens[0] + elens[1] + elens[2] + elens[3];
-  for (i = 0; i < nvert; i++) {
+  qm->nvert = elens[0] + elens[1] + elens[2] + elens[3];
+  for (i = 0; i < qm->nvert; i++) {
     verts[i].uv[0] = uv[2*i  ];
     verts[i].uv[1] = uv[2*i+1];
     verts[i].area  = -1.0;
@@ -1476,13 +1516,13 @@ EG_quadFillT(int *elens, double *uv, int *npts, double **uvs)
 
   for (i = 0; i < 4; i++) sideptr[i] = NULL;
   for (j = i = 0; i < 4; i++) {
-    len = sizes[i] + 1;
+    len = qm->sizes[i] + 1;
     sideptr[i] = (int *) EG_alloc(len*sizeof(int));
     if (sideptr[i] == NULL) {
       for (k = 0; k < i; k++) EG_free(sideptr[k]);
       EG_free(verts);
       EG_free(quads);
-      EG_free(vpatch);
+      EG_free(qm->vpatch);
       return -1;
     }
     if (i >= 2) {
@@ -1502,7 +1542,7 @@ EG_quadFillT(int *elens, double *uv, int *npts, double **uvs)
     for (i = 0; i < 4; i++) EG_free(sideptr[i]);
     EG_free(verts);
     EG_free(quads);
-    EG_free(vpatch);
+    EG_free(qm->vpatch);
     return -1;
   }
 
@@ -1512,17 +1552,17 @@ EG_quadFillT(int *elens, double *uv, int *npts, double **uvs)
     for (i = 0; i < 4; i++) EG_free(sideptr[i]);
     EG_free(verts);
     EG_free(quads);
-    EG_free(vpatch);
+    EG_free(qm->vpatch);
     return -1;
   }
 
   /* Finally compute the basis functions */
-  EG_arcBasis(nx, ny, sideptr, abasis);
+  EG_arcBasis(qm, nx, ny, sideptr, abasis);
 
   /* create the quads and get coordinates via TFI */
 
-  nquad = iv = 0;
-  for (i = 0; i < nx+1; i++) last[i] = sideptr[0][i];
+  qm->nquad = iv = 0;
+  for (i = 0; i < nx+1; i++) qm->last[i] = sideptr[0][i];
   ll = cipt[0];
   lr = cipt[1];
   ur = cipt[2];
@@ -1531,60 +1571,60 @@ EG_quadFillT(int *elens, double *uv, int *npts, double **uvs)
     i0    = sideptr[3][j+1];
     im    = sideptr[1][j+1];
     ilast = i0;
-    sav   = nquad;
+    sav   = qm->nquad;
     for (i = 0; i < nx; i++) {
-      quads[nquad].nodes[0] = last[i  ];
-      quads[nquad].nodes[1] = last[i+1];
+      quads[qm->nquad].nodes[0] = qm->last[i  ];
+      quads[qm->nquad].nodes[1] = qm->last[i+1];
       if (j == ny-1) {
-        quads[nquad].nodes[2] = sideptr[2][i+1];
-        quads[nquad].nodes[3] = sideptr[2][i  ];
+        quads[qm->nquad].nodes[2] = sideptr[2][i+1];
+        quads[qm->nquad].nodes[3] = sideptr[2][i  ];
       } else {
         if (i == nx-1) {
-          quads[nquad].nodes[2] = sideptr[1][j+1];
-          last[i]  = ilast;
-          last[nx] = sideptr[1][j+1];
+          quads[qm->nquad].nodes[2] = sideptr[1][j+1];
+          qm->last[i]  = ilast;
+          qm->last[nx] = sideptr[1][j+1];
         } else {
           j0 = sideptr[0][i+1];
           jm = sideptr[2][i+1];
           k  = (i+1)*(ny+1) + (j+1);
           xi = abasis[0][k];
           et = abasis[1][k];
-          quads[nquad].nodes[2] = nvert;
-          verts[nvert].uv[0]    = (1.0-xi)            * verts[i0].uv[0] +
-                                  (    xi)            * verts[im].uv[0] +
-                                             (1.0-et) * verts[j0].uv[0] +
-                                             (    et) * verts[jm].uv[0] -
-                                  (1.0-xi) * (1.0-et) * verts[ll].uv[0] -
-                                  (1.0-xi) * (    et) * verts[ul].uv[0] -
-                                  (    xi) * (1.0-et) * verts[lr].uv[0] -
-                                  (    xi) * (    et) * verts[ur].uv[0];
-          verts[nvert].uv[1]    = (1.0-xi)            * verts[i0].uv[1] +
-                                  (    xi)            * verts[im].uv[1] +
-                                             (1.0-et) * verts[j0].uv[1] +
-                                             (    et) * verts[jm].uv[1] -
-                                  (1.0-xi) * (1.0-et) * verts[ll].uv[1] -
-                                  (1.0-xi) * (    et) * verts[ul].uv[1] -
-                                  (    xi) * (1.0-et) * verts[lr].uv[1] -
-                                  (    xi) * (    et) * verts[ur].uv[1];
-          verts[nvert].area     = 0.0;
-          nvert++;
+          quads[qm->nquad].nodes[2] = qm->nvert;
+          verts[qm->nvert].uv[0]    = (1.0-xi)            * verts[i0].uv[0] +
+                                      (    xi)            * verts[im].uv[0] +
+                                                 (1.0-et) * verts[j0].uv[0] +
+                                                 (    et) * verts[jm].uv[0] -
+                                      (1.0-xi) * (1.0-et) * verts[ll].uv[0] -
+                                      (1.0-xi) * (    et) * verts[ul].uv[0] -
+                                      (    xi) * (1.0-et) * verts[lr].uv[0] -
+                                      (    xi) * (    et) * verts[ur].uv[0];
+          verts[qm->nvert].uv[1]    = (1.0-xi)            * verts[i0].uv[1] +
+                                      (    xi)            * verts[im].uv[1] +
+                                                 (1.0-et) * verts[j0].uv[1] +
+                                                 (    et) * verts[jm].uv[1] -
+                                      (1.0-xi) * (1.0-et) * verts[ll].uv[1] -
+                                      (1.0-xi) * (    et) * verts[ul].uv[1] -
+                                      (    xi) * (1.0-et) * verts[lr].uv[1] -
+                                      (    xi) * (    et) * verts[ur].uv[1];
+          verts[qm->nvert].area     = 0.0;
+          qm->nvert++;
         }
-        quads[nquad].nodes[3] = ilast;
-        last[i] = ilast;
-        ilast   = nvert-1;
+        quads[qm->nquad].nodes[3] = ilast;
+        qm->last[i] = ilast;
+        ilast       = qm->nvert-1;
       }
-      nquad++;
+      qm->nquad++;
     }
     if (j == 0) {
-      vpatch[iv] = quads[sav].nodes[0];
+      qm->vpatch[iv] = quads[sav].nodes[0];
       iv++;
       for (i = 0; i < nx; i++, iv++) 
-        vpatch[iv] = quads[sav+i].nodes[1];
+        qm->vpatch[iv] = quads[sav+i].nodes[1];
     }
-    vpatch[iv] = quads[sav].nodes[3];
+    qm->vpatch[iv] = quads[sav].nodes[3];
     iv++;
     for (i = 0; i < nx; i++, sav++, iv++)
-      vpatch[iv] = quads[sav].nodes[2];
+      qm->vpatch[iv] = quads[sav].nodes[2];
   }
 
   /* free up our basis functions */
@@ -1596,21 +1636,21 @@ EG_quadFillT(int *elens, double *uv, int *npts, double **uvs)
 
   /* get the actual storage that we return the data with */
 
-  uvb = (double *) EG_alloc(2*nvert*sizeof(double));
+  uvb = (double *) EG_alloc(2*qm->nvert*sizeof(double));
   if (uvb == NULL) {
     EG_free(verts);
     EG_free(quads);
-    EG_free(vpatch);
+    EG_free(qm->vpatch);
     return -1;    
   }
 
   /* fill the memory to be returned */
 
-  for (j = 0; j < nvert; j++) {
+  for (j = 0; j < qm->nvert; j++) {
     uvb[2*j  ] = verts[j].uv[0];
     uvb[2*j+1] = verts[j].uv[1];
   }
-  for (k = i = 0; i < nquad; i++) {
+  for (k = i = 0; i < qm->nquad; i++) {
     m   = k;
     uv0 = &uvb[2*quads[i].nodes[0]];
     uv1 = &uvb[2*quads[i].nodes[1]];
@@ -1624,12 +1664,12 @@ EG_quadFillT(int *elens, double *uv, int *npts, double **uvs)
   if (k != 0) {
 #ifdef DEBUG
     printf(" Bad mapping: %d non-positive of %d quads\n", 
-           k, nquad);
+           k, qm->nquad);
 #endif
     EG_free(uvb);
     EG_free(verts);
     EG_free(quads);
-    EG_free(vpatch);
+    EG_free(qm->vpatch);
     *npts = 0;
     *uvs  = NULL;
     return -6;
@@ -1637,7 +1677,7 @@ EG_quadFillT(int *elens, double *uv, int *npts, double **uvs)
 
   /* cleanup and exit */
 
-  *npts = nvert;
+  *npts = qm->nvert;
   *uvs  = uvb;
   EG_free(verts);
   EG_free(quads);
@@ -1687,13 +1727,18 @@ EG_quadFill(const egObject *face, double *parms, int *elens, double *uv,
   int    i, j, k, m, N, M, P, Q, len, ret, lens[4], *indices;
   int    outLevel, iv, nx, save, align = 0, nsp = 0;
   double *uvx, *uv0, *uv1, *uv2, dist, sav[2], xylim[2][2], slim[4][2][2];
-  double edgeTOL = 0.05, sideRAT = 3.0;
-
-  *npts    = *npat = 0;
-  *uvs     = NULL;
-  *vpats   = NULL;
-  flip     = 1.0;
-  outLevel = EG_outLevel(face);
+  double   edgeTOL = 0.05, sideRAT = 3.0;
+  quadMesh qm;
+
+  *npts     = *npat = 0;
+  *uvs      = NULL;
+  *vpats    = NULL;
+  qm.quads  = NULL;
+  qm.verts  = NULL;
+  qm.vpatch = NULL;
+  qm.nvert  = qm.nquad = qm.npatch = 0;
+  qm.flip   = 1.0;
+  outLevel  = EG_outLevel(face);
 
   /* note: all zeros gives the default values */
   if ((parms[0] >= 0.001) && (parms[0] <= 0.5)) edgeTOL = parms[0];
@@ -1703,12 +1748,12 @@ EG_quadFill(const egObject *face, double *parms, int *elens, double *uv,
   /* can we use a simple TFI scheme? */
 
   if ((elens[0] == elens[2]) && (elens[1] == elens[3])) {
-    ret = EG_quadFillT(elens, uv, npts, uvs);
+    ret = EG_quadFillT(&qm, elens, uv, npts, uvs);
     if (ret != EGADS_SUCCESS) return ret;
-    *npat   = npatch;
-    pats[0] = patch[0][0];
-    pats[1] = patch[0][1];
-    *vpats  = vpatch;
+    *npat   = qm.npatch;
+    pats[0] = qm.patch[0][0];
+    pats[1] = qm.patch[0][1];
+    *vpats  = qm.vpatch;
     return EGADS_SUCCESS;
   } else if ((elens[0] == elens[2]) && (abs(elens[1]-elens[3]) == 1)) {
     if (outLevel > 0)
@@ -1943,7 +1988,7 @@ EG_quadFill(const egObject *face, double *parms, int *elens, double *uv,
     i       = lens[3];
     lens[3] = lens[1];
     lens[1] = i;
-    flip    = -1.0;
+    qm.flip = -1.0;
   }
 
   /* get the template & go */
@@ -1968,11 +2013,11 @@ EG_quadFill(const egObject *face, double *parms, int *elens, double *uv,
   }
 
   if (P == 0) {
-    ret = EG_quadFillQ(face, nsp, indices, lens, uvx, npts, uvs);
+    ret = EG_quadFillQ(&qm, face, nsp, indices, lens, uvx, npts, uvs);
   } else if (Q == 0) {
-    ret = EG_quadFillP(face, nsp, indices, lens, uvx, npts, uvs);
+    ret = EG_quadFillP(&qm, face, nsp, indices, lens, uvx, npts, uvs);
   } else {
-    ret = EG_quadFillG(face, nsp, indices, lens, uvx, npts, uvs);
+    ret = EG_quadFillG(&qm, face, nsp, indices, lens, uvx, npts, uvs);
   }
   for (i = 0; i < len; i++) {
     j         = len+i+1;
@@ -1988,8 +2033,8 @@ EG_quadFill(const egObject *face, double *parms, int *elens, double *uv,
     ret = EG_dQuadTFI(elens, uv, *npts, *uvs);
     if (ret != 0) {
       EG_free(*uvs);
-      EG_free(quads);
-      EG_free(vpatch);
+      EG_free(qm.quads);
+      EG_free(qm.vpatch);
       *npts = 0;
       *uvs  = NULL;
     }
@@ -1999,15 +2044,15 @@ EG_quadFill(const egObject *face, double *parms, int *elens, double *uv,
 
   uvx = *uvs;
   if (uvx == NULL) return -99;
-  if ((ret == 0) && (flip < 0.0))
-    for (iv = k = 0; k < npatch; k++) {
-      nx = patch[k][0];
-      for (j = 0; j < patch[k][1]; j++) {
+  if ((ret == 0) && (qm.flip < 0.0))
+    for (iv = k = 0; k < qm.npatch; k++) {
+      nx = qm.patch[k][0];
+      for (j = 0; j < qm.patch[k][1]; j++) {
         for (i = 0; i < nx/2; i++) {
           m            = nx - i - 1;
-          save         = vpatch[iv+i];
-          vpatch[iv+i] = vpatch[iv+m];
-          vpatch[iv+m] = save;
+          save            = qm.vpatch[iv+i];
+          qm.vpatch[iv+i] = qm.vpatch[iv+m];
+          qm.vpatch[iv+m] = save;
         }
         iv += nx;
       }
@@ -2016,28 +2061,28 @@ EG_quadFill(const egObject *face, double *parms, int *elens, double *uv,
   /* make sure we are OK */
 
   if (ret == 0) {
-    for (k = i = 0; i < nquad; i++) {
+    for (k = i = 0; i < qm.nquad; i++) {
       m    = k;
-      uv0  = &uvx[2*quads[i].nodes[0]];
-      uv1  = &uvx[2*quads[i].nodes[1]];
-      uv2  = &uvx[2*quads[i].nodes[2]];
-      dist = AREA2D(uv0, uv1, uv2)*flip;
+      uv0  = &uvx[2*qm.quads[i].nodes[0]];
+      uv1  = &uvx[2*qm.quads[i].nodes[1]];
+      uv2  = &uvx[2*qm.quads[i].nodes[2]];
+      dist = AREA2D(uv0, uv1, uv2)*qm.flip;
       if (dist*0.0 != 0.0) k++;		/* special Nan, Ind, ... checker */
       if (dist     <= 0.0) k++;
       if (m != k) continue;
-      uv1 = &uvx[2*quads[i].nodes[2]];
-      uv2 = &uvx[2*quads[i].nodes[3]];
-      dist = AREA2D(uv0, uv1, uv2)*flip;
+      uv1 = &uvx[2*qm.quads[i].nodes[2]];
+      uv2 = &uvx[2*qm.quads[i].nodes[3]];
+      dist = AREA2D(uv0, uv1, uv2)*qm.flip;
       if (dist*0.0 != 0.0) k++;
       if (dist     <= 0.0) k++;
     }
-    EG_free(quads);
+    EG_free(qm.quads);
     if (k != 0) {
       if (outLevel > 0)
         printf(" EGADS Info: Bad mapping - %d non-positive of %d quads\n",
-               k, nquad);
+               k, qm.nquad);
       EG_free(*uvs);
-      EG_free(vpatch);
+      EG_free(qm.vpatch);
       *npts = 0;
       *uvs  = NULL;
       return -6;
@@ -2045,12 +2090,12 @@ EG_quadFill(const egObject *face, double *parms, int *elens, double *uv,
   }
 
   if (ret == 0) {
-    for (k = 0; k < npatch; k++) {
-      pats[2*k  ] = patch[k][0];
-      pats[2*k+1] = patch[k][1];
+    for (k = 0; k < qm.npatch; k++) {
+      pats[2*k  ] = qm.patch[k][0];
+      pats[2*k+1] = qm.patch[k][1];
     }
-    *npat  = npatch;
-    *vpats = vpatch;
+    *npat  = qm.npatch;
+    *vpats = qm.vpatch;
   }
 
   return ret;
@@ -0,0 +1,269 @@
+/*
+ *      EGADS: Electronic Geometry Aircraft Design System
+ *
+ *             Native (non-rational) B-Spline Evaluation Functions
+ *
+ *      Copyright 2011-2012, Massachusetts Institute of Technology
+ *      Licensed under The GNU Lesser General Public License, version 2.1
+ *      See http://www.opensource.org/licenses/lgpl-2.1.php
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "egadsTypes.h"
+#include "egadsInternals.h"
+#include "egadsSpline.h"
+
+
+/* the flat data is the same as returned by EG_getGeometry:
+ *   curve   -- ivec = {flags, degree, nCP, nKnots}
+ *   surface -- ivec = {flags, uDegree, nUCP, nUKnots, vDegree, nVCP, nVKnots}
+ *   rvec    -- the knots (u then v) followed by the xyz control points
+ * only non-rational & non-periodic splines are handled
+ */
+
+int
+EG_splineMake(int nParam, const int *ivec, const double *rvec,
+              egSpline **spline)
+{
+  int      i, j, len, ncp;
+  egSpline *spl;
+
+  *spline = NULL;
+  if ((nParam != 1) && (nParam != 2)) return EGADS_RANGERR;
+  if ((ivec[0] & 2) != 0)             return EGADS_NOTFOUND;
+  if ((ivec[0] & 12) != 0)            return EGADS_NOTFOUND;
+
+  spl = (egSpline *) EG_alloc(sizeof(egSpline));
+  if (spl == NULL) return EGADS_MALLOC;
+  spl->nParam    = nParam;
+  spl->degree[1] = spl->ncp[1] = spl->nknot[1] = 0;
+  spl->knots[1]  = NULL;
+  for (i = 0; i < nParam; i++) {
+    spl->degree[i] = ivec[3*i+1];
+    spl->ncp[i]    = ivec[3*i+2];
+    spl->nknot[i]  = ivec[3*i+3];
+    if ((spl->degree[i] < 1) || (spl->degree[i] > MAXSPLDEG) ||
+        (spl->nknot[i] != spl->ncp[i]+spl->degree[i]+1)) {
+      EG_free(spl);
+      return EGADS_NOTFOUND;
+    }
+  }
+  ncp = spl->ncp[0];
+  if (nParam == 2) ncp *= spl->ncp[1];
+
+  len       = spl->nknot[0] + spl->nknot[1] + 3*ncp;
+  spl->data = (double *) EG_alloc(len*sizeof(double));
+  if (spl->data == NULL) {
+    EG_free(spl);
+    return EGADS_MALLOC;
+  }
+  for (i = 0; i < len; i++) spl->data[i] = rvec[i];
+  spl->knots[0] = spl->data;
+  if (nParam == 2) spl->knots[1] = spl->data + spl->nknot[0];
+  spl->cps = spl->data + spl->nknot[0] + spl->nknot[1];
+
+  /* the valid knot range must not collapse */
+  for (i = 0; i < nParam; i++) {
+    j = spl->ncp[i];
+    if (spl->knots[i][spl->degree[i]] >= spl->knots[i][j]) {
+      EG_splineFree(spl);
+      return EGADS_NOTFOUND;
+    }
+  }
+
+  *spline = spl;
+  return EGADS_SUCCESS;
+}
+
+
+void
+EG_splineFree(egSpline *spline)
+{
+  if (spline == NULL) return;
+  EG_free(spline->data);
+  EG_free(spline);
+}
+
+
+/* find the knot span -- outside the range the end spans are extended */
+
+static int
+EG_findSpan(int ncp, int deg, double t, const double *knots)
+{
+  int low, high, mid;
+
+  if (t >= knots[ncp]) {
+    mid = ncp-1;
+    while (knots[mid] == knots[mid+1]) mid--;
+    return mid;
+  }
+  if (t <= knots[deg]) {
+    mid = deg;
+    while (knots[mid] == knots[mid+1]) mid++;
+    return mid;
+  }
+
+  low  = deg;
+  high = ncp;
+  mid  = (low+high)/2;
+  while ((t < knots[mid]) || (t >= knots[mid+1])) {
+    if (t < knots[mid]) {
+      high = mid;
+    } else {
+      low  = mid;
+    }
+    mid = (low+high)/2;
+  }
+  return mid;
+}
+
+
+/* basis functions & derivatives up to nder (The NURBS Book, A2.3)
+ *   ders is [nder+1][MAXSPLDEG+1] */
+
+static void
+EG_basisDers(int span, double t, int deg, int nder, const double *knots,
+             double ders[][MAXSPLDEG+1])
+{
+  int    j, k, r, s1, s2, rk, pk, j1, j2, nd;
+  double saved, temp, d, left[MAXSPLDEG+1], right[MAXSPLDEG+1];
+  double ndu[MAXSPLDEG+1][MAXSPLDEG+1], a[2][MAXSPLDEG+1];
+
+  ndu[0][0] = 1.0;
+  for (j = 1; j <= deg; j++) {
+    left[j]  = t - knots[span+1-j];
+    right[j] = knots[span+j] - t;
+    saved    = 0.0;
+    for (r = 0; r < j; r++) {
+      ndu[j][r] = right[r+1] + left[j-r];
+      temp      = ndu[r][j-1]/ndu[j][r];
+      ndu[r][j] = saved + right[r+1]*temp;
+      saved     = left[j-r]*temp;
+    }
+    ndu[j][j] = saved;
+  }
+  for (j = 0; j <= deg; j++) ders[0][j] = ndu[j][deg];
+
+  /* derivatives above the degree are zero */
+  nd = nder;
+  if (nd > deg) nd = deg;
+  for (k = nd+1; k <= nder; k++)
+    for (j = 0; j <= deg; j++) ders[k][j] = 0.0;
+  if (nd == 0) return;
+
+  for (r = 0; r <= deg; r++) {
+    s1      = 0;
+    s2      = 1;
+    a[0][0] = 1.0;
+    for (k = 1; k <= nd; k++) {
+      d  = 0.0;
+      rk = r - k;
+      pk = deg - k;
+      if (r >= k) {
+        a[s2][0] = a[s1][0]/ndu[pk+1][rk];
+        d        = a[s2][0]*ndu[rk][pk];
+      }
+      j1 = (rk >= -1)  ? 1   : -rk;
+      j2 = (r-1 <= pk) ? k-1 : deg-r;
+      for (j = j1; j <= j2; j++) {
+        a[s2][j] = (a[s1][j] - a[s1][j-1])/ndu[pk+1][rk+j];
+        d       += a[s2][j]*ndu[rk+j][pk];
+      }
+      if (r <= pk) {
+        a[s2][k] = -a[s1][k-1]/ndu[pk+1][r];
+        d       += a[s2][k]*ndu[r][pk];
+      }
+      ders[k][r] = d;
+      j  = s1;
+      s1 = s2;
+      s2 = j;
+    }
+  }
+
+  r = deg;
+  for (k = 1; k <= nd; k++) {
+    for (j = 0; j <= deg; j++) ders[k][j] *= r;
+    r *= deg - k;
+  }
+}
+
+
+/* evaluate npts parameters -- the results are laid out as EG_evaluateMany:
+ *   curve   -- position then derivatives, 3*(deriv+1) per point
+ *   surface -- position, u & v derivs, then uu, uv & vv (3, 9 or 18) */
+
+void
+EG_splineEval(const egSpline *spl, int deriv, int npts, const double *params,
+              double *results)
+{
+  int    i, j, k, l, m, ip, span, vspan, pu, pv, nu, stride;
+  double Nu[3][MAXSPLDEG+1], Nv[3][MAXSPLDEG+1], tmp[3][MAXSPLDEG+1][3];
+  double *res;
+  const double *cp;
+
+  pu = spl->degree[0];
+  nu = spl->ncp[0];
+
+  if (spl->nParam == 1) {
+
+    stride = 3*(deriv+1);
+    for (ip = 0; ip < npts; ip++) {
+      res  = &results[stride*ip];
+      span = EG_findSpan(nu, pu, params[ip], spl->knots[0]);
+      EG_basisDers(span, params[ip], pu, deriv, spl->knots[0], Nu);
+      for (k = 0; k <= deriv; k++) {
+        res[3*k] = res[3*k+1] = res[3*k+2] = 0.0;
+        for (j = 0; j <= pu; j++) {
+          cp          = &spl->cps[3*(span-pu+j)];
+          res[3*k  ] += Nu[k][j]*cp[0];
+          res[3*k+1] += Nu[k][j]*cp[1];
+          res[3*k+2] += Nu[k][j]*cp[2];
+        }
+      }
+    }
+    return;
+  }
+
+  stride = 3;
+  if (deriv == 1) stride =  9;
+  if (deriv == 2) stride = 18;
+  pv = spl->degree[1];
+  for (ip = 0; ip < npts; ip++) {
+    res   = &results[stride*ip];
+    span  = EG_findSpan(nu,         pu, params[2*ip  ], spl->knots[0]);
+    vspan = EG_findSpan(spl->ncp[1], pv, params[2*ip+1], spl->knots[1]);
+    EG_basisDers(span,  params[2*ip  ], pu, deriv, spl->knots[0], Nu);
+    EG_basisDers(vspan, params[2*ip+1], pv, deriv, spl->knots[1], Nv);
+
+    /* contract in u for each row of the local net */
+    for (l = 0; l <= pv; l++)
+      for (k = 0; k <= deriv; k++) {
+        tmp[k][l][0] = tmp[k][l][1] = tmp[k][l][2] = 0.0;
+        cp = &spl->cps[3*((vspan-pv+l)*nu + span-pu)];
+        for (j = 0; j <= pu; j++, cp += 3) {
+          tmp[k][l][0] += Nu[k][j]*cp[0];
+          tmp[k][l][1] += Nu[k][j]*cp[1];
+          tmp[k][l][2] += Nu[k][j]*cp[2];
+        }
+      }
+
+    /* then in v -- (k,m) is d^k/du^k d^m/dv^m */
+    for (i = 0; i < stride/3; i++) {
+      if (i == 0) { k = 0; m = 0; }
+      if (i == 1) { k = 1; m = 0; }
+      if (i == 2) { k = 0; m = 1; }
+      if (i == 3) { k = 2; m = 0; }
+      if (i == 4) { k = 1; m = 1; }
+      if (i == 5) { k = 0; m = 2; }
+      res[3*i] = res[3*i+1] = res[3*i+2] = 0.0;
+      for (l = 0; l <= pv; l++) {
+        res[3*i  ] += Nv[m][l]*tmp[k][l][0];
+        res[3*i+1] += Nv[m][l]*tmp[k][l][1];
+        res[3*i+2] += Nv[m][l]*tmp[k][l][2];
+      }
+    }
+  }
+}
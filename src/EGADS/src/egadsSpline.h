@@ -0,0 +1,48 @@
+#ifndef EGADSSPLINE_H
+#define EGADSSPLINE_H
+/*
+ *      EGADS: Electronic Geometry Aircraft Design System
+ *
+ *             Native B-Spline Evaluation Header
+ *
+ *      Copyright 2011-2012, Massachusetts Institute of Technology
+ *      Licensed under The GNU Lesser General Public License, version 2.1
+ *      See http://www.opensource.org/licenses/lgpl-2.1.php
+ *
+ */
+
+#define MAXSPLDEG 25            /* largest degree handled (same as OCC) */
+
+
+  typedef struct {
+    int    nParam;              /* 1 - curve, 2 - surface */
+    int    degree[2];           /* degree in t (or u) & v */
+    int    ncp[2];              /* number of control points in t (u) & v */
+    int    nknot[2];            /* length of the flat knot sequences */
+    double *knots[2];           /* knots (point into data) */
+    double *cps;                /* xyz control net -- u runs fastest */
+    double *data;               /* the single allocation */
+  } egSpline;
+
+
+#ifdef __ProtoExt__
+#undef __ProtoExt__
+#endif
+#ifdef __cplusplus
+extern "C" {
+#define __ProtoExt__
+#else
+#define __ProtoExt__ extern
+#endif
+
+__ProtoExt__ int  EG_splineMake( int nParam, const int *ivec,
+                                 const double *rvec, egSpline **spline );
+__ProtoExt__ void EG_splineFree( /*@null@*/ /*@only@*/ egSpline *spline );
+__ProtoExt__ void EG_splineEval( const egSpline *spline, int deriv, int npts,
+                                 const double *params, double *results );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
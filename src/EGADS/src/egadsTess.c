@@ -23,7 +23,8 @@
 #define NOTFILLED	-1
 #define TOL		 1.e-7
 #define PI               3.14159265358979324
-#define MAXELEN          1024                   /* max Edge length */
+#define MAXELEN          1024                   /* default max Edge length */
+#define FACELOCKS        16                     /* surface locks (threads) */
 
 
 #define AREA2D(a,b,c)   ((a[0]-c[0])*(b[1]-c[1]) - (a[1]-c[1])*(b[0]-c[0]))
@@ -68,6 +69,71 @@
     int thread;                 /* thread to next face with 1st node number */
   } connect;
 
+  typedef struct {
+    egObject *body;             /* the Body being tessellated */
+    egObject *tess;             /* the Tessellation Object */
+    egObject **faces;           /* the Body's Faces */
+    int      nface;             /* number of Faces */
+    /*@null@*/
+    int      *marker;           /* Faces to fill (NULL for all) */
+    int      next;              /* next Face index to hand out */
+    /*@null@*/
+    void     *mutex;            /* lock for next (NULL when serial) */
+    /*@null@*/
+    int      *group;            /* shared surface group (NULL when serial) */
+    void     *slocks[FACELOCKS];/* surface group locks (NULL when serial) */
+    double   params[3];         /* tessellation parameters */
+  } faceWork;
+
+  typedef struct {
+    egTessel *btess;            /* the Tessellation being quadded */
+    egObject **faces;           /* the Body's Faces */
+    int      nface;             /* number of Faces */
+    int      *marker;           /* Faces to quad (non-zero) */
+    int      next;              /* next Face index to hand out */
+    int      nquad;             /* number of Faces successfully quadded */
+    int      outLevel;          /* output level */
+    /*@null@*/
+    void     *mutex;            /* lock for next & nquad (NULL when serial) */
+    /*@null@*/
+    int      *group;            /* shared surface group (NULL when serial) */
+    void     *slocks[FACELOCKS];/* surface group locks (NULL when serial) */
+    double   *parms;            /* quad parameters */
+  } quadWork;
+
+  typedef struct {
+    int      mpts;              /* length of the point buffers */
+    double   (*xyz)[3];         /* Edge coordinates */
+    double   *t;                /* Edge parameters */
+    double   (*aux)[3];         /* auxiliary data for the refinement */
+  } edgeBuf;
+
+  typedef struct {
+    egTessel *btess;            /* the Tessellation being filled */
+    egObject **edges;           /* the Body's Edges */
+    egObject **faces;           /* the Body's Faces */
+    int      nedge;             /* number of Edges */
+    /*@null@*/
+    int      *retess;           /* Edges to do (NULL for all) */
+    int      next;              /* next Edge index to hand out */
+    int      nbuf;              /* next point buffer to hand out */
+    edgeBuf  *bufs;             /* a point buffer for each thread */
+    int      maxpts;            /* maximum number of points on an Edge */
+    int      stat;              /* status of the first failing Edge */
+    int      err;               /* the first failing Edge index (or -1) */
+    /*@null@*/
+    void     *mutex;            /* lock for the above (NULL when serial) */
+    void     *flocks[FACELOCKS];/* Face surface locks (NULL when serial) */
+    /*@null@*/
+    int      *fslot;            /* lock slot for each Face (NULL - serial) */
+    double   dotnrm;            /* Face normal dot product limit */
+  } edgeWork;
+
+  typedef struct {
+    const void *key;            /* the OCC surface */
+    int        index;           /* the Face (bias 0) */
+  } surfKey;
+
 
   extern int EG_getTolerance( const egObject *topo, double *tol );
   extern int EG_getBodyTopos( const egObject *body, /*@null@*/ egObject *src,
@@ -82,6 +148,7 @@
   extern int EG_invEvaluate( const egObject *geom, double *xyz, double *param, 
                              double *result );
                                  
+  extern const void *EG_geomKey( const egObject *geom );
   extern int EG_tessellate( int outLevel, triStruct *ts );
   extern int EG_quadFill( const egObject *face, double *parms, int *elens, 
                           double *uv, int *npts, double **uvs, int *npat, 
@@ -105,6 +172,66 @@ EG_faceConnIndex(egFconn conn, int face)
 }
 
 
+/* Face & Edge discretization storage -- a single block for each with the
+ *   doubles first (xyz, uv or t) and the ints after; xyz is the block */
+
+int
+EG_allocTess2D(egTess2D *tess2d, int npts, int ntris)
+{
+  double *block;
+
+  tess2d->xyz    = tess2d->uv   = NULL;
+  tess2d->ptype  = tess2d->pindex = NULL;
+  tess2d->tris   = tess2d->tric = NULL;
+  if (npts <= 0) return EGADS_SUCCESS;
+
+  block = (double *) EG_alloc(5*npts*sizeof(double) + 
+                              (2*npts + 6*ntris)*sizeof(int));
+  if (block == NULL) return EGADS_MALLOC;
+  tess2d->xyz    = block;
+  tess2d->uv     = &block[3*npts];
+  tess2d->ptype  = (int *) &block[5*npts];
+  tess2d->pindex = &tess2d->ptype[npts];
+  if (ntris <= 0) return EGADS_SUCCESS;
+  tess2d->tris   = &tess2d->ptype[2*npts];
+  tess2d->tric   = &tess2d->tris[3*ntris];
+
+  return EGADS_SUCCESS;
+}
+
+
+void
+EG_freeTess2D(egTess2D *tess2d)
+{
+  if (tess2d->xyz != NULL) EG_free(tess2d->xyz);
+  tess2d->xyz    = tess2d->uv   = NULL;
+  tess2d->ptype  = tess2d->pindex = NULL;
+  tess2d->tris   = tess2d->tric = NULL;
+}
+
+
+int
+EG_allocTess1D(egTess1D *tess1d, int npts)
+{
+  tess1d->xyz = tess1d->t = NULL;
+  if (npts <= 0) return EGADS_SUCCESS;
+
+  tess1d->xyz = (double *) EG_alloc(4*npts*sizeof(double));
+  if (tess1d->xyz == NULL) return EGADS_MALLOC;
+  tess1d->t   = &tess1d->xyz[3*npts];
+
+  return EGADS_SUCCESS;
+}
+
+
+void
+EG_freeTess1D(egTess1D *tess1d)
+{
+  if (tess1d->xyz != NULL) EG_free(tess1d->xyz);
+  tess1d->xyz = tess1d->t = NULL;
+}
+
+
 #ifdef CHECK
 static void
 EG_checkTriangulation(egTessel *btess)
@@ -974,27 +1101,21 @@ EG_makeNeighbors(triStruct *ts, int f)
 static void
 EG_updateTris(triStruct *ts, egTessel *btess, int fIndex)
 {
-  int    i, j, k, m, n, nf, edge, *ptype, *pindex, *tris, *tric;
-  double *xyz, *uv;
+  int      i, j, k, m, n, nf, edge, *ptype, *pindex, *tris, *tric;
+  double   *xyz, *uv;
+  egTess2D ftess;
   
-  xyz    = (double *) EG_alloc(3*ts->nverts*sizeof(double));
-  uv     = (double *) EG_alloc(2*ts->nverts*sizeof(double));
-  ptype  = (int *)    EG_alloc(  ts->nverts*sizeof(int));
-  pindex = (int *)    EG_alloc(  ts->nverts*sizeof(int));
-  tris   = (int *)    EG_alloc(3*ts->ntris* sizeof(int));
-  tric   = (int *)    EG_alloc(3*ts->ntris* sizeof(int));
-  if ((xyz    == NULL) || (uv   == NULL) || (ptype == NULL) ||
-      (pindex == NULL) || (tris == NULL) || (tric  == NULL)) {
+  if (EG_allocTess2D(&ftess, ts->nverts, ts->ntris) != EGADS_SUCCESS) {
     printf(" EGADS Error: Cannot Allocate Tessellation Memory for %d!\n",
            fIndex);
-    if (tric   != NULL) EG_free(tric);
-    if (tris   != NULL) EG_free(tris);
-    if (pindex != NULL) EG_free(pindex);
-    if (ptype  != NULL) EG_free(ptype);
-    if (uv     != NULL) EG_free(uv);
-    if (xyz    != NULL) EG_free(xyz);
     return;
   }
+  xyz    = ftess.xyz;
+  uv     = ftess.uv;
+  ptype  = ftess.ptype;
+  pindex = ftess.pindex;
+  tris   = ftess.tris;
+  tric   = ftess.tric;
 
   /* fix up the vertices */
 
@@ -1183,6 +1304,502 @@ EG_getTessFace(const egObject *tess, int index, int *len, const double **xyz,
 }
 
 
+/* free the global numbering (it is rebuilt when next asked for) */
+
+void
+EG_freeTessGlobal(egTessel *btess)
+{
+  egTessGlobal *global;
+
+  global = btess->global;
+  if (global == NULL) return;
+  btess->global = NULL;
+  if (global->xyz   != NULL) EG_free(global->xyz);
+  if (global->ptype != NULL) EG_free(global->ptype);
+  EG_free(global);
+}
+
+
+/* build the watertight vertex numbering over all of the Face tessellations
+ *   Nodes & Edge vertices are shared between Faces, Face interiors are not;
+ *   all of the integer arrays are carved from a single block at ptype */
+
+static int
+EG_buildTessGlobal(const egTessel *btess, egTessGlobal **global)
+{
+  int          i, j, k, e, n, nn, nf, nt, nvert, *nmap, *eoff, *emap, *iblock;
+  egTess2D     *tess2d;
+  egTessGlobal *glob;
+
+  *global = NULL;
+
+  /* Node & Edge-interior lookups from the Edge tessellations */
+  for (nn = i = 0; i < btess->nEdge; i++) {
+    if (btess->tess1d[i].nodes[0] > nn) nn = btess->tess1d[i].nodes[0];
+    if (btess->tess1d[i].nodes[1] > nn) nn = btess->tess1d[i].nodes[1];
+  }
+  eoff = (int *) EG_alloc((btess->nEdge+nn+2)*sizeof(int));
+  if (eoff == NULL) return EGADS_MALLOC;
+  nmap    = &eoff[btess->nEdge+1];
+  eoff[0] = 0;
+  for (i = 0; i < btess->nEdge; i++) {
+    n = btess->tess1d[i].npts - 2;
+    if (n < 0) n = 0;
+    eoff[i+1] = eoff[i] + n;
+  }
+  for (i = 0; i <= nn; i++) nmap[i] = 0;
+  emap = NULL;
+  if (eoff[btess->nEdge] != 0) {
+    emap = (int *) EG_alloc(eoff[btess->nEdge]*sizeof(int));
+    if (emap == NULL) {
+      EG_free(eoff);
+      return EGADS_MALLOC;
+    }
+    for (i = 0; i < eoff[btess->nEdge]; i++) emap[i] = 0;
+  }
+  for (nf = nt = i = 0; i < btess->nFace; i++) {
+    nf += btess->tess2d[i].npts;
+    nt += btess->tess2d[i].ntris;
+  }
+
+  glob = (egTessGlobal *) EG_alloc(sizeof(egTessGlobal));
+  if (glob == NULL) {
+    if (emap != NULL) EG_free(emap);
+    EG_free(eoff);
+    return EGADS_MALLOC;
+  }
+  glob->xyz   = NULL;
+  glob->ptype = NULL;
+  glob->nvert = 0;
+  glob->ntri  = nt;
+  /* ptype & pindex are sized after the numbering -- bound them by nf */
+  iblock = (int *) EG_alloc((2*nf + 3*nt + nf + 2*btess->nFace+2)*
+                            sizeof(int));
+  if (iblock == NULL) {
+    EG_free(glob);
+    if (emap != NULL) EG_free(emap);
+    EG_free(eoff);
+    return EGADS_MALLOC;
+  }
+  glob->ptype  = iblock;
+  glob->pindex = &iblock[nf];
+  glob->tris   = &iblock[2*nf];
+  glob->fmap   = &iblock[2*nf+3*nt];
+  glob->foff   = &iblock[3*nf+3*nt];
+
+  /* number the vertices in Face order -- first touch wins */
+  nvert = 0;
+  glob->foff[0]              = 0;
+  glob->foff[btess->nFace+1] = 0;
+  for (i = 0; i < btess->nFace; i++) {
+    tess2d = &btess->tess2d[i];
+    k      = glob->foff[i];
+    for (j = 0; j < tess2d->npts; j++, k++) {
+      if (tess2d->ptype[j] < 0) {
+        glob->ptype[nvert]  = -1;
+        glob->pindex[nvert] = i+1;
+        glob->fmap[k]       = ++nvert;
+        continue;
+      }
+      if (tess2d->ptype[j] == 0) {
+        n = tess2d->pindex[j];
+      } else {
+        e = tess2d->pindex[j] - 1;
+        n = tess2d->ptype[j];
+        if ((n > 1) && (n < btess->tess1d[e].npts)) {
+          if (emap[eoff[e]+n-2] == 0) {
+            glob->ptype[nvert]  = n;
+            glob->pindex[nvert] = e+1;
+            emap[eoff[e]+n-2]   = ++nvert;
+          }
+          glob->fmap[k] = emap[eoff[e]+n-2];
+          continue;
+        }
+        /* an Edge end is its Node */
+        n = btess->tess1d[e].nodes[(n == 1) ? 0 : 1];
+      }
+      if (nmap[n] == 0) {
+        glob->ptype[nvert]  = 0;
+        glob->pindex[nvert] = n;
+        nmap[n]             = ++nvert;
+      }
+      glob->fmap[k] = nmap[n];
+    }
+    glob->foff[i+1] = k;
+
+    k = glob->foff[btess->nFace+1+i];
+    for (j = 0; j < 3*tess2d->ntris; j++)
+      glob->tris[3*k+j] = glob->fmap[glob->foff[i]+tess2d->tris[j]-1];
+    glob->foff[btess->nFace+2+i] = k + tess2d->ntris;
+  }
+  if (emap != NULL) EG_free(emap);
+  EG_free(eoff);
+  glob->nvert = nvert;
+
+  /* the coordinates from the first Face vertex seen */
+  if (nvert != 0) {
+    glob->xyz = (double *) EG_alloc(3*nvert*sizeof(double));
+    if (glob->xyz == NULL) {
+      EG_free(iblock);
+      EG_free(glob);
+      return EGADS_MALLOC;
+    }
+  }
+  for (n = i = 0; i < btess->nFace; i++) {
+    tess2d = &btess->tess2d[i];
+    for (j = 0; j < tess2d->npts; j++) {
+      k = glob->fmap[glob->foff[i]+j];
+      if (k <= n) continue;
+      glob->xyz[3*k-3] = tess2d->xyz[3*j  ];
+      glob->xyz[3*k-2] = tess2d->xyz[3*j+1];
+      glob->xyz[3*k-1] = tess2d->xyz[3*j+2];
+      n = k;
+    }
+  }
+
+  *global = glob;
+  return EGADS_SUCCESS;
+}
+
+
+/* check that this is a Body Tessellation (with Edges) */
+
+static int
+EG_bodyTessel(const egObject *tess, const char *func, egTessel **bt)
+{
+  int      outLevel;
+  egTessel *btess;
+  egObject *obj;
+
+  *bt = NULL;
+  if (tess == NULL)                 return EGADS_NULLOBJ;
+  if (tess->magicnumber != MAGIC)   return EGADS_NOTOBJ;
+  if (tess->oclass != TESSELLATION) return EGADS_NOTTESS;
+  outLevel = EG_outLevel(tess);
+  
+  btess = (egTessel *) tess->blind;
+  if (btess == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: NULL Blind Object (%s)!\n", func);  
+    return EGADS_NOTFOUND;
+  }
+  obj = btess->src;
+  if (obj == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: NULL Source Object (%s)!\n", func);
+    return EGADS_NULLOBJ;
+  }
+  if (obj->magicnumber != MAGIC) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Source Not an Object (%s)!\n", func);
+    return EGADS_NOTOBJ;
+  }
+  if (obj->oclass != BODY) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Source Not Body (%s)!\n", func);
+    return EGADS_NOTBODY;
+  }
+  if (btess->tess1d == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: No Edge Tessellations (%s)!\n", func);
+    return EGADS_NODATA;  
+  }
+
+  *bt = btess;
+  return EGADS_SUCCESS;
+}
+
+
+/* check the Body Tessellation and get (building once) its global numbering */
+
+static int
+EG_getTessGlobal(const egObject *tess, const char *func, 
+                 egTessGlobal **global)
+{
+  int          stat, outLevel;
+  egTessel     *btess;
+  egTessGlobal *glob;
+  egObject     *context;
+  egCntxt      *cntx;
+
+  *global = NULL;
+  stat = EG_bodyTessel(tess, func, &btess);
+  if (stat != EGADS_SUCCESS) return stat;
+  outLevel = EG_outLevel(tess);
+  if (btess->tess2d == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: No Face Tessellations (%s)!\n", func);
+    return EGADS_NODATA;  
+  }
+  if (btess->global != NULL) {
+    *global = btess->global;
+    return EGADS_SUCCESS;
+  }
+  
+  stat = EG_buildTessGlobal(btess, &glob);
+  if (stat != EGADS_SUCCESS) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Global Numbering = %d (%s)!\n", stat, func);
+    return stat;
+  }
+  
+  /* another thread may have beaten us to it */
+  context = EG_context(tess);
+  cntx    = NULL;
+  if (context != NULL) cntx = (egCntxt *) context->blind;
+  if (cntx != NULL) EG_mutexLock(cntx->mutex);
+  if (btess->global == NULL) {
+    btess->global = glob;
+    glob          = NULL;
+  }
+  if (cntx != NULL) EG_mutexUnlock(cntx->mutex);
+  if (glob != NULL) {
+    EG_free(glob->xyz);
+    EG_free(glob->ptype);
+    EG_free(glob);
+  } else {
+    EG_statsTess((egObject *) tess, 0);
+  }
+
+  *global = btess->global;
+  return EGADS_SUCCESS;
+}
+
+
+int
+EG_getTessBodyGlobal(const egObject *tess, int *nvert, const double **xyz,
+                     const int **ptype, const int **pindex, int *ntri,
+                     const int **tris)
+{
+  int          stat;
+  egTessGlobal *global;
+
+  *nvert = *ntri   = 0;
+  *xyz   = NULL;
+  *ptype = *pindex = *tris = NULL;
+  stat = EG_getTessGlobal(tess, "EG_getTessBodyGlobal", &global);
+  if (stat != EGADS_SUCCESS) return stat;
+
+  *nvert  = global->nvert;
+  *xyz    = global->xyz;
+  *ptype  = global->ptype;
+  *pindex = global->pindex;
+  *ntri   = global->ntri;
+  *tris   = global->tris;
+
+  return EGADS_SUCCESS;
+}
+
+
+int
+EG_getTessFaceGlobal(const egObject *tess, int index, int *len, 
+                     const int **gIndex, int *ntri, const int **tris)
+{
+  int          stat, nface, outLevel;
+  egTessGlobal *global;
+
+  *len    = *ntri = 0;
+  *gIndex = *tris = NULL;
+  stat = EG_getTessGlobal(tess, "EG_getTessFaceGlobal", &global);
+  if (stat != EGADS_SUCCESS) return stat;
+  nface = ((egTessel *) tess->blind)->nFace;
+  if ((index < 1) || (index > nface)) {
+    outLevel = EG_outLevel(tess);
+    if (outLevel > 0)
+      printf(" EGADS Error: Index = %d [1-%d] (EG_getTessFaceGlobal)!\n",
+             index, nface);
+    return EGADS_INDEXERR;
+  }
+
+  *len    = global->foff[index] - global->foff[index-1];
+  *gIndex = &global->fmap[global->foff[index-1]];
+  *ntri   = global->foff[nface+1+index] - global->foff[nface+index];
+  *tris   = &global->tris[3*global->foff[nface+index]];
+
+  return EGADS_SUCCESS;
+}
+
+
+/* free the single precision copy (it is rebuilt when next asked for) */
+
+void
+EG_freeTessFloat(egTessel *btess)
+{
+  egTessFloat *single;
+
+  single = btess->single;
+  if (single == NULL) return;
+  btess->single = NULL;
+  if (single->xyz != NULL) EG_free(single->xyz);
+  EG_free(single);
+}
+
+
+/* build the single precision copy of the Face & Edge points -- one block
+ *   with the xyzs, then the Face uvs & Edge ts, then the vertex offsets */
+
+static int
+EG_buildTessFloat(const egTessel *btess, egTessFloat **single)
+{
+  int         i, j, nface, nvf, nv, npts;
+  float       *block;
+  egTessFloat *sngl;
+
+  *single = NULL;
+  nface   = btess->nFace;
+  if (btess->tess2d == NULL) nface = 0;
+
+  for (nvf = i = 0; i < nface; i++) nvf += btess->tess2d[i].npts;
+  for (nv = nvf, i = 0; i < btess->nEdge; i++) nv += btess->tess1d[i].npts;
+
+  sngl = (egTessFloat *) EG_alloc(sizeof(egTessFloat));
+  if (sngl == NULL) return EGADS_MALLOC;
+  block = (float *) EG_alloc((3*nv + nv+nvf)*sizeof(float) +
+                             (nface+btess->nEdge+1)*sizeof(int));
+  if (block == NULL) {
+    EG_free(sngl);
+    return EGADS_MALLOC;
+  }
+  sngl->xyz = block;
+  sngl->prm = &block[3*nv];
+  sngl->off = (int *) &block[4*nv+nvf];
+
+  sngl->off[0] = 0;
+  for (i = 0; i < nface; i++) {
+    npts = btess->tess2d[i].npts;
+    for (j = 0; j < 3*npts; j++)
+      sngl->xyz[3*sngl->off[i]+j] = btess->tess2d[i].xyz[j];
+    for (j = 0; j < 2*npts; j++)
+      sngl->prm[2*sngl->off[i]+j] = btess->tess2d[i].uv[j];
+    sngl->off[i+1] = sngl->off[i] + npts;
+  }
+  for (i = 0; i < btess->nEdge; i++) {
+    npts = btess->tess1d[i].npts;
+    for (j = 0; j < 3*npts; j++)
+      sngl->xyz[3*sngl->off[nface+i]+j] = btess->tess1d[i].xyz[j];
+    for (j = 0; j < npts; j++)
+      sngl->prm[nvf+sngl->off[nface+i]+j] = btess->tess1d[i].t[j];
+    sngl->off[nface+i+1] = sngl->off[nface+i] + npts;
+  }
+
+  *single = sngl;
+  return EGADS_SUCCESS;
+}
+
+
+/* check the Body Tessellation and get (building once) its float copy */
+
+static int
+EG_getTessFloat(const egObject *tess, const char *func, egTessFloat **single)
+{
+  int         stat;
+  egTessel    *btess;
+  egTessFloat *sngl;
+  egObject    *context;
+  egCntxt     *cntx;
+
+  *single = NULL;
+  stat = EG_bodyTessel(tess, func, &btess);
+  if (stat != EGADS_SUCCESS) return stat;
+  if (btess->single != NULL) {
+    *single = btess->single;
+    return EGADS_SUCCESS;
+  }
+
+  stat = EG_buildTessFloat(btess, &sngl);
+  if (stat != EGADS_SUCCESS) {
+    if (EG_outLevel(tess) > 0)
+      printf(" EGADS Error: Single Precision Copy = %d (%s)!\n", stat, func);
+    return stat;
+  }
+
+  /* another thread may have beaten us to it */
+  context = EG_context(tess);
+  cntx    = NULL;
+  if (context != NULL) cntx = (egCntxt *) context->blind;
+  if (cntx != NULL) EG_mutexLock(cntx->mutex);
+  if (btess->single == NULL) {
+    btess->single = sngl;
+    sngl          = NULL;
+  }
+  if (cntx != NULL) EG_mutexUnlock(cntx->mutex);
+  if (sngl != NULL) {
+    EG_free(sngl->xyz);
+    EG_free(sngl);
+  } else {
+    EG_statsTess((egObject *) tess, 0);
+  }
+
+  *single = btess->single;
+  return EGADS_SUCCESS;
+}
+
+
+int
+EG_getTessEdgeFloat(const egObject *tess, int index, int *len,
+                    const float **xyz, const float **t)
+{
+  int         stat, nface, nvf, outLevel;
+  egTessel    *btess;
+  egTessFloat *single;
+
+  *len = 0;
+  *xyz = *t = NULL;
+  stat = EG_getTessFloat(tess, "EG_getTessEdgeFloat", &single);
+  if (stat != EGADS_SUCCESS) return stat;
+  btess = (egTessel *) tess->blind;
+  if ((index < 1) || (index > btess->nEdge)) {
+    outLevel = EG_outLevel(tess);
+    if (outLevel > 0)
+      printf(" EGADS Error: Index = %d [1-%d] (EG_getTessEdgeFloat)!\n",
+             index, btess->nEdge);
+    return EGADS_INDEXERR;
+  }
+  nface = btess->nFace;
+  if (btess->tess2d == NULL) nface = 0;
+  nvf   = single->off[nface];
+
+  *len = single->off[nface+index] - single->off[nface+index-1];
+  *xyz = &single->xyz[3*single->off[nface+index-1]];
+  *t   = &single->prm[nvf+single->off[nface+index-1]];
+
+  return EGADS_SUCCESS;
+}
+
+
+int
+EG_getTessFaceFloat(const egObject *tess, int index, int *len,
+                    const float **xyz, const float **uv, int *ntri,
+                    const int **tris)
+{
+  int         stat, outLevel;
+  egTessel    *btess;
+  egTessFloat *single;
+
+  *len = *ntri = 0;
+  *xyz = *uv   = NULL;
+  *tris = NULL;
+  stat = EG_getTessFloat(tess, "EG_getTessFaceFloat", &single);
+  if (stat != EGADS_SUCCESS) return stat;
+  btess = (egTessel *) tess->blind;
+  if ((btess->tess2d == NULL) || (index < 1) || (index > btess->nFace)) {
+    outLevel = EG_outLevel(tess);
+    if (outLevel > 0)
+      printf(" EGADS Error: Index = %d [1-%d] (EG_getTessFaceFloat)!\n",
+             index, (btess->tess2d == NULL) ? 0 : btess->nFace);
+    return EGADS_INDEXERR;
+  }
+
+  *len  = single->off[index] - single->off[index-1];
+  *xyz  = &single->xyz[3*single->off[index-1]];
+  *uv   = &single->prm[2*single->off[index-1]];
+  *ntri = btess->tess2d[index-1].ntris;
+  *tris = btess->tess2d[index-1].tris;
+
+  return EGADS_SUCCESS;
+}
+
+
 static int
 EG_fillTris(egObject *body, int iFace, egObject *face, egObject *tess, 
             triStruct *ts, fillArea *fa)
@@ -1195,6 +1812,7 @@ EG_fillTris(egObject *body, int iFace, egObject *face, egObject *tess,
   egTessel *btess;
   triVert  *tv;
   triTri   *tt;
+  triMid   *tm;
   triSeg   *tsg;
   static double scl[3][2] = {1.0, 1.0,  10.0, 1.0,  0.1, 10.0};
   const  double *xyzs, *tps;
@@ -1500,20 +2118,27 @@ EG_fillTris(egObject *body, int iFace, egObject *face, egObject *tess,
   n *= CHUNK;
   if (ts->tris == NULL) {
     ts->tris = (triTri *) EG_alloc(n*sizeof(triTri));
-    if (ts->tris == NULL) {
+    ts->mids = (triMid *) EG_alloc(n*sizeof(triMid));
+    if ((ts->tris == NULL) || (ts->mids == NULL)) {
+      if (ts->tris != NULL) EG_free(ts->tris);
+      if (ts->mids != NULL) EG_free(ts->mids);
+      ts->tris = NULL;
+      ts->mids = NULL;
       EG_free(tris);
-      EG_free(lps);
-      EG_free(uvs);
       return EGADS_MALLOC;
     }
     ts->mtris = n;
   } else {
     if (n > ts->mtris) {
+      tm = (triMid *) EG_reall(ts->mids, n*sizeof(triMid));
+      if (tm == NULL) {
+        EG_free(tris);
+        return EGADS_MALLOC;
+      }
+      ts->mids = tm;
       tt = (triTri *) EG_reall(ts->tris, n*sizeof(triTri));
       if (tt == NULL) {
         EG_free(tris);
-        EG_free(lps);
-        EG_free(uvs);
         return EGADS_MALLOC;
       }
       ts->tris  = tt;
@@ -1573,29 +2198,14 @@ EG_cleanupTess(egTessel *btess)
         EG_free(btess->tess1d[i].faces[0].tric);
       if (btess->tess1d[i].faces[1].tric  != NULL)
         EG_free(btess->tess1d[i].faces[1].tric);
-      if (btess->tess1d[i].xyz != NULL) 
-        EG_free(btess->tess1d[i].xyz);
-      if (btess->tess1d[i].t   != NULL) 
-        EG_free(btess->tess1d[i].t);
+      EG_freeTess1D(&btess->tess1d[i]);
     }
     EG_free(btess->tess1d);
   }
   
   if (btess->tess2d != NULL) {
-    for (i = 0; i < 2*btess->nFace; i++) {
-      if (btess->tess2d[i].xyz    != NULL) 
-        EG_free(btess->tess2d[i].xyz);
-      if (btess->tess2d[i].uv     != NULL) 
-        EG_free(btess->tess2d[i].uv);
-      if (btess->tess2d[i].ptype  != NULL) 
-        EG_free(btess->tess2d[i].ptype);
-      if (btess->tess2d[i].pindex != NULL) 
-        EG_free(btess->tess2d[i].pindex);
-      if (btess->tess2d[i].tris   != NULL) 
-        EG_free(btess->tess2d[i].tris);
-      if (btess->tess2d[i].tric   != NULL) 
-        EG_free(btess->tess2d[i].tric);
-    }
+    for (i = 0; i < 2*btess->nFace; i++)
+      EG_freeTess2D(&btess->tess2d[i]);
     EG_free(btess->tess2d);
   }
 
@@ -1668,327 +2278,469 @@ EG_curvNorm(egObject *face, int i, int sense, double d, double *dx,
 
 
 static int
-EG_tessEdges(egTessel *btess, /*@null@*/ int *retess)
+EG_tessThreads(const egObject *object, int nwork)
 {
-  int      i, j, k, n, npts, stat, outLevel, nedge, oclass, mtype, nnode;
-  int      nf, nface, nloop, ntype, ndum, face, sense, *senses, *finds;
-  double   xyz[MAXELEN][3], t[MAXELEN], aux[MAXELEN][3], mindist, tol, dist;
-  double   d, dotnrm, dot, limits[2], mid[3], range[4], dx[3], result[18];
-  egObject *body, *geom, *ref, **faces, **loops, **edges, **nodes, **dum;
-  
-  body     = btess->src;
-  outLevel = EG_outLevel(body);
-  
-  stat = EG_getBodyTopos(body, NULL, EDGE, &nedge, &edges);
-  if (stat != EGADS_SUCCESS) return stat;
-  stat = EG_getBodyTopos(body, NULL, FACE, &nface, &faces);
-  if (stat != EGADS_SUCCESS) return stat;
-  
-  if (retess == NULL) {
-    btess->tess1d = (egTess1D *) EG_alloc(nedge*sizeof(egTess1D));
-    if (btess->tess1d == NULL) {
-      if (outLevel > 0)
-        printf(" EGADS Error: Alloc %d Edges (EG_tessEdges)!\n", nedge);
-      EG_free(faces);
-      EG_free(edges);
-      return EGADS_MALLOC;  
-    }
-    for (j = 0; j < nedge; j++) {
-      btess->tess1d[j].obj            = edges[j];
-      btess->tess1d[j].faces[0].index = 0;
-      btess->tess1d[j].faces[0].nface = 0;
-      btess->tess1d[j].faces[0].faces = NULL;
-      btess->tess1d[j].faces[0].tric  = NULL;
-      btess->tess1d[j].faces[1].index = 0;
-      btess->tess1d[j].faces[1].nface = 0;
-      btess->tess1d[j].faces[1].faces = NULL;
-      btess->tess1d[j].faces[1].tric  = NULL;
-      btess->tess1d[j].nodes[0]       = 0;
-      btess->tess1d[j].nodes[1]       = 0;
-      btess->tess1d[j].xyz            = NULL;
-      btess->tess1d[j].t              = NULL;
-      btess->tess1d[j].npts           = 0;
-    }
-    btess->nEdge = nedge;
-  
-    /* get the face indices (if any) */
-    for (i = 0; i < nface; i++) {
-      stat = EG_getTopology(faces[i], &geom, &oclass, &mtype, limits,
-                            &nloop, &loops, &senses);
-      if (stat != EGADS_SUCCESS) continue;
-      for (j = 0; j < nloop; j++) {
-        stat = EG_getTopology(loops[j], &geom, &oclass, &mtype, limits,
-                            &ndum, &dum, &senses);
-        if (stat != EGADS_SUCCESS) continue;
-        for (k = 0; k < ndum; k++) {
-          n = EG_indexBodyTopo(body, dum[k]);
-          if (n <= EGADS_SUCCESS) continue;
-          if (senses[k] < 0) {
-            if (btess->tess1d[n-1].faces[0].nface != 0) {
-              if (btess->tess1d[n-1].faces[0].nface == 1) {
-                btess->tess1d[n-1].faces[0].faces = (int *) EG_alloc(2*sizeof(int));
-                if (btess->tess1d[n-1].faces[0].faces == NULL) {
-                  if (outLevel > 0)
-                    printf(" EGADS Error: Alloc (-) Edge %d (EG_tessEdges)!\n", n);
-                  EG_free(faces);
-                  EG_free(edges);
-                  return EGADS_MALLOC;
-                }
-                btess->tess1d[n-1].faces[0].faces[0] = btess->tess1d[n-1].faces[0].index;
-                btess->tess1d[n-1].faces[0].faces[1] = i+1;
-              } else {
-                finds = (int *) EG_reall( btess->tess1d[n-1].faces[0].faces,
-                                         (btess->tess1d[n-1].faces[0].nface+1)*sizeof(int));
-                if (finds == NULL) {
-                  if (outLevel > 0)
-                    printf(" EGADS Error: ReAlloc (-) Edge %d (EG_tessEdges)!\n", n);
-                  EG_free(faces);
-                  EG_free(edges);
-                  return EGADS_MALLOC;
-                } 
-                finds[btess->tess1d[n-1].faces[0].nface] = i+1;
-                btess->tess1d[n-1].faces[0].faces = finds;
-              }
-            }
-            btess->tess1d[n-1].faces[0].index = i+1;
-            btess->tess1d[n-1].faces[0].nface++;
-          } else {
-            if (btess->tess1d[n-1].faces[1].nface != 0) {
-              if (btess->tess1d[n-1].faces[1].nface == 1) {
-                btess->tess1d[n-1].faces[1].faces = (int *) EG_alloc(2*sizeof(int));
-                if (btess->tess1d[n-1].faces[1].faces == NULL) {
-                  if (outLevel > 0)
-                    printf(" EGADS Error: Alloc (+) Edge %d (EG_tessEdges)!\n", n);
-                  EG_free(faces);
-                  EG_free(edges);
-                  return EGADS_MALLOC;
-                }
-                btess->tess1d[n-1].faces[1].faces[0] = btess->tess1d[n-1].faces[1].index;
-                btess->tess1d[n-1].faces[1].faces[1] = i+1;
-              } else {
-                finds = (int *) EG_reall( btess->tess1d[n-1].faces[1].faces,
-                                         (btess->tess1d[n-1].faces[1].nface+1)*sizeof(int));
-                if (finds == NULL) {
-                  if (outLevel > 0)
-                    printf(" EGADS Error: ReAlloc (+) Edge %d (EG_tessEdges)!\n", n);
-                  EG_free(faces);
-                  EG_free(edges);
-                  return EGADS_MALLOC;
-                }
-                finds[btess->tess1d[n-1].faces[1].nface] = i+1;
-                btess->tess1d[n-1].faces[1].faces = finds;
-              }
-            }
-            btess->tess1d[n-1].faces[1].index = i+1;
-            btess->tess1d[n-1].faces[1].nface++;
-          }
-        }
-      }
+  int      nthread;
+  egObject *context;
+  egCntxt  *cntx;
+
+  context = EG_context(object);
+  if (context == NULL) return 1;
+  cntx = (egCntxt *) context->blind;
+  if (cntx == NULL)    return 1;
+
+  nthread = cntx->nThread;
+  if (nthread == 0)     nthread = EG_numProcs();
+  if (nthread > nwork)  nthread = nwork;
+  if (nthread < 1)      nthread = 1;
+  return nthread;
+}
+
+
+static int
+EG_cmpSurfKey(const void *a, const void *b)
+{
+  const surfKey *ka, *kb;
+
+  ka = (const surfKey *) a;
+  kb = (const surfKey *) b;
+  if ((size_t) ka->key < (size_t) kb->key) return -1;
+  if ((size_t) ka->key > (size_t) kb->key) return  1;
+  return ka->index - kb->index;
+}
+
+
+/* split & periodic Faces share an OCC surface (and its evaluation caches)
+ *   -- these get the lowest Face index of their group, the rest -1 */
+
+static int
+EG_surfaceGroups(int nface, egObject **faces, /*@null@*/ const int *marker,
+                 int *group)
+{
+  int     i, j, k, n;
+  surfKey *keys;
+
+  for (j = 0; j < nface; j++) group[j] = -1;
+  keys = (surfKey *) EG_alloc(nface*sizeof(surfKey));
+  if (keys == NULL) return EGADS_MALLOC;
+  for (n = j = 0; j < nface; j++) {
+    if (marker != NULL)
+      if (marker[j] == 0) continue;
+    keys[n].key   = EG_geomKey(faces[j]);
+    keys[n].index = j;
+    if (keys[n].key != NULL) n++;
+  }
+  qsort(keys, n, sizeof(surfKey), EG_cmpSurfKey);
+  for (i = 0; i < n; i = k) {
+    for (k = i+1; k < n; k++)
+      if (keys[k].key != keys[i].key) break;
+    if (k-i == 1) continue;
+    for (j = i; j < k; j++) group[keys[j].index] = keys[i].index;
+  }
+  EG_free(keys);
+
+  return EGADS_SUCCESS;
+}
+
+
+/* the locks for the surface groups -- all or none are made */
+
+static int
+EG_makeSurfLocks(void **locks)
+{
+  int i, j;
+
+  for (i = 0; i < FACELOCKS; i++) {
+    locks[i] = EG_mutexCreate();
+    if (locks[i] != NULL) continue;
+    for (j = 0; j < i; j++) {
+      EG_mutexDestroy(locks[j]);
+      locks[j] = NULL;
     }
-    /* report any non-manifold Edges */
-    if (outLevel > 1)
-      for (j = 0; j < nedge; j++) {
-        if (btess->tess1d[j].faces[0].nface > 1) {
-          printf(" EGADS Internal: Non-manifold Edge %d (-) with Faces", j+1);
-          if (btess->tess1d[j].faces[0].faces != NULL)
-            for (k = 0; k < btess->tess1d[j].faces[0].nface; k++)
-              printf(" %d", btess->tess1d[j].faces[0].faces[k]);
-          printf("!\n");
-        }
-        if (btess->tess1d[j].faces[1].nface > 1) {
-          printf(" EGADS Internal: Non-manifold Edge %d (+) with Faces", j+1);
-          if (btess->tess1d[j].faces[1].faces != NULL)
-            for (k = 0; k < btess->tess1d[j].faces[1].nface; k++)
-              printf(" %d", btess->tess1d[j].faces[1].faces[k]);
-          printf("!\n");
-        }
-      }
+    return EGADS_MALLOC;
   }
 
-  /* do the Edges -- one at a time */
+  return EGADS_SUCCESS;
+}
 
-  dist = fabs(btess->params[2]);
-  if (dist > 30.0) dist = 30.0;
-  if (dist <  0.5) dist =  0.5;
-  dotnrm = cos(PI*dist/180.0);
 
-  for (j = 0; j < nedge; j++) {
-    if (retess != NULL)
-      if (retess[j] == 0) continue;
-    stat = EG_getTopology(edges[j], &geom, &oclass, &mtype, limits,
-                          &nnode, &nodes, &senses);
-    if (stat != EGADS_SUCCESS) {
-      EG_free(faces);
-      EG_free(edges);
-      return stat;
-    }
+static int
+EG_tessMaxPts(const egObject *object)
+{
+  egObject *context;
+  egCntxt  *cntx;
+
+  context = EG_context(object);
+  if (context == NULL)     return MAXELEN;
+  cntx = (egCntxt *) context->blind;
+  if (cntx == NULL)        return MAXELEN;
+  if (cntx->maxEpts < 3)   return MAXELEN;
+
+  return cntx->maxEpts;
+}
+
+
+static int
+EG_growEdgeBuf(edgeBuf *buf, int npts)
+{
+  int    n;
+  double *tmp;
+
+  if (npts <= buf->mpts) return EGADS_SUCCESS;
+  n = 2*buf->mpts;
+  if (n < npts) n = npts;
+  
+  tmp = (double *) EG_reall(buf->xyz, 3*n*sizeof(double));
+  if (tmp == NULL) return EGADS_MALLOC;
+  buf->xyz = (double (*)[3]) tmp;
+  tmp = (double *) EG_reall(buf->t,     n*sizeof(double));
+  if (tmp == NULL) return EGADS_MALLOC;
+  buf->t   = tmp;
+  tmp = (double *) EG_reall(buf->aux, 3*n*sizeof(double));
+  if (tmp == NULL) return EGADS_MALLOC;
+  buf->aux  = (double (*)[3]) tmp;
+  buf->mpts = n;
+  
+  return EGADS_SUCCESS;
+}
+
+
+static int
+EG_tessEdge(egTessel *btess, int j, egObject **edges, egObject **faces,
+            double dotnrm, int maxpts, edgeBuf *buf, void **flocks,
+            /*@null@*/ const int *fslot)
+{
+  int      i, k, n, npts, stat, outLevel, oclass, mtype, nnode, nf, ntype;
+  int      ndum, face, sense, capped = 0, *senses;
+  double   mindist, tol, dist, d, dot, limits[2], mid[3], range[4], dx[3];
+  double   result[18], (*xyz)[3], *t, (*aux)[3];
+  void     *flock;
+  egObject *geom, *ref, **nodes, **dum;
+
+  outLevel = EG_outLevel(btess->src);
+  xyz      = buf->xyz;
+  t        = buf->t;
+  aux      = buf->aux;
+
+  stat = EG_getTopology(edges[j], &geom, &oclass, &mtype, limits,
+                        &nnode, &nodes, &senses);
+  if (stat != EGADS_SUCCESS) return stat;
 #ifdef DEBUG
-    printf(" Edge %d: type = %d, geom type = %d, limits = %lf %lf, nnode = %d\n",
-           j+1, mtype, geom->mtype, limits[0], limits[1], nnode);
+  printf(" Edge %d: type = %d, geom type = %d, limits = %lf %lf, nnode = %d\n",
+         j+1, mtype, geom->mtype, limits[0], limits[1], nnode);
 #endif
-           
-    /* set end points */
-    stat = EG_getTopology(nodes[0], &ref, &oclass, &ntype, xyz[0],
+         
+  /* set end points */
+  stat = EG_getTopology(nodes[0], &ref, &oclass, &ntype, xyz[0],
+                        &ndum, &dum, &senses);
+  if (stat != EGADS_SUCCESS) return stat;
+  npts      = 2;
+  t[0]      = limits[0];
+  xyz[1][0] = xyz[0][0];
+  xyz[1][1] = xyz[0][1];
+  xyz[1][2] = xyz[0][2];
+  t[1]      = limits[1];
+  if (mtype == TWONODE) {
+    stat = EG_getTopology(nodes[1], &ref, &oclass, &ntype, xyz[1],
                           &ndum, &dum, &senses);
-    if (stat != EGADS_SUCCESS) {
-      EG_free(faces);
-      EG_free(edges);
-      return stat;
-    }
-    npts      = 2;
-    t[0]      = limits[0];
-    xyz[1][0] = xyz[0][0];
-    xyz[1][1] = xyz[0][1];
-    xyz[1][2] = xyz[0][2];
-    t[1]      = limits[1];
-    btess->tess1d[j].nodes[0] = EG_indexBodyTopo(body, nodes[0]);
-    btess->tess1d[j].nodes[1] = btess->tess1d[j].nodes[0];
-    if (mtype == TWONODE) {
-      stat = EG_getTopology(nodes[1], &ref, &oclass, &ntype, xyz[1],
-                            &ndum, &dum, &senses);
-      if (stat != EGADS_SUCCESS) {
-        EG_free(faces);
-        EG_free(edges);
-        return stat;
-      }
-      btess->tess1d[j].nodes[1] = EG_indexBodyTopo(body, nodes[1]);
-    }
+    if (stat != EGADS_SUCCESS) return stat;
+  }
 
-    /* degenerate -- finish up */
-    if (mtype == DEGENERATE) {
-      btess->tess1d[j].xyz = (double *) EG_alloc(3*npts*sizeof(double));
-      if (btess->tess1d[j].xyz == NULL) {
-        if (outLevel > 0)
-          printf(" EGADS Error: Alloc %d Pts Edge %d (EG_tessEdges)!\n", 
-                 npts, j+1);
-        EG_free(faces);
-        EG_free(edges);
-        return EGADS_MALLOC;  
-      }
-      btess->tess1d[j].t = (double *) EG_alloc(npts*sizeof(double));
-      if (btess->tess1d[j].t == NULL) {
-        EG_free(btess->tess1d[j].xyz);
-        btess->tess1d[j].xyz = NULL;
-        if (outLevel > 0)
-          printf(" EGADS Error: Alloc %d Ts Edge %d (EG_tessEdges)!\n", 
-                 npts, j+1);
-        EG_free(faces);
-        EG_free(edges);
-        return EGADS_MALLOC;  
-      }
-      for (i = 0; i < npts; i++) {
-        btess->tess1d[j].xyz[3*i  ] = xyz[i][0];
-        btess->tess1d[j].xyz[3*i+1] = xyz[i][1];
-        btess->tess1d[j].xyz[3*i+2] = xyz[i][2];
-        btess->tess1d[j].t[i]       = t[i];
-      }
-      btess->tess1d[j].npts = npts;
-      continue;
-    }
-    
-    /* get minimum distance */
-    stat = EG_evaluate(edges[j], &t[0], result);
-    if (stat != EGADS_SUCCESS) {
-      EG_free(faces);
-      EG_free(edges);
-      return stat;
+  /* degenerate -- finish up */
+  if (mtype == DEGENERATE) {
+    if (EG_allocTess1D(&btess->tess1d[j], npts) != EGADS_SUCCESS) {
+      if (outLevel > 0)
+        printf(" EGADS Error: Alloc %d Pts Edge %d (EG_tessEdges)!\n", 
+               npts, j+1);
+      return EGADS_MALLOC;  
     }
-    mindist = (xyz[0][0]-result[0])*(xyz[0][0]-result[0]) +
-              (xyz[0][1]-result[1])*(xyz[0][1]-result[1]) +
-              (xyz[0][2]-result[2])*(xyz[0][0]-result[2]);
-    stat = EG_evaluate(edges[j], &t[1], result);
-    if (stat != EGADS_SUCCESS) {
-      EG_free(faces);
-      EG_free(edges);
-      return stat;
+    for (i = 0; i < npts; i++) {
+      btess->tess1d[j].xyz[3*i  ] = xyz[i][0];
+      btess->tess1d[j].xyz[3*i+1] = xyz[i][1];
+      btess->tess1d[j].xyz[3*i+2] = xyz[i][2];
+      btess->tess1d[j].t[i]       = t[i];
     }
-    dist = (xyz[1][0]-result[0])*(xyz[1][0]-result[0]) +
-           (xyz[1][1]-result[1])*(xyz[1][1]-result[1]) +
-           (xyz[1][2]-result[2])*(xyz[1][0]-result[2]);
-    if (dist > mindist) mindist = dist;
-    mindist = sqrt(mindist);
-    if (0.1*btess->params[1] > mindist) 
-      mindist = 0.1*btess->params[1];
+    btess->tess1d[j].npts = npts;
+    return EGADS_SUCCESS;
+  }
+  
+  /* get minimum distance */
+  stat = EG_evaluate(edges[j], &t[0], result);
+  if (stat != EGADS_SUCCESS) return stat;
+  mindist = (xyz[0][0]-result[0])*(xyz[0][0]-result[0]) +
+            (xyz[0][1]-result[1])*(xyz[0][1]-result[1]) +
+            (xyz[0][2]-result[2])*(xyz[0][0]-result[2]);
+  stat = EG_evaluate(edges[j], &t[1], result);
+  if (stat != EGADS_SUCCESS) return stat;
+  dist = (xyz[1][0]-result[0])*(xyz[1][0]-result[0]) +
+         (xyz[1][1]-result[1])*(xyz[1][1]-result[1]) +
+         (xyz[1][2]-result[2])*(xyz[1][0]-result[2]);
+  if (dist > mindist) mindist = dist;
+  mindist = sqrt(mindist);
+  if (0.1*btess->params[1] > mindist) 
+    mindist = 0.1*btess->params[1];
 #ifdef DEBUG
-    printf("     minDist = %le\n", mindist);
+  printf("     minDist = %le\n", mindist);
 #endif
+  
+  /* periodic -- add a vertex */
+  if (mtype == ONENODE) {
+    xyz[2][0] = xyz[1][0];
+    xyz[2][1] = xyz[1][1];
+    xyz[2][2] = xyz[1][2];
+    aux[2][0] = aux[1][0];
+    aux[2][1] = aux[1][1];
+    aux[2][2] = aux[1][2];
+    t[2]      = t[1];
+    t[1]      = 0.5*(t[0]+t[2]);
+    stat      = EG_evaluate(edges[j], &t[1], result);
+    if (stat != EGADS_SUCCESS) return stat;
+    dist      = sqrt(result[3]*result[3] + result[4]*result[4] +
+                     result[5]*result[5]);
+    if (dist == 0) dist = 1.0;
+    xyz[1][0] = result[0];
+    xyz[1][1] = result[1];
+    xyz[1][2] = result[2];
+    aux[1][0] = result[3]/dist;
+    aux[1][1] = result[4]/dist;
+    aux[1][2] = result[5]/dist;
+    npts      = 3;
+  }
+
+  /* non-linear curve types */    
+  if (geom->mtype != LINE) {
     
-    /* periodic -- add a vertex */
-    if (mtype == ONENODE) {
-      xyz[2][0] = xyz[1][0];
-      xyz[2][1] = xyz[1][1];
-      xyz[2][2] = xyz[1][2];
-      aux[2][0] = aux[1][0];
-      aux[2][1] = aux[1][1];
-      aux[2][2] = aux[1][2];
-      t[2]      = t[1];
-      t[1]      = 0.5*(t[0]+t[2]);
-      stat      = EG_evaluate(edges[j], &t[1], result);
-      if (stat != EGADS_SUCCESS) {
-        EG_free(faces);
-        EG_free(edges);
-        return stat;
-      }
-      dist      = sqrt(result[3]*result[3] + result[4]*result[4] +
-                       result[5]*result[5]);
+    /* angle criteria - aux is normalized tangent */
+    if (btess->params[2] != 0.0) {
+      stat = EG_evaluate(edges[j], &t[0], result);
+      if (stat != EGADS_SUCCESS) return stat;
+      dist = sqrt(result[3]*result[3] + result[4]*result[4] +
+                  result[5]*result[5]);
+      if (dist == 0) dist = 1.0;
+      aux[0][0] = result[3]/dist;
+      aux[0][1] = result[4]/dist;
+      aux[0][2] = result[5]/dist;
+      stat = EG_evaluate(edges[j], &t[npts-1], result);
+      if (stat != EGADS_SUCCESS) return stat;
+      dist = sqrt(result[3]*result[3] + result[4]*result[4] +
+                  result[5]*result[5]);
       if (dist == 0) dist = 1.0;
-      xyz[1][0] = result[0];
-      xyz[1][1] = result[1];
-      xyz[1][2] = result[2];
-      aux[1][0] = result[3]/dist;
-      aux[1][1] = result[4]/dist;
-      aux[1][2] = result[5]/dist;
-      npts      = 3;
+      aux[npts-1][0] = result[3]/dist;
+      aux[npts-1][1] = result[4]/dist;
+      aux[npts-1][2] = result[5]/dist;
+
+      for (;;) {
+        /* find the segment with the largest angle */
+        k   = -1;
+        dot =  1.0;
+        for (i = 0; i < npts-1; i++) {
+          dist = (xyz[i][0]-xyz[i+1][0])*(xyz[i][0]-xyz[i+1][0]) +
+                 (xyz[i][1]-xyz[i+1][1])*(xyz[i][1]-xyz[i+1][1]) +
+                 (xyz[i][2]-xyz[i+1][2])*(xyz[i][2]-xyz[i+1][2]);
+          if (dist < mindist*mindist) continue;
+          d = aux[i][0]*aux[i+1][0] + aux[i][1]*aux[i+1][1] + 
+              aux[i][2]*aux[i+1][2];
+          if (d < dot) {
+            dot = d;
+            k   = i;
+          }
+        }
+        if ((dot > dotnrm) || (k == -1)) break;
+        if (npts >= maxpts) {
+          capped = 1;
+          break;
+        }
+        /* insert */
+        stat = EG_growEdgeBuf(buf, npts+1);
+        if (stat != EGADS_SUCCESS) return stat;
+        xyz = buf->xyz;
+        t   = buf->t;
+        aux = buf->aux;
+        for (i = npts-1; i > k; i--) {
+          xyz[i+1][0] = xyz[i][0];
+          xyz[i+1][1] = xyz[i][1];
+          xyz[i+1][2] = xyz[i][2];
+          aux[i+1][0] = aux[i][0];
+          aux[i+1][1] = aux[i][1];
+          aux[i+1][2] = aux[i][2];
+          t[i+1]      = t[i];
+        }
+        t[k+1] = 0.5*(t[k]+t[k+2]);
+        stat   = EG_evaluate(edges[j], &t[k+1], result);
+        if (stat != EGADS_SUCCESS) return stat;
+        dist   = sqrt(result[3]*result[3] + result[4]*result[4] +
+                      result[5]*result[5]);
+        if (dist == 0.0) dist = 1.0;
+        xyz[k+1][0] = result[0];
+        xyz[k+1][1] = result[1];
+        xyz[k+1][2] = result[2];
+        aux[k+1][0] = result[3]/dist;
+        aux[k+1][1] = result[4]/dist;
+        aux[k+1][2] = result[5]/dist;
+        npts++;
+      }
+#ifdef DEBUG
+      printf("     Angle  Phase npts = %d @ %lf (%lf)\n",
+             npts, dot, dotnrm);
+#endif
     }
-
-    /* non-linear curve types */    
-    if (geom->mtype != LINE) {
-      
-      /* angle criteria - aux is normalized tangent */
-      if (btess->params[2] != 0.0) {
-        stat = EG_evaluate(edges[j], &t[0], result);
-        if (stat != EGADS_SUCCESS) {
-          EG_free(faces);
-          EG_free(edges);
-          return stat;
+    
+    /* sag - aux is midpoint value */
+    if (btess->params[1] > 0.0) {
+      for (i = 0; i < npts-1; i++) {
+        d    = 0.5*(t[i]+t[i+1]);
+        stat = EG_evaluate(edges[j], &d, result);
+        if (stat != EGADS_SUCCESS) return stat;
+        aux[i][0] = result[0];
+        aux[i][1] = result[1];
+        aux[i][2] = result[2];
+      }
+      for (;;) {
+        /* find the biggest deviation */
+        k    = -1;
+        dist = 0.0;
+        for (i = 0; i < npts-1; i++) {
+          dot = (xyz[i][0]-xyz[i+1][0])*(xyz[i][0]-xyz[i+1][0]) +
+                (xyz[i][1]-xyz[i+1][1])*(xyz[i][1]-xyz[i+1][1]) +
+                (xyz[i][2]-xyz[i+1][2])*(xyz[i][2]-xyz[i+1][2]);
+          if (dot < mindist*mindist) continue;
+          mid[0] = 0.5*(xyz[i][0] + xyz[i+1][0]);
+          mid[1] = 0.5*(xyz[i][1] + xyz[i+1][1]);
+          mid[2] = 0.5*(xyz[i][2] + xyz[i+1][2]);
+          d      = (aux[i][0]-mid[0])*(aux[i][0]-mid[0]) +
+                   (aux[i][1]-mid[1])*(aux[i][1]-mid[1]) +
+                   (aux[i][2]-mid[2])*(aux[i][2]-mid[2]);
+          if (d > dist) {
+            dist = d;
+            k    = i;
+          }
         }
-        dist = sqrt(result[3]*result[3] + result[4]*result[4] +
-                    result[5]*result[5]);
-        if (dist == 0) dist = 1.0;
-        aux[0][0] = result[3]/dist;
-        aux[0][1] = result[4]/dist;
-        aux[0][2] = result[5]/dist;
-        stat = EG_evaluate(edges[j], &t[npts-1], result);
-        if (stat != EGADS_SUCCESS) {
-          EG_free(faces);
-          EG_free(edges);
-          return stat;
+        if ((dist < btess->params[1]*btess->params[1]) || 
+            (k == -1)) break;
+        if (npts >= maxpts) {
+          capped = 1;
+          break;
+        }
+        /* insert */
+        stat = EG_growEdgeBuf(buf, npts+1);
+        if (stat != EGADS_SUCCESS) return stat;
+        xyz = buf->xyz;
+        t   = buf->t;
+        aux = buf->aux;
+        for (i = npts-1; i > k; i--) {
+          xyz[i+1][0] = xyz[i][0];
+          xyz[i+1][1] = xyz[i][1];
+          xyz[i+1][2] = xyz[i][2];
+          aux[i+1][0] = aux[i][0];
+          aux[i+1][1] = aux[i][1];
+          aux[i+1][2] = aux[i][2];
+          t[i+1]      = t[i];
         }
-        dist = sqrt(result[3]*result[3] + result[4]*result[4] +
-                    result[5]*result[5]);
-        if (dist == 0) dist = 1.0;
-        aux[npts-1][0] = result[3]/dist;
-        aux[npts-1][1] = result[4]/dist;
-        aux[npts-1][2] = result[5]/dist;
-
-        while (npts < MAXELEN) {
-          /* find the segment with the largest angle */
-          k   = -1;
-          dot =  1.0;
+        t[k+1]      = 0.5*(t[k]+t[k+2]);
+        xyz[k+1][0] = aux[k][0];
+        xyz[k+1][1] = aux[k][1];
+        xyz[k+1][2] = aux[k][2];
+        d    = 0.5*(t[k+1]+t[k+2]);
+        stat = EG_evaluate(edges[j], &d, result);
+        if (stat != EGADS_SUCCESS) return stat;
+        aux[k+1][0] = result[0];
+        aux[k+1][1] = result[1];
+        aux[k+1][2] = result[2];
+        d    = 0.5*(t[k]+t[k+1]);
+        stat = EG_evaluate(edges[j], &d, result);
+        if (stat != EGADS_SUCCESS) return stat;
+        aux[k][0] = result[0];
+        aux[k][1] = result[1];
+        aux[k][2] = result[2];
+        npts++;
+      }
+#ifdef DEBUG
+      printf("     Sag    Phase npts = %d @ %lf (%lf)\n", 
+             npts, sqrt(dist), btess->params[1]);
+#endif
+    }     
+  }
+  
+  /* look at non-planar faces for curvature -- aux is uv*/
+  if (btess->params[2] > 0.0)
+    for (n = 0; n < 2; n++) {
+                  sense =  1;
+      if (n == 0) sense = -1;
+      for (nf = 0; nf < btess->tess1d[j].faces[n].nface; nf++) {
+        face = btess->tess1d[j].faces[n].index;
+        if (btess->tess1d[j].faces[n].nface > 1)
+          face = btess->tess1d[j].faces[n].faces[nf];
+        if (face <= 0) continue;
+        stat = EG_getTopology(faces[face-1], &ref, &oclass, &ntype, range,
+                              &ndum, &dum, &senses);
+        if (stat != EGADS_SUCCESS) continue;
+        if (ref == NULL) continue;
+        if (ref->mtype == PLANE) continue;
+        stat = EG_getTolerance(faces[face-1], &tol);
+        if (stat != EGADS_SUCCESS) continue;
+        if (btess->params[1] > tol) tol = btess->params[1];
+
+        /* the other Edges of this Face (and of any Face split from its
+           surface) share OCC's evaluation caches -- one looks at a time */
+        flock = NULL;
+        if (fslot != NULL) flock = flocks[fslot[face-1]%FACELOCKS];
+        EG_mutexLock(flock);
+        for (i = 0; i < npts; i++) {
+          aux[i][2] = 1.0;
+          stat = EG_getEdgeUV(faces[face-1], edges[j], sense, t[i], 
+                              aux[i]);
+          if (stat != EGADS_SUCCESS) aux[i][2] = 0.0;
+        }
+        for (i = 0; i < npts-1; i++) {
+          if (aux[i][2]   <= 0.0) continue;
+          if (aux[i+1][2] == 0.0) continue;
+          dx[0] = xyz[i+1][0] - xyz[i][0];
+          dx[1] = xyz[i+1][1] - xyz[i][1];
+          dx[2] = xyz[i+1][2] - xyz[i][2];
+          d     = DOT(dx, dx);
+          if (d < tol*tol) {
+            aux[i][2] = -1.0;
+            continue;
+          }
+          /* get normal at mid-point in UV */
+          dot = EG_curvNorm(faces[face-1], i, sense*ntype, d, dx, aux);
+          if ((dot > dotnrm) || (dot < -1.1)) aux[i][2] = -1.0;
+        }
+
+        for (;;) {
+          /* find the largest segment with Face curvature too big */
+          k    = -1;
+          dist =  tol*tol;
           for (i = 0; i < npts-1; i++) {
-            dist = (xyz[i][0]-xyz[i+1][0])*(xyz[i][0]-xyz[i+1][0]) +
-                   (xyz[i][1]-xyz[i+1][1])*(xyz[i][1]-xyz[i+1][1]) +
-                   (xyz[i][2]-xyz[i+1][2])*(xyz[i][2]-xyz[i+1][2]);
-            if (dist < mindist*mindist) continue;
-            d = aux[i][0]*aux[i+1][0] + aux[i][1]*aux[i+1][1] + 
-                aux[i][2]*aux[i+1][2];
-            if (d < dot) {
-              dot = d;
-              k   = i;
+            if (aux[i][2]   <= 0.0) continue;
+            if (aux[i+1][2] == 0.0) continue;
+            dx[0] = xyz[i+1][0] - xyz[i][0];
+            dx[1] = xyz[i+1][1] - xyz[i][1];
+            dx[2] = xyz[i+1][2] - xyz[i][2];
+            d     = DOT(dx, dx);
+            if (d < tol*tol) {
+              aux[i][2] = -1.0;
+              continue;
             }
+            if (d < dist) continue;
+            dist = d;
+            k    = i;
+          }
+          if (k == -1) break;
+
+          if (npts >= maxpts) {
+            capped = 1;
+            break;
           }
-          if ((dot > dotnrm) || (k == -1)) break;
           /* insert */
+          stat = EG_growEdgeBuf(buf, npts+1);
+          if (stat != EGADS_SUCCESS) {
+            EG_mutexUnlock(flock);
+            return stat;
+          }
+          xyz = buf->xyz;
+          t   = buf->t;
+          aux = buf->aux;
           for (i = npts-1; i > k; i--) {
             xyz[i+1][0] = xyz[i][0];
             xyz[i+1][1] = xyz[i][1];
@@ -2001,299 +2753,418 @@ EG_tessEdges(egTessel *btess, /*@null@*/ int *retess)
           t[k+1] = 0.5*(t[k]+t[k+2]);
           stat   = EG_evaluate(edges[j], &t[k+1], result);
           if (stat != EGADS_SUCCESS) {
-            EG_free(faces);
-            EG_free(edges);
+            EG_mutexUnlock(flock);
             return stat;
           }
-          dist   = sqrt(result[3]*result[3] + result[4]*result[4] +
-                        result[5]*result[5]);
-          if (dist == 0.0) dist = 1.0;
           xyz[k+1][0] = result[0];
           xyz[k+1][1] = result[1];
           xyz[k+1][2] = result[2];
-          aux[k+1][0] = result[3]/dist;
-          aux[k+1][1] = result[4]/dist;
-          aux[k+1][2] = result[5]/dist;
+          aux[k+1][2] = 1.0;
+          stat = EG_getEdgeUV(faces[face-1], edges[j], sense, t[k+1], 
+                              aux[k+1]);
+          if (stat != EGADS_SUCCESS) aux[k+1][2] = 0.0;
+          dx[0] = xyz[k+1][0] - xyz[k][0];
+          dx[1] = xyz[k+1][1] - xyz[k][1];
+          dx[2] = xyz[k+1][2] - xyz[k][2];
+          d     = DOT(dx, dx);
+          dot   = EG_curvNorm(faces[face-1], k, sense*ntype, d, dx, aux);
+          if ((dot > dotnrm) || (dot < -1.1)) aux[k][2] = -1.0;      
+          dx[0] = xyz[k+2][0] - xyz[k+1][0];
+          dx[1] = xyz[k+2][1] - xyz[k+1][1];
+          dx[2] = xyz[k+2][2] - xyz[k+1][2];
+          d     = DOT(dx, dx);
+          dot   = EG_curvNorm(faces[face-1], k+1, sense*ntype, d, dx, aux);
+          if ((dot > dotnrm) || (dot < -1.1)) aux[k+1][2] = -1.0;
           npts++;
         }
+        EG_mutexUnlock(flock);
 #ifdef DEBUG
-        printf("     Angle  Phase npts = %d @ %lf (%lf)\n",
-               npts, dot, dotnrm);
+        printf("     FacNrm Phase npts = %d @ %lf  Face = %d\n",
+               npts, dotnrm, face);
 #endif
       }
-      
-      /* sag - aux is midpoint value */
-      if (btess->params[1] > 0.0) {
-        for (i = 0; i < npts-1; i++) {
-          d    = 0.5*(t[i]+t[i+1]);
-          stat = EG_evaluate(edges[j], &d, result);
-          if (stat != EGADS_SUCCESS) {
-            EG_free(faces);
-            EG_free(edges);
-            return stat;
-          }
-          aux[i][0] = result[0];
-          aux[i][1] = result[1];
-          aux[i][2] = result[2];
-        }
-        while (npts < MAXELEN) {
-          /* find the biggest deviation */
-          k    = -1;
-          dist = 0.0;
-          for (i = 0; i < npts-1; i++) {
-            dot = (xyz[i][0]-xyz[i+1][0])*(xyz[i][0]-xyz[i+1][0]) +
+    }
+  
+  /* max side -- for all curve types */
+
+  if (btess->params[0] > 0.0) {
+    for (i = 0; i < npts-1; i++)
+      aux[i][0] = (xyz[i][0]-xyz[i+1][0])*(xyz[i][0]-xyz[i+1][0]) +
                   (xyz[i][1]-xyz[i+1][1])*(xyz[i][1]-xyz[i+1][1]) +
                   (xyz[i][2]-xyz[i+1][2])*(xyz[i][2]-xyz[i+1][2]);
-            if (dot < mindist*mindist) continue;
-            mid[0] = 0.5*(xyz[i][0] + xyz[i+1][0]);
-            mid[1] = 0.5*(xyz[i][1] + xyz[i+1][1]);
-            mid[2] = 0.5*(xyz[i][2] + xyz[i+1][2]);
-            d      = (aux[i][0]-mid[0])*(aux[i][0]-mid[0]) +
-                     (aux[i][1]-mid[1])*(aux[i][1]-mid[1]) +
-                     (aux[i][2]-mid[2])*(aux[i][2]-mid[2]);
-            if (d > dist) {
-              dist = d;
-              k    = i;
-            }
-          }
-          if ((dist < btess->params[1]*btess->params[1]) || 
-              (k == -1)) break;
-          /* insert */
-          for (i = npts-1; i > k; i--) {
-            xyz[i+1][0] = xyz[i][0];
-            xyz[i+1][1] = xyz[i][1];
-            xyz[i+1][2] = xyz[i][2];
-            aux[i+1][0] = aux[i][0];
-            aux[i+1][1] = aux[i][1];
-            aux[i+1][2] = aux[i][2];
-            t[i+1]      = t[i];
-          }
-          t[k+1]      = 0.5*(t[k]+t[k+2]);
-          xyz[k+1][0] = aux[k][0];
-          xyz[k+1][1] = aux[k][1];
-          xyz[k+1][2] = aux[k][2];
-          d    = 0.5*(t[k+1]+t[k+2]);
-          stat = EG_evaluate(edges[j], &d, result);
-          if (stat != EGADS_SUCCESS) {
-            EG_free(faces);
-            EG_free(edges);
-            return stat;
-          }
-          aux[k+1][0] = result[0];
-          aux[k+1][1] = result[1];
-          aux[k+1][2] = result[2];
-          d    = 0.5*(t[k]+t[k+1]);
-          stat = EG_evaluate(edges[j], &d, result);
-          if (stat != EGADS_SUCCESS) {
-            EG_free(faces);
-            EG_free(edges);
-            return stat;
-          }
-          aux[k][0] = result[0];
-          aux[k][1] = result[1];
-          aux[k][2] = result[2];
-          npts++;
+    aux[npts-1][0] = 0.0;
+    for (;;) {
+      /* find the biggest segment */
+      k    = 0;
+      dist = aux[0][0];
+      for (i = 1; i < npts-1; i++) {
+        d = aux[i][0];
+        if (d > dist) {
+          dist = d;
+          k    = i;
         }
+      }
+      if (dist < btess->params[0]*btess->params[0]) break;
+      if (npts >= maxpts) {
+        capped = 1;
+        break;
+      }
+      /* insert */
+      stat = EG_growEdgeBuf(buf, npts+1);
+      if (stat != EGADS_SUCCESS) return stat;
+      xyz = buf->xyz;
+      t   = buf->t;
+      aux = buf->aux;
+      for (i = npts-1; i > k; i--) {
+        xyz[i+1][0] = xyz[i][0];
+        xyz[i+1][1] = xyz[i][1];
+        xyz[i+1][2] = xyz[i][2];
+        aux[i+1][0] = aux[i][0];
+        t[i+1]      = t[i];
+      }
+      t[k+1] = 0.5*(t[k]+t[k+2]);
+      stat   = EG_evaluate(edges[j], &t[k+1], result);
+      if (stat != EGADS_SUCCESS) return stat;
+      xyz[k+1][0] = result[0];
+      xyz[k+1][1] = result[1];
+      xyz[k+1][2] = result[2];
+      npts++;
+      d = (xyz[k][0]-xyz[k+1][0])*(xyz[k][0]-xyz[k+1][0]) +
+          (xyz[k][1]-xyz[k+1][1])*(xyz[k][1]-xyz[k+1][1]) +
+          (xyz[k][2]-xyz[k+1][2])*(xyz[k][2]-xyz[k+1][2]);
+      aux[k][0] = d;
+      if (d < 0.0625*btess->params[0]*btess->params[0]) break;
+      d = (xyz[k+2][0]-xyz[k+1][0])*(xyz[k+2][0]-xyz[k+1][0]) +
+          (xyz[k+2][1]-xyz[k+1][1])*(xyz[k+2][1]-xyz[k+1][1]) +
+          (xyz[k+2][2]-xyz[k+1][2])*(xyz[k+2][2]-xyz[k+1][2]);
+      aux[k+1][0] = d;
+      if (d < 0.0625*btess->params[0]*btess->params[0]) break;
+    }
+  }
 #ifdef DEBUG
-        printf("     Sag    Phase npts = %d @ %lf (%lf)\n", 
-               npts, sqrt(dist), btess->params[1]);
+  if (btess->params[0] > 0.0)
+    printf("     MxSide Phase npts = %d @ %lf (%lf)\n", 
+           npts, sqrt(dist), btess->params[0]);
 #endif
-      }     
+  /* only when a refinement phase wanted more points than allowed */
+  if ((capped == 1) && (outLevel > 0))
+    printf(" EGADS Warning: Edge %d has the maximum of %d points (EG_tessEdges)!\n",
+           j+1, maxpts);
+  
+  /* fill in the 1D structure */
+  if (EG_allocTess1D(&btess->tess1d[j], npts) != EGADS_SUCCESS) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Alloc %d Pts Edge %d (EG_tessEdges)!\n", 
+             npts, j+1);
+    return EGADS_MALLOC;  
+  }
+  for (i = 0; i < npts; i++) {
+    btess->tess1d[j].xyz[3*i  ] = xyz[i][0];
+    btess->tess1d[j].xyz[3*i+1] = xyz[i][1];
+    btess->tess1d[j].xyz[3*i+2] = xyz[i][2];
+    btess->tess1d[j].t[i]       = t[i];
+  }
+  btess->tess1d[j].npts = npts;
+
+  return EGADS_SUCCESS;
+}
+
+
+static void
+EG_tessEdgesWork(void *arg)
+{
+  int      j, stat;
+  edgeBuf  *buf;
+  edgeWork *ew;
+
+  ew  = (edgeWork *) arg;
+  EG_mutexLock(ew->mutex);
+  buf = &ew->bufs[ew->nbuf];
+  ew->nbuf++;
+  EG_mutexUnlock(ew->mutex);
+
+  for (;;) {
+    EG_mutexLock(ew->mutex);
+    j = ew->next;
+    if (ew->retess != NULL)
+      while ((j < ew->nedge) && (ew->retess[j] == 0)) j++;
+    ew->next = j+1;
+    EG_mutexUnlock(ew->mutex);
+    if (j >= ew->nedge) break;
+
+    stat = EG_tessEdge(ew->btess, j, ew->edges, ew->faces, ew->dotnrm,
+                       ew->maxpts, buf, ew->flocks, ew->fslot);
+    if (stat != EGADS_SUCCESS) {
+      /* report the lowest failing Edge -- all below it have been handed out */
+      EG_mutexLock(ew->mutex);
+      if ((ew->err == -1) || (j < ew->err)) {
+        ew->stat = stat;
+        ew->err  = j;
+      }
+      ew->next = ew->nedge;
+      EG_mutexUnlock(ew->mutex);
+      break;
+    }
+  }
+}
+
+
+static int
+EG_tessEdges(egTessel *btess, /*@null@*/ int *retess)
+{
+  int      i, j, k, n, npts, stat, outLevel, nedge, oclass, mtype, nnode;
+  int      nf, nface, nloop, ndum, nthread, nbuf, *senses, *finds;
+  double   dist, limits[2];
+  edgeWork ew;
+  egObject *body, *geom, **faces, **loops, **edges, **nodes, **dum;
+  
+  body     = btess->src;
+  outLevel = EG_outLevel(body);
+  
+  stat = EG_getBodyTopos(body, NULL, EDGE, &nedge, &edges);
+  if (stat != EGADS_SUCCESS) return stat;
+  stat = EG_getBodyTopos(body, NULL, FACE, &nface, &faces);
+  if (stat != EGADS_SUCCESS) return stat;
+  
+  if (retess == NULL) {
+    btess->tess1d = (egTess1D *) EG_alloc(nedge*sizeof(egTess1D));
+    if (btess->tess1d == NULL) {
+      if (outLevel > 0)
+        printf(" EGADS Error: Alloc %d Edges (EG_tessEdges)!\n", nedge);
+      EG_free(faces);
+      EG_free(edges);
+      return EGADS_MALLOC;  
+    }
+    for (j = 0; j < nedge; j++) {
+      btess->tess1d[j].obj            = edges[j];
+      btess->tess1d[j].faces[0].index = 0;
+      btess->tess1d[j].faces[0].nface = 0;
+      btess->tess1d[j].faces[0].faces = NULL;
+      btess->tess1d[j].faces[0].tric  = NULL;
+      btess->tess1d[j].faces[1].index = 0;
+      btess->tess1d[j].faces[1].nface = 0;
+      btess->tess1d[j].faces[1].faces = NULL;
+      btess->tess1d[j].faces[1].tric  = NULL;
+      btess->tess1d[j].nodes[0]       = 0;
+      btess->tess1d[j].nodes[1]       = 0;
+      btess->tess1d[j].xyz            = NULL;
+      btess->tess1d[j].t              = NULL;
+      btess->tess1d[j].npts           = 0;
     }
-    
-    /* look at non-planar faces for curvature -- aux is uv*/
-    if (btess->params[2] > 0.0)
-      for (n = 0; n < 2; n++) {
-                    sense =  1;
-        if (n == 0) sense = -1;
-        for (nf = 0; nf < btess->tess1d[j].faces[n].nface; nf++) {
-          face = btess->tess1d[j].faces[n].index;
-          if (btess->tess1d[j].faces[n].nface > 1)
-            face = btess->tess1d[j].faces[n].faces[nf];
-          if (face <= 0) continue;
-          stat = EG_getTopology(faces[face-1], &ref, &oclass, &ntype, range,
-                                &ndum, &dum, &senses);
-          if (stat != EGADS_SUCCESS) continue;
-          if (ref == NULL) continue;
-          if (ref->mtype == PLANE) continue;
-          stat = EG_getTolerance(faces[face-1], &tol);
-          if (stat != EGADS_SUCCESS) continue;
-          if (btess->params[1] > tol) tol = btess->params[1];
-
-          for (i = 0; i < npts; i++) {
-            aux[i][2] = 1.0;
-            stat = EG_getEdgeUV(faces[face-1], edges[j], sense, t[i], 
-                                aux[i]);
-            if (stat != EGADS_SUCCESS) aux[i][2] = 0.0;
-          }
-          for (i = 0; i < npts-1; i++) {
-            if (aux[i][2]   <= 0.0) continue;
-            if (aux[i+1][2] == 0.0) continue;
-            dx[0] = xyz[i+1][0] - xyz[i][0];
-            dx[1] = xyz[i+1][1] - xyz[i][1];
-            dx[2] = xyz[i+1][2] - xyz[i][2];
-            d     = DOT(dx, dx);
-            if (d < tol*tol) {
-              aux[i][2] = -1.0;
-              continue;
-            }
-            /* get normal at mid-point in UV */
-            dot = EG_curvNorm(faces[face-1], i, sense*ntype, d, dx, aux);
-            if ((dot > dotnrm) || (dot < -1.1)) aux[i][2] = -1.0;
-          }
-
-          while (npts < MAXELEN) {
-            /* find the largest segment with Face curvature too big */
-            k    = -1;
-            dist =  tol*tol;
-            for (i = 0; i < npts-1; i++) {
-              if (aux[i][2]   <= 0.0) continue;
-              if (aux[i+1][2] == 0.0) continue;
-              dx[0] = xyz[i+1][0] - xyz[i][0];
-              dx[1] = xyz[i+1][1] - xyz[i][1];
-              dx[2] = xyz[i+1][2] - xyz[i][2];
-              d     = DOT(dx, dx);
-              if (d < tol*tol) {
-                aux[i][2] = -1.0;
-                continue;
+    btess->nEdge = nedge;
+  
+    /* get the face indices (if any) */
+    for (i = 0; i < nface; i++) {
+      stat = EG_getTopology(faces[i], &geom, &oclass, &mtype, limits,
+                            &nloop, &loops, &senses);
+      if (stat != EGADS_SUCCESS) continue;
+      for (j = 0; j < nloop; j++) {
+        stat = EG_getTopology(loops[j], &geom, &oclass, &mtype, limits,
+                            &ndum, &dum, &senses);
+        if (stat != EGADS_SUCCESS) continue;
+        for (k = 0; k < ndum; k++) {
+          n = EG_indexBodyTopo(body, dum[k]);
+          if (n <= EGADS_SUCCESS) continue;
+          if (senses[k] < 0) {
+            if (btess->tess1d[n-1].faces[0].nface != 0) {
+              if (btess->tess1d[n-1].faces[0].nface == 1) {
+                btess->tess1d[n-1].faces[0].faces = (int *) EG_alloc(2*sizeof(int));
+                if (btess->tess1d[n-1].faces[0].faces == NULL) {
+                  if (outLevel > 0)
+                    printf(" EGADS Error: Alloc (-) Edge %d (EG_tessEdges)!\n", n);
+                  EG_free(faces);
+                  EG_free(edges);
+                  return EGADS_MALLOC;
+                }
+                btess->tess1d[n-1].faces[0].faces[0] = btess->tess1d[n-1].faces[0].index;
+                btess->tess1d[n-1].faces[0].faces[1] = i+1;
+              } else {
+                finds = (int *) EG_reall( btess->tess1d[n-1].faces[0].faces,
+                                         (btess->tess1d[n-1].faces[0].nface+1)*sizeof(int));
+                if (finds == NULL) {
+                  if (outLevel > 0)
+                    printf(" EGADS Error: ReAlloc (-) Edge %d (EG_tessEdges)!\n", n);
+                  EG_free(faces);
+                  EG_free(edges);
+                  return EGADS_MALLOC;
+                } 
+                finds[btess->tess1d[n-1].faces[0].nface] = i+1;
+                btess->tess1d[n-1].faces[0].faces = finds;
               }
-              if (d < dist) continue;
-              dist = d;
-              k    = i;
             }
-            if (k == -1) break;
-
-            /* insert */
-            for (i = npts-1; i > k; i--) {
-              xyz[i+1][0] = xyz[i][0];
-              xyz[i+1][1] = xyz[i][1];
-              xyz[i+1][2] = xyz[i][2];
-              aux[i+1][0] = aux[i][0];
-              aux[i+1][1] = aux[i][1];
-              aux[i+1][2] = aux[i][2];
-              t[i+1]      = t[i];
-            }
-            t[k+1] = 0.5*(t[k]+t[k+2]);
-            stat   = EG_evaluate(edges[j], &t[k+1], result);
-            if (stat != EGADS_SUCCESS) {
-              EG_free(faces);
-              EG_free(edges);
-              return stat;
+            btess->tess1d[n-1].faces[0].index = i+1;
+            btess->tess1d[n-1].faces[0].nface++;
+          } else {
+            if (btess->tess1d[n-1].faces[1].nface != 0) {
+              if (btess->tess1d[n-1].faces[1].nface == 1) {
+                btess->tess1d[n-1].faces[1].faces = (int *) EG_alloc(2*sizeof(int));
+                if (btess->tess1d[n-1].faces[1].faces == NULL) {
+                  if (outLevel > 0)
+                    printf(" EGADS Error: Alloc (+) Edge %d (EG_tessEdges)!\n", n);
+                  EG_free(faces);
+                  EG_free(edges);
+                  return EGADS_MALLOC;
+                }
+                btess->tess1d[n-1].faces[1].faces[0] = btess->tess1d[n-1].faces[1].index;
+                btess->tess1d[n-1].faces[1].faces[1] = i+1;
+              } else {
+                finds = (int *) EG_reall( btess->tess1d[n-1].faces[1].faces,
+                                         (btess->tess1d[n-1].faces[1].nface+1)*sizeof(int));
+                if (finds == NULL) {
+                  if (outLevel > 0)
+                    printf(" EGADS Error: ReAlloc (+) Edge %d (EG_tessEdges)!\n", n);
+                  EG_free(faces);
+                  EG_free(edges);
+                  return EGADS_MALLOC;
+                }
+                finds[btess->tess1d[n-1].faces[1].nface] = i+1;
+                btess->tess1d[n-1].faces[1].faces = finds;
+              }
             }
-            xyz[k+1][0] = result[0];
-            xyz[k+1][1] = result[1];
-            xyz[k+1][2] = result[2];
-            aux[k+1][2] = 1.0;
-            stat = EG_getEdgeUV(faces[face-1], edges[j], sense, t[k+1], 
-                                aux[k+1]);
-            if (stat != EGADS_SUCCESS) aux[k+1][2] = 0.0;
-            dx[0] = xyz[k+1][0] - xyz[k][0];
-            dx[1] = xyz[k+1][1] - xyz[k][1];
-            dx[2] = xyz[k+1][2] - xyz[k][2];
-            d     = DOT(dx, dx);
-            dot   = EG_curvNorm(faces[face-1], k, sense*ntype, d, dx, aux);
-            if ((dot > dotnrm) || (dot < -1.1)) aux[k][2] = -1.0;      
-            dx[0] = xyz[k+2][0] - xyz[k+1][0];
-            dx[1] = xyz[k+2][1] - xyz[k+1][1];
-            dx[2] = xyz[k+2][2] - xyz[k+1][2];
-            d     = DOT(dx, dx);
-            dot   = EG_curvNorm(faces[face-1], k+1, sense*ntype, d, dx, aux);
-            if ((dot > dotnrm) || (dot < -1.1)) aux[k+1][2] = -1.0;
-            npts++;
+            btess->tess1d[n-1].faces[1].index = i+1;
+            btess->tess1d[n-1].faces[1].nface++;
           }
-#ifdef DEBUG
-          printf("     FacNrm Phase npts = %d @ %lf  Face = %d\n",
-                 npts, dotnrm, face);
-#endif
         }
       }
-    
-    /* max side -- for all curve types */
-
-    if (btess->params[0] > 0.0) {
-      for (i = 0; i < npts-1; i++)
-        aux[i][0] = (xyz[i][0]-xyz[i+1][0])*(xyz[i][0]-xyz[i+1][0]) +
-                    (xyz[i][1]-xyz[i+1][1])*(xyz[i][1]-xyz[i+1][1]) +
-                    (xyz[i][2]-xyz[i+1][2])*(xyz[i][2]-xyz[i+1][2]);
-      aux[npts-1][0] = 0.0;
-      while (npts < MAXELEN) {
-        /* find the biggest segment */
-        k    = 0;
-        dist = aux[0][0];
-        for (i = 1; i < npts-1; i++) {
-          d = aux[i][0];
-          if (d > dist) {
-            dist = d;
-            k    = i;
-          }
-        }
-        if (dist < btess->params[0]*btess->params[0]) break;
-        /* insert */
-        for (i = npts-1; i > k; i--) {
-          xyz[i+1][0] = xyz[i][0];
-          xyz[i+1][1] = xyz[i][1];
-          xyz[i+1][2] = xyz[i][2];
-          aux[i+1][0] = aux[i][0];
-          t[i+1]      = t[i];
+    }
+    /* report any non-manifold Edges */
+    if (outLevel > 1)
+      for (j = 0; j < nedge; j++) {
+        if (btess->tess1d[j].faces[0].nface > 1) {
+          printf(" EGADS Internal: Non-manifold Edge %d (-) with Faces", j+1);
+          if (btess->tess1d[j].faces[0].faces != NULL)
+            for (k = 0; k < btess->tess1d[j].faces[0].nface; k++)
+              printf(" %d", btess->tess1d[j].faces[0].faces[k]);
+          printf("!\n");
         }
-        t[k+1] = 0.5*(t[k]+t[k+2]);
-        stat   = EG_evaluate(edges[j], &t[k+1], result);
-        if (stat != EGADS_SUCCESS) {
-          EG_free(faces);
-          EG_free(edges);
-          return stat;
+        if (btess->tess1d[j].faces[1].nface > 1) {
+          printf(" EGADS Internal: Non-manifold Edge %d (+) with Faces", j+1);
+          if (btess->tess1d[j].faces[1].faces != NULL)
+            for (k = 0; k < btess->tess1d[j].faces[1].nface; k++)
+              printf(" %d", btess->tess1d[j].faces[1].faces[k]);
+          printf("!\n");
         }
-        xyz[k+1][0] = result[0];
-        xyz[k+1][1] = result[1];
-        xyz[k+1][2] = result[2];
-        npts++;
-        d = (xyz[k][0]-xyz[k+1][0])*(xyz[k][0]-xyz[k+1][0]) +
-            (xyz[k][1]-xyz[k+1][1])*(xyz[k][1]-xyz[k+1][1]) +
-            (xyz[k][2]-xyz[k+1][2])*(xyz[k][2]-xyz[k+1][2]);
-        aux[k][0] = d;
-        if (d < 0.0625*btess->params[0]*btess->params[0]) break;
-        d = (xyz[k+2][0]-xyz[k+1][0])*(xyz[k+2][0]-xyz[k+1][0]) +
-            (xyz[k+2][1]-xyz[k+1][1])*(xyz[k+2][1]-xyz[k+1][1]) +
-            (xyz[k+2][2]-xyz[k+1][2])*(xyz[k+2][2]-xyz[k+1][2]);
-        aux[k+1][0] = d;
-        if (d < 0.0625*btess->params[0]*btess->params[0]) break;
       }
+  }
+
+  /* do the Edges -- possibly in parallel */
+
+  dist = fabs(btess->params[2]);
+  if (dist > 30.0) dist = 30.0;
+  if (dist <  0.5) dist =  0.5;
+  ew.btess  = btess;
+  ew.edges  = edges;
+  ew.faces  = faces;
+  ew.nedge  = nedge;
+  ew.retess = retess;
+  ew.next   = 0;
+  ew.nbuf   = 0;
+  ew.stat   = EGADS_SUCCESS;
+  ew.err    = -1;
+  ew.mutex  = NULL;
+  ew.dotnrm = cos(PI*dist/180.0);
+  ew.fslot  = NULL;
+  for (i = 0; i < FACELOCKS; i++) ew.flocks[i] = NULL;
+  ew.maxpts = EG_tessMaxPts(body);
+
+  for (n = j = 0; j < nedge; j++)
+    if (retess != NULL) {
+      if (retess[j] != 0) n++;
+    } else {
+      n++;
     }
-#ifdef DEBUG
-    if (btess->params[0] > 0.0)
-      printf("     MxSide Phase npts = %d @ %lf (%lf)\n", 
-             npts, sqrt(dist), btess->params[0]);
-#endif
-    
-    /* fill in the 1D structure */
-    btess->tess1d[j].xyz = (double *) EG_alloc(3*npts*sizeof(double));
-    if (btess->tess1d[j].xyz == NULL) {
-      if (outLevel > 0)
-        printf(" EGADS Error: Alloc %d Pts Edge %d (EG_tessEdges)!\n", 
-               npts, j+1);
-      EG_free(faces);
-      EG_free(edges);
-      return EGADS_MALLOC;  
+  nthread = EG_tessThreads(body, n);
+  ew.bufs = (edgeBuf *) EG_alloc(nthread*sizeof(edgeBuf));
+  if (ew.bufs == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Alloc %d Buffers (EG_tessEdges)!\n", nthread);
+    EG_free(faces);
+    EG_free(edges);
+    return EGADS_MALLOC;
+  }
+  for (i = 0; i < nthread; i++) {
+    ew.bufs[i].mpts = MAXELEN;
+    ew.bufs[i].xyz  = (double (*)[3]) EG_alloc(3*MAXELEN*sizeof(double));
+    ew.bufs[i].t    = (double *)      EG_alloc(  MAXELEN*sizeof(double));
+    ew.bufs[i].aux  = (double (*)[3]) EG_alloc(3*MAXELEN*sizeof(double));
+    if ((ew.bufs[i].xyz == NULL) || (ew.bufs[i].t == NULL) ||
+        (ew.bufs[i].aux == NULL)) {
+      if (ew.bufs[i].aux != NULL) EG_free(ew.bufs[i].aux);
+      if (ew.bufs[i].t   != NULL) EG_free(ew.bufs[i].t);
+      if (ew.bufs[i].xyz != NULL) EG_free(ew.bufs[i].xyz);
+      break;
     }
-    btess->tess1d[j].t = (double *) EG_alloc(npts*sizeof(double));
-    if (btess->tess1d[j].t == NULL) {
-      EG_free(btess->tess1d[j].xyz);
-      btess->tess1d[j].xyz = NULL;
-      if (outLevel > 0)
-        printf(" EGADS Error: Alloc %d Ts Edge %d (EG_tessEdges)!\n", 
-               npts, j+1);
+  }
+  nthread = nbuf = i;
+  if (nthread > 1) {
+    /* a Face on a shared surface uses its group's slot, the rest their own */
+    ew.fslot = (int *) EG_alloc(nface*sizeof(int));
+    ew.mutex = EG_mutexCreate();
+    stat     = EGADS_MALLOC;
+    if ((ew.fslot != NULL) && (ew.mutex != NULL)) {
+      stat = EG_surfaceGroups(nface, faces, NULL, ew.fslot);
+      if (stat == EGADS_SUCCESS) stat = EG_makeSurfLocks(ew.flocks);
+    }
+    if (stat != EGADS_SUCCESS) {
+      if (ew.fslot != NULL) EG_free(ew.fslot);
+      if (ew.mutex != NULL) EG_mutexDestroy(ew.mutex);
+      ew.fslot = NULL;
+      ew.mutex = NULL;
+      nthread  = 1;
+    } else {
+      for (i = 0; i < nface; i++)
+        if (ew.fslot[i] < 0) ew.fslot[i] = i;
+    }
+  }
+  if (nthread == 1) {
+    EG_tessEdgesWork(&ew);
+  } else if (nthread > 1) {
+    EG_runThreads(nthread, EG_tessEdgesWork, &ew);
+    EG_mutexDestroy(ew.mutex);
+    for (i = 0; i < FACELOCKS; i++) EG_mutexDestroy(ew.flocks[i]);
+    EG_free(ew.fslot);
+  } else {
+    if (outLevel > 0)
+      printf(" EGADS Error: Alloc Edge Buffers (EG_tessEdges)!\n");
+    ew.stat = EGADS_MALLOC;
+    ew.err  = 0;
+  }
+  for (i = 0; i < nbuf; i++) {
+    EG_free(ew.bufs[i].aux);
+    EG_free(ew.bufs[i].t);
+    EG_free(ew.bufs[i].xyz);
+  }
+  EG_free(ew.bufs);
+  if (ew.err != -1) {
+    EG_free(faces);
+    EG_free(edges);
+    return ew.stat;
+  }
+
+  /* serial reduction -- Node indices & Face connectivity storage */
+
+  for (j = 0; j < nedge; j++) {
+    if (retess != NULL)
+      if (retess[j] == 0) continue;
+    stat = EG_getTopology(edges[j], &geom, &oclass, &mtype, limits,
+                          &nnode, &nodes, &senses);
+    if (stat != EGADS_SUCCESS) {
       EG_free(faces);
       EG_free(edges);
-      return EGADS_MALLOC;  
+      return stat;
     }
+    btess->tess1d[j].nodes[0] = EG_indexBodyTopo(body, nodes[0]);
+    btess->tess1d[j].nodes[1] = btess->tess1d[j].nodes[0];
+    if (mtype == TWONODE)
+      btess->tess1d[j].nodes[1] = EG_indexBodyTopo(body, nodes[1]);
+    if (mtype == DEGENERATE) continue;
+    npts = btess->tess1d[j].npts;
     nf = btess->tess1d[j].faces[0].nface;
     if (nf > 0) {
       btess->tess1d[j].faces[0].tric = (int *) EG_alloc((nf*(npts-1))*sizeof(int));
       if (btess->tess1d[j].faces[0].tric == NULL) {
-        EG_free(btess->tess1d[j].t);
-        btess->tess1d[j].t   = NULL;
-        EG_free(btess->tess1d[j].xyz);
-        btess->tess1d[j].xyz = NULL;
+        EG_freeTess1D(&btess->tess1d[j]);
+        btess->tess1d[j].npts = 0;
         if (outLevel > 0)
           printf(" EGADS Error: Alloc %d Tric- Edge %d (EG_tessEdges)!\n", 
                  npts, j+1);
@@ -2309,10 +3180,8 @@ EG_tessEdges(egTessel *btess, /*@null@*/ int *retess)
         if (btess->tess1d[j].faces[0].tric != NULL)
           EG_free(btess->tess1d[j].faces[0].tric);
         btess->tess1d[j].faces[0].tric = NULL;
-        EG_free(btess->tess1d[j].t);
-        btess->tess1d[j].t   = NULL;
-        EG_free(btess->tess1d[j].xyz);
-        btess->tess1d[j].xyz = NULL;
+        EG_freeTess1D(&btess->tess1d[j]);
+        btess->tess1d[j].npts = 0;
         if (outLevel > 0)
           printf(" EGADS Error: Alloc %d Tric+ Edge %d (EG_tessEdges)!\n", 
                  npts, j+1);
@@ -2321,12 +3190,6 @@ EG_tessEdges(egTessel *btess, /*@null@*/ int *retess)
         return EGADS_MALLOC;
       }
     }
-    for (i = 0; i < npts; i++) {
-      btess->tess1d[j].xyz[3*i  ] = xyz[i][0];
-      btess->tess1d[j].xyz[3*i+1] = xyz[i][1];
-      btess->tess1d[j].xyz[3*i+2] = xyz[i][2];
-      btess->tess1d[j].t[i]       = t[i];
-    }
     for (i = 0; i < npts-1; i++) {
       nf = btess->tess1d[j].faces[0].nface;
       for (k = 0; k < nf; k++)
@@ -2335,7 +3198,6 @@ EG_tessEdges(egTessel *btess, /*@null@*/ int *retess)
       for (k = 0; k < nf; k++)
         btess->tess1d[j].faces[1].tric[i*nf+k] = 0.0;
     }
-    btess->tess1d[j].npts = npts;
   }
 
   EG_free(faces);
@@ -2392,6 +3254,11 @@ EG_makeTessGeom(egObject *obj, double *params, int *sizes, egObject **tess)
   btess->nFace  = 0;
   btess->nu     = nu;
   btess->nv     = nv;
+  btess->nbytes = 0;
+  btess->global = NULL;
+  btess->single = NULL;
+  btess->mapped = NULL;
+  btess->msize  = 0;
   
   /* get the storage for the tessellation */
   dtess = (double *) EG_alloc(3*np*sizeof(double));
@@ -2474,6 +3341,7 @@ EG_makeTessGeom(egObject *obj, double *params, int *sizes, egObject **tess)
   }
 
   *tess = gtess;
+  EG_statsTess(gtess, 0);
   return EGADS_SUCCESS;
 }
 
@@ -2526,10 +3394,7 @@ EG_deleteQuads(egTessel *btess, int iface)
   int i, j;
   
   i = btess->nFace + iface - 1;
-  if (btess->tess2d[i].xyz    != NULL) EG_free(btess->tess2d[i].xyz);
-  if (btess->tess2d[i].uv     != NULL) EG_free(btess->tess2d[i].uv);
-  if (btess->tess2d[i].ptype  != NULL) EG_free(btess->tess2d[i].ptype);
-  if (btess->tess2d[i].pindex != NULL) EG_free(btess->tess2d[i].pindex);
+  EG_freeTess2D(&btess->tess2d[i]);
   for (j = 0; j < btess->tess2d[i].npatch; j++) {
     if (btess->tess2d[i].patch[j].ipts != NULL) 
       EG_free(btess->tess2d[i].patch[j].ipts);
@@ -2537,10 +3402,6 @@ EG_deleteQuads(egTessel *btess, int iface)
       EG_free(btess->tess2d[i].patch[j].bounds);
   }
   EG_free(btess->tess2d[i].patch);
-  btess->tess2d[i].xyz    = NULL;
-  btess->tess2d[i].uv     = NULL;
-  btess->tess2d[i].ptype  = NULL;
-  btess->tess2d[i].pindex = NULL;
   btess->tess2d[i].npts   = 0;
   btess->tess2d[i].patch  = NULL;
   btess->tess2d[i].npatch = 0;
@@ -2593,6 +3454,8 @@ EG_moveEdgeVert(egObject *tess, int eIndex, int vIndex, double t)
       printf(" EGADS Error: No Edge Tessellations (EG_moveEdgeVert)!\n");
     return EGADS_NODATA;  
   }
+  stat = EG_ownTess(btess);
+  if (stat != EGADS_SUCCESS) return stat;
   if ((eIndex < 1) || (eIndex > btess->nEdge)) {
     if (outLevel > 0)
       printf(" EGADS Error: eIndex = %d [1-%d] (EG_moveEdgeVert)!\n",
@@ -2613,6 +3476,8 @@ EG_moveEdgeVert(egObject *tess, int eIndex, int vIndex, double t)
                 btess->tess1d[eIndex-1].t[vIndex]);
     return EGADS_RANGERR;
   }
+  EG_freeTessGlobal(btess);
+  EG_freeTessFloat(btess);
   stat = EG_getBodyTopos(btess->src, NULL, EDGE, &nedge, &edges);
   if (stat != EGADS_SUCCESS) return stat;
   stat = EG_getBodyTopos(btess->src, NULL, FACE, &nface, &faces);
@@ -2684,6 +3549,7 @@ EG_moveEdgeVert(egObject *tess, int eIndex, int vIndex, double t)
   EG_free(faces);
   EG_free(edges);
   
+  EG_statsTess(tess, 0);
   return EGADS_SUCCESS;
 }
 
@@ -2691,7 +3557,7 @@ EG_moveEdgeVert(egObject *tess, int eIndex, int vIndex, double t)
 int
 EG_deleteEdgeVert(egObject *tess, int eIndex, int vIndex, int dir)
 {
-  int      i, k, m, n, nf, outLevel, iface, iv[2], it, ivert;
+  int      i, k, m, n, nf, stat, outLevel, iface, iv[2], it, ivert;
   int      n1, n2, ie, i1, i2, i3, pt1, pi1, pt2, pi2, ref, nfr;
   egTessel *btess;
   egObject *obj;
@@ -2739,6 +3605,8 @@ EG_deleteEdgeVert(egObject *tess, int eIndex, int vIndex, int dir)
       printf(" EGADS Error: No Edge Tessellations (EG_deleteEdgeVert)!\n");
     return EGADS_NODATA;  
   }
+  stat = EG_ownTess(btess);
+  if (stat != EGADS_SUCCESS) return stat;
   if ((eIndex < 1) || (eIndex > btess->nEdge)) {
     if (outLevel > 0)
       printf(" EGADS Error: eIndex = %d [1-%d] (EG_deleteEdgeVert)!\n",
@@ -2751,6 +3619,9 @@ EG_deleteEdgeVert(egObject *tess, int eIndex, int vIndex, int dir)
              vIndex, btess->tess1d[eIndex-1].npts-1);
     return EGADS_INDEXERR;
   }
+
+  EG_freeTessGlobal(btess);
+  EG_freeTessFloat(btess);
  
   /* fix up each face */
   for (m = 0; m < 2; m++) {
@@ -2994,6 +3865,7 @@ EG_deleteEdgeVert(egObject *tess, int eIndex, int vIndex, int dir)
   EG_checkTriangulation(btess);
 #endif
 
+  EG_statsTess(tess, 0);
   return EGADS_SUCCESS;
 }
 
@@ -3007,6 +3879,8 @@ EG_insertEdgeVerts(egObject *tess, int eIndex, int vIndex, int npts,
   int      i1, i2, i3, cnt, stripe;
   int      *etric[2], *pindex, *ptype, *tris, *tric;
   double   result[9], *vals, *xyzs, *ts, *xyz, *uv;
+  egTess1D etess;
+  egTess2D ftess;
   egTessel *btess;
   egObject *obj, **edges, **faces;
 
@@ -3059,6 +3933,8 @@ EG_insertEdgeVerts(egObject *tess, int eIndex, int vIndex, int npts,
       printf(" EGADS Error: No Edge Tessellations (EG_insertEdgeVerts)!\n");
     return EGADS_NODATA;  
   }
+  stat = EG_ownTess(btess);
+  if (stat != EGADS_SUCCESS) return stat;
   if ((eIndex < 1) || (eIndex > btess->nEdge)) {
     if (outLevel > 0)
       printf(" EGADS Error: eIndex = %d [1-%d] (EG_insertEdgeVerts)!\n",
@@ -3148,6 +4024,8 @@ EG_insertEdgeVerts(egObject *tess, int eIndex, int vIndex, int npts,
              npts, stripe);
     return EGADS_MALLOC;
   }
+  EG_freeTessGlobal(btess);
+  EG_freeTessFloat(btess);
   stat = EG_getBodyTopos(btess->src, NULL, EDGE, &nedge, &edges);
   if (stat != EGADS_SUCCESS) {
     EG_free(vals);
@@ -3198,19 +4076,16 @@ EG_insertEdgeVerts(egObject *tess, int eIndex, int vIndex, int npts,
   EG_free(edges);
   
   /* get all of the Edge memory we will need */
-  xyzs = (double *) EG_alloc(3*(npts+btess->tess1d[eIndex-1].npts)*
-                             sizeof(double));
-  ts   = (double *) EG_alloc(  (npts+btess->tess1d[eIndex-1].npts)*
-                             sizeof(double));
-  if ((xyzs == NULL) || (ts == NULL)) {
+  if (EG_allocTess1D(&etess, npts+btess->tess1d[eIndex-1].npts) !=
+      EGADS_SUCCESS) {
     if (outLevel > 0)
       printf(" EGADS Error: Malloc on Edge %d %d (EG_insertEdgeVerts)!\n",
              npts, btess->tess1d[eIndex-1].npts);
-    if (ts   != NULL) EG_free(ts);
-    if (xyzs != NULL) EG_free(xyzs);
     EG_free(vals);
     return EGADS_MALLOC;
   }
+  xyzs = etess.xyz;
+  ts   = etess.t;
   etric[0] = etric[1] = NULL;
   nf = btess->tess1d[eIndex-1].faces[0].nface;
   if (nf > 0) {
@@ -3220,8 +4095,7 @@ EG_insertEdgeVerts(egObject *tess, int eIndex, int vIndex, int npts,
       if (outLevel > 0)
         printf(" EGADS Error: Malloc on Edge- %d %d (EG_insertEdgeVerts)!\n",
                npts, btess->tess1d[eIndex-1].npts-1);
-      EG_free(ts);
-      EG_free(xyzs);
+      EG_freeTess1D(&etess);
       EG_free(vals);
       return EGADS_MALLOC;
     }
@@ -3235,8 +4109,7 @@ EG_insertEdgeVerts(egObject *tess, int eIndex, int vIndex, int npts,
         printf(" EGADS Error: Malloc on Edge+ %d %d (EG_insertEdgeVerts)!\n",
                npts, btess->tess1d[eIndex-1].npts-1);
       if (etric[0] != NULL) EG_free(etric[0]);
-      EG_free(ts);
-      EG_free(xyzs);
+      EG_freeTess1D(&etess);
       EG_free(vals);
       return EGADS_MALLOC;
     }
@@ -3275,37 +4148,25 @@ EG_insertEdgeVerts(egObject *tess, int eIndex, int vIndex, int npts,
       iface = btess->tess1d[eIndex-1].faces[m].index;
       if (nf > 1) iface = btess->tess1d[eIndex-1].faces[m].faces[nx];
       if (iface == 0) continue;
-      xyz    = (double *) EG_alloc(3*(npts+btess->tess2d[iface-1].npts)*
-                                   sizeof(double));
-      uv     = (double *) EG_alloc(2*(npts+btess->tess2d[iface-1].npts)*
-                                   sizeof(double));
-      ptype  = (int *)    EG_alloc(  (npts+btess->tess2d[iface-1].npts)*
-                                   sizeof(int));
-      pindex = (int *)    EG_alloc(  (npts+btess->tess2d[iface-1].npts)*
-                                   sizeof(int));
-      tris   = (int *)    EG_alloc(3*(npts+btess->tess2d[iface-1].ntris)*
-                                   sizeof(int));
-      tric   = (int *)    EG_alloc(3*(npts+btess->tess2d[iface-1].ntris)*
-                                   sizeof(int));
-      if ((xyz == NULL)    || (uv == NULL)   || (ptype == NULL) ||
-          (pindex == NULL) || (tris == NULL) || (tric == NULL)) {
+      stat = EG_allocTess2D(&ftess, npts+btess->tess2d[iface-1].npts,
+                                    npts+btess->tess2d[iface-1].ntris);
+      if (stat != EGADS_SUCCESS) {
         if (outLevel > 0)
           printf(" EGADS Error: Malloc on Edge %d %d (EG_insertEdgeVerts)!\n",
                  npts, btess->tess1d[eIndex-1].npts);
-        if (tric     != NULL) EG_free(tric);
-        if (tris     != NULL) EG_free(tris);
-        if (pindex   != NULL) EG_free(pindex);
-        if (ptype    != NULL) EG_free(ptype);
-        if (uv       != NULL) EG_free(uv);
-        if (xyz      != NULL) EG_free(xyz);
         if (etric[0] != NULL) EG_free(etric[0]);
         if (etric[1] != NULL) EG_free(etric[1]);
-        EG_free(ts);
-        EG_free(xyzs);
+        EG_freeTess1D(&etess);
         EG_free(vals);
         if (cnt != 0) EG_deleteObject(tess);
         return EGADS_MALLOC;
       }
+      xyz    = ftess.xyz;
+      uv     = ftess.uv;
+      ptype  = ftess.ptype;
+      pindex = ftess.pindex;
+      tris   = ftess.tris;
+      tric   = ftess.tric;
       for (i = 0; i < btess->tess2d[iface-1].npts; i++) {
         xyz[3*i  ] = btess->tess2d[iface-1].xyz[3*i  ];
         xyz[3*i+1] = btess->tess2d[iface-1].xyz[3*i+1];
@@ -3467,18 +4328,7 @@ EG_insertEdgeVerts(egObject *tess, int eIndex, int vIndex, int npts,
       }
 
       /* update the Face pointers */
-      if (btess->tess2d[iface-1].xyz    != NULL) 
-        EG_free(btess->tess2d[iface-1].xyz);
-      if (btess->tess2d[iface-1].uv     != NULL) 
-        EG_free(btess->tess2d[iface-1].uv);
-      if (btess->tess2d[iface-1].ptype  != NULL) 
-        EG_free(btess->tess2d[iface-1].ptype);
-      if (btess->tess2d[iface-1].pindex != NULL) 
-        EG_free(btess->tess2d[iface-1].pindex);
-      if (btess->tess2d[iface-1].tris   != NULL) 
-        EG_free(btess->tess2d[iface-1].tris);
-      if (btess->tess2d[iface-1].tric   != NULL) 
-        EG_free(btess->tess2d[iface-1].tric);
+      EG_freeTess2D(&btess->tess2d[iface-1]);
       btess->tess2d[iface-1].xyz    = xyz;
       btess->tess2d[iface-1].uv     = uv;
       btess->tess2d[iface-1].ptype  = ptype;
@@ -3503,10 +4353,7 @@ EG_insertEdgeVerts(egObject *tess, int eIndex, int vIndex, int npts,
     EG_free(btess->tess1d[eIndex-1].faces[1].tric);
   btess->tess1d[eIndex-1].faces[0].tric = etric[0];
   btess->tess1d[eIndex-1].faces[1].tric = etric[1];
-  if (btess->tess1d[eIndex-1].xyz  != NULL) 
-    EG_free(btess->tess1d[eIndex-1].xyz);
-  if (btess->tess1d[eIndex-1].t    != NULL) 
-    EG_free(btess->tess1d[eIndex-1].t);
+  EG_freeTess1D(&btess->tess1d[eIndex-1]);
   btess->tess1d[eIndex-1].xyz   = xyzs;
   btess->tess1d[eIndex-1].t     = ts;
   btess->tess1d[eIndex-1].npts += npts;
@@ -3515,17 +4362,189 @@ EG_insertEdgeVerts(egObject *tess, int eIndex, int vIndex, int npts,
   EG_checkTriangulation(btess);
 #endif
 
+  EG_statsTess(tess, 0);
   return EGADS_SUCCESS;
 }
 
 
 int
-EG_makeTessBody(egObject *object, double *params, egObject **tess)
+EG_setTessParam(egObject *context, int iparam, double value, double *oldvalue)
 {
-  int       j, stat, outLevel, nface;
+  int     outLevel;
+  egCntxt *cntx;
+
+  if (oldvalue != NULL) *oldvalue = 0.0;
+  if (context == NULL)               return EGADS_NULLOBJ;
+  if (context->magicnumber != MAGIC) return EGADS_NOTOBJ;
+  if (context->oclass != CONTXT)     return EGADS_NOTCNTX;
+  cntx = (egCntxt *) context->blind;
+  if (cntx == NULL)                  return EGADS_NODATA;
+  outLevel = cntx->outLevel;
+
+  if (iparam == 1) {
+    /* number of threads used to tessellate -- 0 is all processors */
+    if ((value < 0.0) || (value > 1024.0)) {
+      if (outLevel > 0)
+        printf(" EGADS Error: nThread = %lf (EG_setTessParam)!\n", value);
+      return EGADS_RANGERR;
+    }
+    if (oldvalue != NULL) *oldvalue = cntx->nThread;
+    cntx->nThread = (int) value;
+  } else if (iparam == 2) {
+    /* maximum number of points on an Edge -- above MAXELEN the Edge
+       point storage grows as needed, 0 restores the default */
+    if (((value != 0.0) && (value < 3.0)) || (value > 1.e7)) {
+      if (outLevel > 0)
+        printf(" EGADS Error: maxEpts = %lf (EG_setTessParam)!\n", value);
+      return EGADS_RANGERR;
+    }
+    if (oldvalue != NULL) *oldvalue = EG_tessMaxPts(context);
+    cntx->maxEpts = (int) value;
+  } else {
+    if (outLevel > 0)
+      printf(" EGADS Error: iparam = %d (EG_setTessParam)!\n", iparam);
+    return EGADS_INDEXERR;
+  }
+
+  return EGADS_SUCCESS;
+}
+
+
+static void
+EG_fillTrisWork(void *arg)
+{
+  int       j, stat;
   double    dist;
+  void      *slock;
   triStruct tst;
   fillArea  fast;
+  faceWork  *fw;
+
+  fw   = (faceWork *) arg;
+  dist = fabs(fw->params[2]);
+  if (dist > 30.0) dist = 30.0;
+  if (dist <  0.5) dist =  0.5;
+  tst.maxlen  = fw->params[0];
+  tst.chord   = fw->params[1];
+  tst.dotnrm  = cos(PI*dist/180.0);
+  tst.mverts  = tst.nverts = 0;
+  tst.verts   = NULL;
+  tst.mtris   = tst.ntris  = 0;
+  tst.tris    = NULL;
+  tst.mids    = NULL;
+  tst.msegs   = tst.nsegs  = 0;
+  tst.segs    = NULL;
+  tst.numElem  = -1;
+  tst.hashSize = 0;
+  tst.stamp    = 0;
+  tst.hashTab  = NULL;
+  tst.numEval   = 0;
+  tst.evalSize  = 0;
+  tst.evalStamp = 0;
+  tst.nEvals    = 0;
+  tst.nHits     = 0;
+  tst.evalTab   = NULL;
+
+  fast.pts    = NULL;
+  fast.segs   = NULL;
+  fast.front  = NULL;
+
+  /* each worker owns its scratch -- a Face only writes its own tess2d slot
+     and its own columns of the Edge tric arrays. Faces on one OCC surface
+     take their group's lock so only one evaluates it at a time */
+  for (;;) {
+    EG_mutexLock(fw->mutex);
+    j = fw->next;
+    if (fw->marker != NULL)
+      while ((j < fw->nface) && (fw->marker[j] == 0)) j++;
+    fw->next = j+1;
+    EG_mutexUnlock(fw->mutex);
+    if (j >= fw->nface) break;
+
+    slock = NULL;
+    if (fw->group != NULL)
+      if (fw->group[j] >= 0) slock = fw->slocks[fw->group[j]%FACELOCKS];
+    EG_mutexLock(slock);
+    stat = EG_fillTris(fw->body, j+1, fw->faces[j], fw->tess, &tst, &fast);
+    EG_mutexUnlock(slock);
+    if (stat != EGADS_SUCCESS)
+      printf(" EGADS Warning: Face %d -> EG_fillTris = %d (EG_makeTessBody)!\n",
+             j+1, stat);
+  }
+
+  if (tst.verts  != NULL) EG_free(tst.verts);
+  if (tst.tris   != NULL) EG_free(tst.tris);
+  if (tst.mids   != NULL) EG_free(tst.mids);
+  if (tst.segs   != NULL) EG_free(tst.segs);
+  if (tst.hashTab != NULL) EG_free(tst.hashTab);
+  if (tst.evalTab != NULL) EG_free(tst.evalTab);
+
+  if (fast.segs  != NULL) EG_free(fast.segs);
+  if (fast.pts   != NULL) EG_free(fast.pts);
+  if (fast.front != NULL) EG_free(fast.front);
+}
+
+
+static void
+EG_fillFaces(egObject *body, egObject *tess, int nface, egObject **faces,
+             /*@null@*/ int *marker, double *params)
+{
+  int      j, n, stat, nthread;
+  faceWork fw;
+
+  for (n = j = 0; j < nface; j++)
+    if (marker != NULL) {
+      if (marker[j] != 0) n++;
+    } else {
+      n++;
+    }
+  if (n == 0) return;
+
+  fw.body      = body;
+  fw.tess      = tess;
+  fw.faces     = faces;
+  fw.nface     = nface;
+  fw.marker    = marker;
+  fw.next      = 0;
+  fw.mutex     = NULL;
+  fw.group     = NULL;
+  fw.params[0] = params[0];
+  fw.params[1] = params[1];
+  fw.params[2] = params[2];
+  for (j = 0; j < FACELOCKS; j++) fw.slocks[j] = NULL;
+
+  nthread = EG_tessThreads(body, n);
+  if (nthread > 1) {
+    fw.group = (int *) EG_alloc(nface*sizeof(int));
+    fw.mutex = EG_mutexCreate();
+    stat     = EGADS_MALLOC;
+    if ((fw.group != NULL) && (fw.mutex != NULL)) {
+      stat = EG_surfaceGroups(nface, faces, marker, fw.group);
+      if (stat == EGADS_SUCCESS) stat = EG_makeSurfLocks(fw.slocks);
+    }
+    if (stat != EGADS_SUCCESS) {
+      if (fw.group != NULL) EG_free(fw.group);
+      if (fw.mutex != NULL) EG_mutexDestroy(fw.mutex);
+      fw.group = NULL;
+      fw.mutex = NULL;
+      nthread  = 1;
+    }
+  }
+  if (nthread == 1) {
+    EG_fillTrisWork(&fw);
+  } else {
+    EG_runThreads(nthread, EG_fillTrisWork, &fw);
+    EG_mutexDestroy(fw.mutex);
+    for (j = 0; j < FACELOCKS; j++) EG_mutexDestroy(fw.slocks[j]);
+    EG_free(fw.group);
+  }
+}
+
+
+int
+EG_makeTessBody(egObject *object, double *params, egObject **tess)
+{
+  int       j, stat, outLevel, nface;
   egTessel  *btess;
   egObject  *ttess, *context, **faces;
 
@@ -3550,6 +4569,11 @@ EG_makeTessBody(egObject *object, double *params, egObject **tess)
   btess->nFace     = 0;
   btess->nu        = 0;
   btess->nv        = 0;
+  btess->nbytes    = 0;
+  btess->global    = NULL;
+  btess->single    = NULL;
+  btess->mapped    = NULL;
+  btess->msize     = 0;
   btess->params[0] = params[0];
   btess->params[1] = params[1];
   btess->params[2] = params[2];
@@ -3575,7 +4599,10 @@ EG_makeTessBody(egObject *object, double *params, egObject **tess)
   *tess = ttess;
   
   /* Wire Body */
-  if (object->mtype == WIREBODY) return EGADS_SUCCESS;
+  if (object->mtype == WIREBODY) {
+    EG_statsTess(ttess, 0);
+    return EGADS_SUCCESS;
+  }
 
   /* not a WireBody */
 
@@ -3608,46 +4635,17 @@ EG_makeTessBody(egObject *object, double *params, egObject **tess)
   }
   btess->nFace = nface;
 
-  dist = fabs(params[2]);
-  if (dist > 30.0) dist = 30.0;
-  if (dist <  0.5) dist =  0.5;
-  tst.maxlen  = params[0];
-  tst.chord   = params[1];
-  tst.dotnrm  = cos(PI*dist/180.0);
-  tst.mverts  = tst.nverts = 0;
-  tst.verts   = NULL;
-  tst.mtris   = tst.ntris  = 0;
-  tst.tris    = NULL;
-  tst.msegs   = tst.nsegs  = 0;
-  tst.segs    = NULL;
-  tst.numElem = -1;
-  tst.hashTab = NULL;
-  
-  fast.pts    = NULL;
-  fast.segs   = NULL;
-  fast.front  = NULL;
-
-  for (j = 0; j < nface; j++) {
-    stat = EG_fillTris(object, j+1, faces[j], ttess, &tst, &fast);
-    if (stat != EGADS_SUCCESS) 
-      printf(" EGADS Warning: Face %d -> EG_fillTris = %d (EG_makeTessBody)!\n",
-             j+1, stat);
-  }
+  /* fill the Faces -- possibly in parallel */
+  EG_fillFaces(object, ttess, nface, faces, NULL, params);
 #ifdef CHECK
   EG_checkTriangulation(btess);
 #endif
     
   /* cleanup */
 
-  if (tst.verts  != NULL) EG_free(tst.verts);
-  if (tst.tris   != NULL) EG_free(tst.tris);
-  if (tst.segs   != NULL) EG_free(tst.segs); 
-   
-  if (fast.segs  != NULL) EG_free(fast.segs);
-  if (fast.pts   != NULL) EG_free(fast.pts);
-  if (fast.front != NULL) EG_free(fast.front);
   EG_free(faces); 
 
+  EG_statsTess(ttess, 0);
   return EGADS_SUCCESS;
 }
 
@@ -3657,9 +4655,7 @@ EG_remakeTess(egObject *tess, int nobj, egObject **objs, double *params)
 {
   int       i, j, mx, stat, outLevel, iface, nface, hit;
   int       *ed, *marker = NULL;
-  double    dist, save[3];
-  triStruct tst;
-  fillArea  fast;
+  double    save[3];
   egObject  *context, *object, **faces;
   egTessel  *btess;
 
@@ -3712,6 +4708,11 @@ EG_remakeTess(egObject *tess, int nobj, egObject **objs, double *params)
     hit++;
   }
   
+  EG_freeTessGlobal(btess);
+  EG_freeTessFloat(btess);
+  stat = EG_ownTess(btess);
+  if (stat != EGADS_SUCCESS) return stat;
+
   /* mark faces */
   
   if (btess->nFace != 0) {
@@ -3753,16 +4754,13 @@ EG_remakeTess(egObject *tess, int nobj, egObject **objs, double *params)
     for (j = 0; j < nobj; j++) {
       if (objs[j]->oclass != EDGE) continue;
       i = EG_indexBodyTopo(object, objs[j]);
-      if (btess->tess1d[i-1].xyz != NULL) EG_free(btess->tess1d[i-1].xyz);
-      if (btess->tess1d[i-1].t   != NULL) EG_free(btess->tess1d[i-1].t);
+      EG_freeTess1D(&btess->tess1d[i-1]);
       if (btess->tess1d[i-1].faces[0].tric  != NULL)
         EG_free(btess->tess1d[i-1].faces[0].tric);
       if (btess->tess1d[i-1].faces[1].tric  != NULL)
         EG_free(btess->tess1d[i-1].faces[1].tric);
       btess->tess1d[i-1].faces[0].tric = NULL;
       btess->tess1d[i-1].faces[1].tric = NULL;
-      btess->tess1d[i-1].xyz           = NULL;
-      btess->tess1d[i-1].t             = NULL;
       btess->tess1d[i-1].npts          = 0;
       ed[i-1] = 1;
     }
@@ -3785,29 +4783,13 @@ EG_remakeTess(egObject *tess, int nobj, egObject **objs, double *params)
       return stat;
     }
   }
-  if (marker == NULL) return EGADS_SUCCESS;
+  if (marker == NULL) {
+    EG_statsTess(tess, 0);
+    return EGADS_SUCCESS;
+  }
  
   /* do faces */
   
-  dist = fabs(params[2]);
-  if (dist > 30.0) dist = 30.0;
-  if (dist <  0.5) dist =  0.5;
-  tst.maxlen  = params[0];
-  tst.chord   = params[1];
-  tst.dotnrm  = cos(PI*dist/180.0);
-  tst.mverts  = tst.nverts = 0;
-  tst.verts   = NULL;
-  tst.mtris   = tst.ntris  = 0;
-  tst.tris    = NULL;
-  tst.msegs   = tst.nsegs  = 0;
-  tst.segs    = NULL;
-  tst.numElem = -1;
-  tst.hashTab = NULL;
-  
-  fast.pts    = NULL;
-  fast.segs   = NULL;
-  fast.front  = NULL;
-  
   stat = EG_getBodyTopos(object, NULL, FACE, &nface, &faces);
   if (stat != EGADS_SUCCESS) {
     printf(" EGADS Error: EG_getBodyTopos = %d (EG_remakeTess)!\n",
@@ -3819,40 +4801,19 @@ EG_remakeTess(egObject *tess, int nobj, egObject **objs, double *params)
   for (j = 0; j < btess->nFace; j++) {
     if (marker[j] == 0) continue;
     
-    if (btess->tess2d[j].xyz    != NULL) EG_free(btess->tess2d[j].xyz);
-    if (btess->tess2d[j].uv     != NULL) EG_free(btess->tess2d[j].uv);
-    if (btess->tess2d[j].ptype  != NULL) EG_free(btess->tess2d[j].ptype);
-    if (btess->tess2d[j].pindex != NULL) EG_free(btess->tess2d[j].pindex);
-    if (btess->tess2d[j].tris   != NULL) EG_free(btess->tess2d[j].tris);
-    if (btess->tess2d[j].tric   != NULL) EG_free(btess->tess2d[j].tric);
-    btess->tess2d[j].xyz    = NULL;
-    btess->tess2d[j].uv     = NULL;
-    btess->tess2d[j].ptype  = NULL;
-    btess->tess2d[j].pindex = NULL;
-    btess->tess2d[j].tris   = NULL;
-    btess->tess2d[j].tric   = NULL;
+    EG_freeTess2D(&btess->tess2d[j]);
     btess->tess2d[j].npts   = 0;
     btess->tess2d[j].ntris  = 0;
-  
-    stat = EG_fillTris(object, j+1, faces[j], tess, &tst, &fast);
-    if (stat != EGADS_SUCCESS) 
-      printf(" EGADS Warning: Face %d -> EG_fillTris = %d (EG_makeTessBody)!\n",
-             j+1, stat);
   }
+  EG_fillFaces(object, tess, btess->nFace, faces, marker, params);
 #ifdef CHECK
   EG_checkTriangulation(btess);
 #endif
 
-  if (tst.verts  != NULL) EG_free(tst.verts);
-  if (tst.tris   != NULL) EG_free(tst.tris);
-  if (tst.segs   != NULL) EG_free(tst.segs); 
-   
-  if (fast.segs  != NULL) EG_free(fast.segs);
-  if (fast.pts   != NULL) EG_free(fast.pts);
-  if (fast.front != NULL) EG_free(fast.front);
   EG_free(faces);
   EG_free(marker);
   
+  EG_statsTess(tess, 0);
   return EGADS_SUCCESS;
 }
 
@@ -3995,86 +4956,39 @@ EG_quadLoop(egTessel *btess, int outLevel, int nedge, int *eindex,
 }
 
 
-int
-EG_makeQuads(egObject *tess, double *parms, int index)
+static int
+EG_quadFace(egTessel *btess, int outLevel, double *parms, int index,
+            egObject **faces)
 {
-  int      i, j, k, l, m, n, outLevel, stat, oclass, mtype, ftype;
-  int      nface, nloop, nedge, sens, npt, nx, *eindex, lim[4];
+  int      i, j, k, l, m, n, stat, oclass, mtype, ftype;
+  int      nloop, nedge, sens, npt, nx, *eindex, lim[4];
   int      npts, npat, save, iv, iv1, nside, pats[34], lens[4];
   int      *ptype, *pindex, *pin, *vpats, *senses, *ntable;
   double   *uvs, *quv, *xyz, *xyzs, limits[4], res[18], area;
   connect  *etable;
-  egTessel *btess;
   egPatch  *patch;
-  egObject *obj, *geom, **faces, **loops, **edges;
+  egTess2D qtess;
+  egObject *geom, **loops, **edges;
 
-  if (tess == NULL)                 return EGADS_NULLOBJ;
-  if (tess->magicnumber != MAGIC)   return EGADS_NOTOBJ;
-  if (tess->oclass != TESSELLATION) return EGADS_NOTTESS;
-  outLevel = EG_outLevel(tess);
-  
-  btess = (egTessel *) tess->blind;
-  if (btess == NULL) {
-    if (outLevel > 0)
-      printf(" EGADS Error: NULL Blind Object (EG_makeQuads)!\n");  
-    return EGADS_NOTFOUND;
-  }
-  obj = btess->src;
-  if (obj == NULL) {
-    if (outLevel > 0)
-      printf(" EGADS Error: NULL Source Object (EG_makeQuads)!\n");
-    return EGADS_NULLOBJ;
-  }
-  if (obj->magicnumber != MAGIC) {
-    if (outLevel > 0)
-      printf(" EGADS Error: Source Not an Object (EG_makeQuads)!\n");
-    return EGADS_NOTOBJ;
-  }
-  if (obj->oclass != BODY) {
-    if (outLevel > 0)
-      printf(" EGADS Error: Source Not Body (EG_makeQuads)!\n");
-    return EGADS_NOTBODY;
-  }
-  if (btess->tess2d == NULL) {
-    if (outLevel > 0)
-      printf(" EGADS Error: No Face Tessellations (EG_makeQuads)!\n");
-    return EGADS_NODATA;  
-  }
-  if ((index < 1) || (index > btess->nFace)) {
-    if (outLevel > 0)
-      printf(" EGADS Error: Index = %d [1-%d] (EG_makeQuads)!\n",
-             index, btess->nFace);
-    return EGADS_INDEXERR;
-  }
+  /* quad patch based on current Edge tessellations -- a Face only touches
+     its own quad slot so this can be run on many Faces at once */
 
-  /* quad patch based on current Edge tessellations */
-  
-  stat = EG_getBodyTopos(obj, NULL, FACE, &nface, &faces);
-  if (stat != EGADS_SUCCESS) return stat;
   stat = EG_getTopology(faces[index-1], &geom, &oclass, &ftype, limits,
                         &nloop, &loops, &senses);
-  if (stat != EGADS_SUCCESS) {
-    EG_free(faces);
-    return stat;
-  }
+  if (stat != EGADS_SUCCESS) return stat;
   if (nloop != 1) {
     if (outLevel > 0)
       printf(" EGADS Error: Face %d has %d loops (EG_makeQuads)!\n",
              index, nloop);
-    EG_free(faces);
     return EGADS_TOPOERR;
   }
   stat = EG_getTopology(loops[0], &geom, &oclass, &mtype, limits,
                         &nedge, &edges, &senses);
-  if (stat != EGADS_SUCCESS) {
-    EG_free(faces);
-    return stat;
-  }
+  if (stat != EGADS_SUCCESS) return stat;
   if (nedge < 4) {
     if (outLevel > 0)
       printf(" EGADS Error: %d Edges in Face %d (EG_makeQuads)!\n", 
              nedge, index);
-    EG_free(faces);
     return EGADS_INDEXERR;
   }
 
@@ -4084,7 +4998,6 @@ EG_makeQuads(egObject *tess, double *parms, int index)
     if (outLevel > 0)
       printf(" EGADS Error: Malloc on %d Edges (EG_makeQuads)!\n",
              nedge);
-    EG_free(faces);
     return EGADS_MALLOC;
   }
   for (i = 0; i < nedge; i++) {
@@ -4093,7 +5006,6 @@ EG_makeQuads(egObject *tess, double *parms, int index)
         printf(" EGADS Error: Edge in Face %d is Degenerate (EG_makeQuads)!\n", 
                index);
       EG_free(eindex);
-      EG_free(faces);
       return EGADS_INDEXERR;
     }
     eindex[i] = 0;
@@ -4106,7 +5018,6 @@ EG_makeQuads(egObject *tess, double *parms, int index)
       if (outLevel > 0)
         printf(" EGADS Error: Edge Not Found in Tess (EG_makeQuads)!\n");
       EG_free(eindex);
-      EG_free(faces);
       return EGADS_NOTFOUND;
     }
   }
@@ -4124,7 +5035,6 @@ EG_makeQuads(egObject *tess, double *parms, int index)
         printf(" EGADS Error: %d Edges in Face %d (EG_makeQuads)!\n", 
                nedge, index);
       EG_free(eindex);
-      EG_free(faces);
       return stat;
     }
   }
@@ -4146,7 +5056,6 @@ EG_makeQuads(egObject *tess, double *parms, int index)
       printf(" EGADS Error: Malloc on %d XYZs (EG_makeQuads)!\n",
              npts);
     EG_free(eindex);
-    EG_free(faces);
     return EGADS_MALLOC;
   }
   uvs = (double *) EG_alloc(2*npts*sizeof(double));
@@ -4156,7 +5065,6 @@ EG_makeQuads(egObject *tess, double *parms, int index)
              npts);
     EG_free(xyzs);
     EG_free(eindex);
-    EG_free(faces);
     return EGADS_MALLOC;
   }
   pin = (int *) EG_alloc(3*npts*sizeof(int));
@@ -4167,7 +5075,6 @@ EG_makeQuads(egObject *tess, double *parms, int index)
     EG_free(uvs);
     EG_free(xyzs);
     EG_free(eindex);
-    EG_free(faces);
     return EGADS_MALLOC;
   }
  
@@ -4192,7 +5099,6 @@ EG_makeQuads(egObject *tess, double *parms, int index)
           EG_free(pin);
           EG_free(xyzs);
           EG_free(eindex);
-          EG_free(faces);
           return stat;        
         }
         xyzs[3*npts  ] = btess->tess1d[j].xyz[3*k  ];
@@ -4215,7 +5121,6 @@ EG_makeQuads(egObject *tess, double *parms, int index)
           EG_free(pin);
           EG_free(xyzs);
           EG_free(eindex);
-          EG_free(faces);
           return stat;        
         }
         xyzs[3*npts  ] = btess->tess1d[j].xyz[3*k  ];
@@ -4250,27 +5155,22 @@ EG_makeQuads(egObject *tess, double *parms, int index)
              stat);
     EG_free(pin);
     EG_free(xyzs);
-    EG_free(faces);
     return EGADS_CONSTERR;
   }
 
-  xyz    = (double *) EG_alloc(3*npt*sizeof(double));
-  ptype  = (int *)    EG_alloc(  npt*sizeof(int));
-  pindex = (int *)    EG_alloc(  npt*sizeof(int));
-  if ((xyz == NULL) || (ptype == NULL) || (pindex == NULL)) {
+  if (EG_allocTess2D(&qtess, npt, 0) != EGADS_SUCCESS) {
     if (outLevel > 0)
       printf(" EGADS Error: Malloc npts = %d (EG_makeQuads)!\n",
              npt);
-    if (pindex != NULL) EG_free(pindex);
-    if (ptype  != NULL) EG_free(ptype);
-    if (xyz    != NULL) EG_free(xyz);
     EG_free(vpats);
     EG_free(quv);
     EG_free(pin);
     EG_free(xyzs);
-    EG_free(faces);
     return EGADS_MALLOC;
   }
+  xyz    = qtess.xyz;
+  ptype  = qtess.ptype;
+  pindex = qtess.pindex;
   for (i = 0; i < npts; i++) {
     pindex[i]  = pin[3*i  ];
     ptype[i]   = pin[3*i+1];
@@ -4286,17 +5186,15 @@ EG_makeQuads(egObject *tess, double *parms, int index)
     xyz[3*i+1] = res[1];
     xyz[3*i+2] = res[2];
   }
-  EG_free(faces);
+  for (i = 0; i < 2*npt; i++) qtess.uv[i] = quv[i];
+  EG_free(quv);
   patch = (egPatch *) EG_alloc(npat*sizeof(egPatch));
   if (patch == NULL) {
     if (outLevel > 0)
       printf(" EGADS Error: Malloc npatchs = %d (EG_makeQuads)!\n",
              npat);
-    EG_free(pindex);
-    EG_free(ptype);
-    EG_free(xyz);
+    EG_freeTess2D(&qtess);
     EG_free(vpats);
-    EG_free(quv);
     EG_free(pin);
     return EGADS_MALLOC;
   }
@@ -4323,11 +5221,8 @@ EG_makeQuads(egObject *tess, double *parms, int index)
     if (outLevel > 0)
       printf(" EGADS Error: Vert Table Malloc (EG_makeQuads)!\n");
     EG_free(patch);
-    EG_free(pindex);
-    EG_free(ptype);
-    EG_free(xyz);
+    EG_freeTess2D(&qtess);
     EG_free(vpats);
-    EG_free(quv);
     EG_free(pin);
     return EGADS_MALLOC;    
   }
@@ -4337,11 +5232,8 @@ EG_makeQuads(egObject *tess, double *parms, int index)
       printf(" EGADS Error: Edge Table Malloc (EG_makeQuads)!\n");
     EG_free(ntable);
     EG_free(patch);
-    EG_free(pindex);
-    EG_free(ptype);
-    EG_free(xyz);
+    EG_freeTess2D(&qtess);
     EG_free(vpats);
-    EG_free(quv);
     EG_free(pin);
     return EGADS_MALLOC;    
   }
@@ -4421,10 +5313,10 @@ EG_makeQuads(egObject *tess, double *parms, int index)
   /* save away the patches */
 
   i = btess->nFace + index - 1;
-  btess->tess2d[i].xyz    = xyz;
-  btess->tess2d[i].uv     = quv;
-  btess->tess2d[i].ptype  = ptype;
-  btess->tess2d[i].pindex = pindex;
+  btess->tess2d[i].xyz    = qtess.xyz;
+  btess->tess2d[i].uv     = qtess.uv;
+  btess->tess2d[i].ptype  = qtess.ptype;
+  btess->tess2d[i].pindex = qtess.pindex;
   btess->tess2d[i].npts   = npt;
   btess->tess2d[i].patch  = patch;
   btess->tess2d[i].npatch = npat;
@@ -4433,6 +5325,242 @@ EG_makeQuads(egObject *tess, double *parms, int index)
 }
 
 
+
+
+int
+EG_makeQuads(egObject *tess, double *parms, int index)
+{
+  int      outLevel, stat, nface;
+  egTessel *btess;
+  egObject *obj, **faces;
+
+  if (tess == NULL)                 return EGADS_NULLOBJ;
+  if (tess->magicnumber != MAGIC)   return EGADS_NOTOBJ;
+  if (tess->oclass != TESSELLATION) return EGADS_NOTTESS;
+  outLevel = EG_outLevel(tess);
+  
+  btess = (egTessel *) tess->blind;
+  if (btess == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: NULL Blind Object (EG_makeQuads)!\n");  
+    return EGADS_NOTFOUND;
+  }
+  obj = btess->src;
+  if (obj == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: NULL Source Object (EG_makeQuads)!\n");
+    return EGADS_NULLOBJ;
+  }
+  if (obj->magicnumber != MAGIC) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Source Not an Object (EG_makeQuads)!\n");
+    return EGADS_NOTOBJ;
+  }
+  if (obj->oclass != BODY) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Source Not Body (EG_makeQuads)!\n");
+    return EGADS_NOTBODY;
+  }
+  if (btess->tess2d == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: No Face Tessellations (EG_makeQuads)!\n");
+    return EGADS_NODATA;  
+  }
+  if ((index < 1) || (index > btess->nFace)) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Index = %d [1-%d] (EG_makeQuads)!\n",
+             index, btess->nFace);
+    return EGADS_INDEXERR;
+  }
+  stat = EG_ownTess(btess);
+  if (stat != EGADS_SUCCESS) return stat;
+
+  stat = EG_getBodyTopos(obj, NULL, FACE, &nface, &faces);
+  if (stat != EGADS_SUCCESS) return stat;
+  stat = EG_quadFace(btess, outLevel, parms, index, faces);
+  EG_free(faces);
+  if (stat != EGADS_SUCCESS) return stat;
+
+  EG_statsTess(tess, 0);
+  return EGADS_SUCCESS;
+}
+
+
+/* can this Face be given quad patches -- one Loop of 4 or more Edges,
+   none of which is degenerate */
+
+static int
+EG_quadEligible(const egObject *face)
+{
+  int      i, stat, oclass, mtype, nloop, nedge, *senses;
+  double   limits[4];
+  egObject *geom, **loops, **edges;
+
+  stat = EG_getTopology(face, &geom, &oclass, &mtype, limits,
+                        &nloop, &loops, &senses);
+  if (stat != EGADS_SUCCESS) return 0;
+  if (nloop != 1)            return 0;
+  stat = EG_getTopology(loops[0], &geom, &oclass, &mtype, limits,
+                        &nedge, &edges, &senses);
+  if (stat != EGADS_SUCCESS) return 0;
+  if (nedge < 4)             return 0;
+  for (i = 0; i < nedge; i++)
+    if (edges[i]->mtype == DEGENERATE) return 0;
+
+  return 1;
+}
+
+
+static void
+EG_quadFaceWork(void *arg)
+{
+  int      j, stat;
+  void     *slock;
+  quadWork *qw;
+
+  qw = (quadWork *) arg;
+
+  /* all per-Face quad state lives on the stack of EG_quadFill -- Faces on
+     one OCC surface take their group's lock (as when filling) */
+  for (;;) {
+    EG_mutexLock(qw->mutex);
+    j = qw->next;
+    while ((j < qw->nface) && (qw->marker[j] == 0)) j++;
+    qw->next = j+1;
+    EG_mutexUnlock(qw->mutex);
+    if (j >= qw->nface) break;
+
+    slock = NULL;
+    if (qw->group != NULL)
+      if (qw->group[j] >= 0) slock = qw->slocks[qw->group[j]%FACELOCKS];
+    EG_mutexLock(slock);
+    stat = EG_quadFace(qw->btess, qw->outLevel, qw->parms, j+1, qw->faces);
+    EG_mutexUnlock(slock);
+    if (stat != EGADS_SUCCESS) {
+      if (qw->outLevel > 0)
+        printf(" EGADS Warning: Face %d -> %d (EG_makeQuadsBody)!\n",
+               j+1, stat);
+      continue;
+    }
+    EG_mutexLock(qw->mutex);
+    qw->nquad++;
+    EG_mutexUnlock(qw->mutex);
+  }
+}
+
+
+int
+EG_makeQuadsBody(egObject *tess, double *parms, int *nquad)
+{
+  int      j, n, outLevel, stat, nface, nthread, *marker;
+  quadWork qw;
+  egTessel *btess;
+  egObject *obj, **faces;
+
+  *nquad = 0;
+  if (tess == NULL)                 return EGADS_NULLOBJ;
+  if (tess->magicnumber != MAGIC)   return EGADS_NOTOBJ;
+  if (tess->oclass != TESSELLATION) return EGADS_NOTTESS;
+  outLevel = EG_outLevel(tess);
+
+  btess = (egTessel *) tess->blind;
+  if (btess == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: NULL Blind Object (EG_makeQuadsBody)!\n");
+    return EGADS_NOTFOUND;
+  }
+  obj = btess->src;
+  if (obj == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: NULL Source Object (EG_makeQuadsBody)!\n");
+    return EGADS_NULLOBJ;
+  }
+  if (obj->magicnumber != MAGIC) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Source Not an Object (EG_makeQuadsBody)!\n");
+    return EGADS_NOTOBJ;
+  }
+  if (obj->oclass != BODY) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Source Not Body (EG_makeQuadsBody)!\n");
+    return EGADS_NOTBODY;
+  }
+  if (btess->tess2d == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: No Face Tessellations (EG_makeQuadsBody)!\n");
+    return EGADS_NODATA;
+  }
+  stat = EG_ownTess(btess);
+  if (stat != EGADS_SUCCESS) return stat;
+
+  stat = EG_getBodyTopos(obj, NULL, FACE, &nface, &faces);
+  if (stat != EGADS_SUCCESS) return stat;
+  marker = (int *) EG_alloc(nface*sizeof(int));
+  if (marker == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Malloc on %d Faces (EG_makeQuadsBody)!\n",
+             nface);
+    EG_free(faces);
+    return EGADS_MALLOC;
+  }
+
+  /* only hand out the Faces that can be blocked into 4 sides */
+  for (n = j = 0; j < nface; j++) {
+    marker[j] = EG_quadEligible(faces[j]);
+    n        += marker[j];
+  }
+  if (n == 0) {
+    EG_free(marker);
+    EG_free(faces);
+    return EGADS_SUCCESS;
+  }
+
+  qw.btess    = btess;
+  qw.faces    = faces;
+  qw.nface    = nface;
+  qw.marker   = marker;
+  qw.next     = 0;
+  qw.nquad    = 0;
+  qw.outLevel = outLevel;
+  qw.mutex    = NULL;
+  qw.group    = NULL;
+  qw.parms    = parms;
+  for (j = 0; j < FACELOCKS; j++) qw.slocks[j] = NULL;
+
+  nthread = EG_tessThreads(obj, n);
+  if (nthread > 1) {
+    qw.group = (int *) EG_alloc(nface*sizeof(int));
+    qw.mutex = EG_mutexCreate();
+    stat     = EGADS_MALLOC;
+    if ((qw.group != NULL) && (qw.mutex != NULL)) {
+      stat = EG_surfaceGroups(nface, faces, marker, qw.group);
+      if (stat == EGADS_SUCCESS) stat = EG_makeSurfLocks(qw.slocks);
+    }
+    if (stat != EGADS_SUCCESS) {
+      if (qw.group != NULL) EG_free(qw.group);
+      if (qw.mutex != NULL) EG_mutexDestroy(qw.mutex);
+      qw.group = NULL;
+      qw.mutex = NULL;
+      nthread  = 1;
+    }
+  }
+  if (nthread == 1) {
+    EG_quadFaceWork(&qw);
+  } else {
+    EG_runThreads(nthread, EG_quadFaceWork, &qw);
+    EG_mutexDestroy(qw.mutex);
+    for (j = 0; j < FACELOCKS; j++) EG_mutexDestroy(qw.slocks[j]);
+    EG_free(qw.group);
+  }
+  EG_free(marker);
+  EG_free(faces);
+
+  *nquad = qw.nquad;
+  EG_statsTess(tess, 0);
+  return EGADS_SUCCESS;
+}
+
+
 int
 EG_getQuads(const egObject *tess, int index, int *len, const double **xyz, 
             const double **uv, const int **ptype, const int **pindex, 
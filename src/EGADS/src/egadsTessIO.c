@@ -0,0 +1,999 @@
+/*
+ *      EGADS: Electronic Geometry Aircraft Design System
+ *
+ *             Tessellation Save & Load Functions
+ *
+ *      Copyright 2011-2012, Massachusetts Institute of Technology
+ *      Licensed under The GNU Lesser General Public License, version 2.1
+ *      See http://www.opensource.org/licenses/lgpl-2.1.php
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+
+#include "egadsTypes.h"
+#include "egadsInternals.h"
+
+
+#define TESSMAGIC       "EGADSTES"
+#define TESSVERSION      1
+#define TESSENDIAN       0x01020304
+#define TESSALIGN        64             /* every record starts on this */
+
+
+/*
+ * The file is a 64 byte header followed by records, each padded out to a
+ * multiple of 64 bytes. All values are little-endian:
+ *
+ *   the Edge table        nEdge egTessEdgeRec
+ *   for each Edge         xyz (3*npts) & t (npts) doubles
+ *                         Face lists (nface > 1) & tric ints
+ *   the Face table        2*nFace egTessFaceRec (triangles, then quads)
+ *   for each slot         xyz, uv doubles then ptype, pindex, tris, tric
+ *                         ints (the layout of EG_allocTess2D)
+ *   for each quad slot    nu & nv for each patch
+ *                         ipts & bounds for each patch
+ *
+ * When loaded the Edge & Face records are the storage -- the Tessellation
+ * keeps the (private) mapping until it is changed (EG_ownTess) or deleted.
+ */
+
+  typedef struct {
+    char               magic[8];        /* TESSMAGIC */
+    int                version;         /* TESSVERSION */
+    int                endian;          /* TESSENDIAN */
+    int                mtype;           /* Body type */
+    int                nNode;           /* number of Nodes in the Body */
+    int                nEdge;           /* number of Edges in the Body */
+    int                nFace;           /* number of Faces in the Body */
+    unsigned long long print;           /* Body fingerprint */
+    double             params[3];       /* tessellation parameters */
+  } egTessHead;
+
+  typedef struct {
+    int nodes[2];                       /* Node indices */
+    int npts;                           /* number of points */
+    int index[2];                       /* minus & plus Face index */
+    int nface[2];                       /* minus & plus number of Faces */
+    int flags;                          /* 1 - has tric-, 2 - has tric+ */
+  } egTessEdgeRec;
+
+  typedef struct {
+    int npts;                           /* number of points */
+    int ntris;                          /* number of triangles */
+    int npatch;                         /* number of quad patches */
+    int pad;
+  } egTessFaceRec;
+
+  typedef struct {
+    const char *base;                   /* the mapped file */
+    size_t     size;                    /* its length */
+    size_t     off;                     /* the next record */
+  } egTessMap;
+
+
+  extern int EG_getBodyTopos( const egObject *body, /*@null@*/ egObject *src,
+                              int oclass, int *ntopo, egObject ***topos );
+  extern int EG_getTopology( const egObject *topo, egObject **geom,
+                             int *oclass, int *mtype,
+                             /*@null@*/ double *limits, int *nChildren,
+                             egObject ***children, int **senses );
+
+
+static int
+EG_littleEndian()
+{
+  int one = 1;
+
+  return *((char *) &one) == 1;
+}
+
+
+/* FNV-1a over the Body's topology counts, Node positions & Edge/Face ranges */
+
+static void
+EG_hashBytes(unsigned long long *hash, const void *data, int nbytes)
+{
+  int                 i;
+  const unsigned char *bytes;
+
+  bytes = (const unsigned char *) data;
+  for (i = 0; i < nbytes; i++) {
+    *hash ^= bytes[i];
+    *hash *= 1099511628211ULL;
+  }
+}
+
+
+static int
+EG_tessPrint(const egObject *body, int *nnode, int *nedge, int *nface,
+             unsigned long long *print)
+{
+  int      i, j, stat, oclass, mtype, nchild, *senses, cnt[4];
+  double   limits[4];
+  egObject *geom, **children, **topos;
+  static int nlimit[3] = {3, 2, 4};     /* Node xyz, Edge t, Face uv */
+
+  *print = 14695981039346656037ULL;
+  cnt[0] = body->mtype;
+  EG_hashBytes(print, &cnt[0], sizeof(int));
+
+  for (j = 0; j < 3; j++) {
+    oclass = NODE;
+    if (j == 1) oclass = EDGE;
+    if (j == 2) oclass = FACE;
+    stat = EG_getBodyTopos(body, NULL, oclass, &cnt[j+1], &topos);
+    if (stat != EGADS_SUCCESS) return stat;
+    EG_hashBytes(print, &cnt[j+1], sizeof(int));
+    for (i = 0; i < cnt[j+1]; i++) {
+      limits[0] = limits[1] = limits[2] = limits[3] = 0.0;
+      stat = EG_getTopology(topos[i], &geom, &oclass, &mtype, limits,
+                            &nchild, &children, &senses);
+      if (stat != EGADS_SUCCESS) {
+        EG_free(topos);
+        return stat;
+      }
+      EG_hashBytes(print, &mtype, sizeof(int));
+      EG_hashBytes(print, limits, nlimit[j]*sizeof(double));
+    }
+    if (topos != NULL) EG_free(topos);
+  }
+  *nnode = cnt[1];
+  *nedge = cnt[2];
+  *nface = cnt[3];
+
+  return EGADS_SUCCESS;
+}
+
+
+/* writes data and counts it (NULL data writes zeros) */
+
+static int
+EG_tessWrite(FILE *fp, /*@null@*/ const void *data, size_t nbytes,
+             size_t *off)
+{
+  char   zero[TESSALIGN];
+  size_t n;
+
+  *off += nbytes;
+  if (data != NULL) {
+    if (nbytes == 0) return EGADS_SUCCESS;
+    if (fwrite(data, 1, nbytes, fp) != nbytes) return EGADS_WRITERR;
+    return EGADS_SUCCESS;
+  }
+  memset(zero, 0, TESSALIGN);
+  while (nbytes != 0) {
+    n = nbytes;
+    if (n > TESSALIGN) n = TESSALIGN;
+    if (fwrite(zero, 1, n, fp) != n) return EGADS_WRITERR;
+    nbytes -= n;
+  }
+  return EGADS_SUCCESS;
+}
+
+
+static int
+EG_tessPad(FILE *fp, size_t *off)
+{
+  size_t n;
+
+  n = *off%TESSALIGN;
+  if (n == 0) return EGADS_SUCCESS;
+  return EG_tessWrite(fp, NULL, TESSALIGN-n, off);
+}
+
+
+/* the next record of nbytes (NULL if the file is short) */
+
+static /*@null@*/ const void *
+EG_tessRecord(egTessMap *map, size_t nbytes)
+{
+  const void *rec;
+
+  if (nbytes > map->size - map->off) return NULL;
+  rec       = map->base + map->off;
+  map->off += nbytes;
+  if (map->off%TESSALIGN != 0) map->off += TESSALIGN - map->off%TESSALIGN;
+  if (map->off > map->size) map->off = map->size;
+  return rec;
+}
+
+
+static int
+EG_tessSaveBody(const egTessel *btess, FILE *fp, size_t *off)
+{
+  int           i, j, k, nf, stat;
+  egTess1D      *tess1d;
+  egTess2D      *tess2d;
+  egTessEdgeRec erec;
+  egTessFaceRec frec;
+
+  /* the Edges */
+  for (i = 0; i < btess->nEdge; i++) {
+    tess1d        = &btess->tess1d[i];
+    erec.nodes[0] = tess1d->nodes[0];
+    erec.nodes[1] = tess1d->nodes[1];
+    erec.npts     = tess1d->npts;
+    erec.flags    = 0;
+    for (k = 0; k < 2; k++) {
+      erec.index[k] = tess1d->faces[k].index;
+      erec.nface[k] = tess1d->faces[k].nface;
+      if (tess1d->faces[k].tric != NULL) erec.flags |= k+1;
+    }
+    stat = EG_tessWrite(fp, &erec, sizeof(egTessEdgeRec), off);
+    if (stat != EGADS_SUCCESS) return stat;
+  }
+  stat = EG_tessPad(fp, off);
+  if (stat != EGADS_SUCCESS) return stat;
+
+  for (i = 0; i < btess->nEdge; i++) {
+    tess1d = &btess->tess1d[i];
+    stat   = EG_tessWrite(fp, tess1d->xyz, 3*tess1d->npts*sizeof(double), off);
+    if (stat != EGADS_SUCCESS) return stat;
+    stat   = EG_tessWrite(fp, tess1d->t,     tess1d->npts*sizeof(double), off);
+    if (stat != EGADS_SUCCESS) return stat;
+    stat   = EG_tessPad(fp, off);
+    if (stat != EGADS_SUCCESS) return stat;
+    for (k = 0; k < 2; k++) {
+      if (tess1d->faces[k].nface <= 1) continue;
+      stat = EG_tessWrite(fp, tess1d->faces[k].faces,
+                          tess1d->faces[k].nface*sizeof(int), off);
+      if (stat != EGADS_SUCCESS) return stat;
+    }
+    for (k = 0; k < 2; k++) {
+      if (tess1d->faces[k].tric == NULL) continue;
+      nf = tess1d->faces[k].nface;
+      if (nf < 1) nf = 1;
+      stat = EG_tessWrite(fp, tess1d->faces[k].tric,
+                          nf*(tess1d->npts-1)*sizeof(int), off);
+      if (stat != EGADS_SUCCESS) return stat;
+    }
+    stat = EG_tessPad(fp, off);
+    if (stat != EGADS_SUCCESS) return stat;
+  }
+
+  /* the Faces -- triangles then quads */
+  for (i = 0; i < 2*btess->nFace; i++) {
+    frec.npts   = btess->tess2d[i].npts;
+    frec.ntris  = btess->tess2d[i].ntris;
+    frec.npatch = btess->tess2d[i].npatch;
+    frec.pad    = 0;
+    if (btess->tess2d[i].patch == NULL) frec.npatch = 0;
+    stat = EG_tessWrite(fp, &frec, sizeof(egTessFaceRec), off);
+    if (stat != EGADS_SUCCESS) return stat;
+  }
+  stat = EG_tessPad(fp, off);
+  if (stat != EGADS_SUCCESS) return stat;
+
+  for (i = 0; i < 2*btess->nFace; i++) {
+    tess2d = &btess->tess2d[i];
+    if (tess2d->npts <= 0) continue;
+    stat = EG_tessWrite(fp, tess2d->xyz,    3*tess2d->npts*sizeof(double), off);
+    if (stat != EGADS_SUCCESS) return stat;
+    stat = EG_tessWrite(fp, tess2d->uv,     2*tess2d->npts*sizeof(double), off);
+    if (stat != EGADS_SUCCESS) return stat;
+    stat = EG_tessWrite(fp, tess2d->ptype,    tess2d->npts*sizeof(int),    off);
+    if (stat != EGADS_SUCCESS) return stat;
+    stat = EG_tessWrite(fp, tess2d->pindex,   tess2d->npts*sizeof(int),    off);
+    if (stat != EGADS_SUCCESS) return stat;
+    if (tess2d->ntris > 0) {
+      stat = EG_tessWrite(fp, tess2d->tris, 3*tess2d->ntris*sizeof(int),   off);
+      if (stat != EGADS_SUCCESS) return stat;
+      stat = EG_tessWrite(fp, tess2d->tric, 3*tess2d->ntris*sizeof(int),   off);
+      if (stat != EGADS_SUCCESS) return stat;
+    }
+    stat = EG_tessPad(fp, off);
+    if (stat != EGADS_SUCCESS) return stat;
+    if (tess2d->patch == NULL) continue;
+
+    for (j = 0; j < tess2d->npatch; j++) {
+      stat = EG_tessWrite(fp, &tess2d->patch[j].nu, sizeof(int), off);
+      if (stat != EGADS_SUCCESS) return stat;
+      stat = EG_tessWrite(fp, &tess2d->patch[j].nv, sizeof(int), off);
+      if (stat != EGADS_SUCCESS) return stat;
+    }
+    stat = EG_tessPad(fp, off);
+    if (stat != EGADS_SUCCESS) return stat;
+    for (j = 0; j < tess2d->npatch; j++) {
+      stat = EG_tessWrite(fp, tess2d->patch[j].ipts, tess2d->patch[j].nu*
+                          tess2d->patch[j].nv*sizeof(int), off);
+      if (stat != EGADS_SUCCESS) return stat;
+      stat = EG_tessWrite(fp, tess2d->patch[j].bounds,
+                          (2*(tess2d->patch[j].nu-1)+
+                           2*(tess2d->patch[j].nv-1))*sizeof(int), off);
+      if (stat != EGADS_SUCCESS) return stat;
+    }
+    stat = EG_tessPad(fp, off);
+    if (stat != EGADS_SUCCESS) return stat;
+  }
+
+  return EGADS_SUCCESS;
+}
+
+
+int
+EG_saveTess(const egObject *tess, const char *name)
+{
+  int        stat, outLevel;
+  size_t     off;
+  egTessel   *btess;
+  egTessHead head;
+  egObject   *body;
+  FILE       *fp;
+
+  if (tess == NULL)                 return EGADS_NULLOBJ;
+  if (tess->magicnumber != MAGIC)   return EGADS_NOTOBJ;
+  if (tess->oclass != TESSELLATION) return EGADS_NOTTESS;
+  outLevel = EG_outLevel(tess);
+
+  btess = (egTessel *) tess->blind;
+  if (btess == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: NULL Blind Object (EG_saveTess)!\n");
+    return EGADS_NOTFOUND;
+  }
+  body = btess->src;
+  if (body == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: NULL Source Object (EG_saveTess)!\n");
+    return EGADS_NULLOBJ;
+  }
+  if (body->magicnumber != MAGIC) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Source Not an Object (EG_saveTess)!\n");
+    return EGADS_NOTOBJ;
+  }
+  if (body->oclass != BODY) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Source Not Body (EG_saveTess)!\n");
+    return EGADS_NOTBODY;
+  }
+  if (btess->tess1d == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: No Edge Tessellations (EG_saveTess)!\n");
+    return EGADS_NODATA;
+  }
+  if (name == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Warning: NULL Filename (EG_saveTess)!\n");
+    return EGADS_NONAME;
+  }
+  if (EG_littleEndian() == 0) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Host is not Little-Endian (EG_saveTess)!\n");
+    return EGADS_WRITERR;
+  }
+
+  memset(&head, 0, sizeof(egTessHead));
+  memcpy(head.magic, TESSMAGIC, 8);
+  head.version   = TESSVERSION;
+  head.endian    = TESSENDIAN;
+  head.mtype     = body->mtype;
+  head.params[0] = btess->params[0];
+  head.params[1] = btess->params[1];
+  head.params[2] = btess->params[2];
+  stat = EG_tessPrint(body, &head.nNode, &head.nEdge, &head.nFace,
+                      &head.print);
+  if (stat != EGADS_SUCCESS) return stat;
+  if ((head.nEdge != btess->nEdge) || (head.nFace != btess->nFace)) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Tessellation out of date (EG_saveTess)!\n");
+    return EGADS_TOPOERR;
+  }
+
+  /* does file exist? */
+
+  fp = fopen(name, "rb");
+  if (fp != NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Warning: File %s Exists (EG_saveTess)!\n", name);
+    fclose(fp);
+    return EGADS_NOTFOUND;
+  }
+  fp = fopen(name, "wb");
+  if (fp == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Warning: File %s Cannot be Opened (EG_saveTess)!\n",
+             name);
+    return EGADS_WRITERR;
+  }
+
+  off  = 0;
+  stat = EG_tessWrite(fp, &head, sizeof(egTessHead), &off);
+  if (stat == EGADS_SUCCESS) stat = EG_tessPad(fp, &off);
+  if (stat == EGADS_SUCCESS) stat = EG_tessSaveBody(btess, fp, &off);
+  if (fclose(fp) != 0) stat = EGADS_WRITERR;
+  if (stat != EGADS_SUCCESS) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Writing %s (EG_saveTess)!\n", name);
+    remove(name);
+  }
+
+  return stat;
+}
+
+
+/* points a Face slot into its record (the carving of EG_allocTess2D) */
+
+static void
+EG_tessView2D(egTess2D *tess2d, double *block, int npts, int ntris)
+{
+  tess2d->xyz    = block;
+  tess2d->uv     = &block[3*npts];
+  tess2d->ptype  = (int *) &block[5*npts];
+  tess2d->pindex = &tess2d->ptype[npts];
+  if (ntris <= 0) return;
+  tess2d->tris   = &tess2d->ptype[2*npts];
+  tess2d->tric   = &tess2d->tris[3*ntris];
+}
+
+
+/* is this block a view into the loaded file? */
+
+static int
+EG_tessInMap(const egTessel *btess, const void *ptr)
+{
+  const char *base = (const char *) btess->mapped;
+
+  if ((base == NULL) || (ptr == NULL)) return 0;
+  return ((const char *) ptr >= base) &&
+         ((const char *) ptr <  base + btess->msize);
+}
+
+
+/* can n items of size still fit in the file? (keeps size_t math in range) */
+
+static int
+EG_tessFits(const egTessMap *map, size_t n, size_t size)
+{
+  return n <= (map->size - map->off)/size;
+}
+
+
+/* checks the point types & indices, triangles and neighbors of a Face slot */
+
+static int
+EG_tessCheckFace(const egTessel *btess, int nnode, const egTess2D *tess2d)
+{
+  int i, j, n;
+
+  for (i = 0; i < tess2d->npts; i++) {
+    n = tess2d->pindex[i];
+    if (tess2d->ptype[i] == -1) {
+      if (n != -1) return EGADS_NOLOAD;
+    } else if (tess2d->ptype[i] == 0) {
+      if ((n < 1) || (n > nnode)) return EGADS_NOLOAD;
+    } else {
+      if ((n < 1) || (n > btess->nEdge)) return EGADS_NOLOAD;
+      if (tess2d->ptype[i] > btess->tess1d[n-1].npts) return EGADS_NOLOAD;
+    }
+  }
+  for (i = 0; i < 3*tess2d->ntris; i++) {
+    n = tess2d->tris[i];
+    if ((n < 1) || (n > tess2d->npts)) return EGADS_NOLOAD;
+    n = tess2d->tric[i];
+    if ((n < -btess->nEdge) || (n > tess2d->ntris)) return EGADS_NOLOAD;
+  }
+  for (n = j = 0; j < tess2d->npatch; j++)
+    n += (tess2d->patch[j].nu-1)*(tess2d->patch[j].nv-1);
+  for (j = 0; j < tess2d->npatch; j++) {
+    for (i = 0; i < tess2d->patch[j].nu*tess2d->patch[j].nv; i++)
+      if ((tess2d->patch[j].ipts[i] < 1) ||
+          (tess2d->patch[j].ipts[i] > tess2d->npts)) return EGADS_NOLOAD;
+    for (i = 0; i < 2*(tess2d->patch[j].nu-1)+2*(tess2d->patch[j].nv-1); i++)
+      if ((tess2d->patch[j].bounds[i] < -btess->nEdge) ||
+          (tess2d->patch[j].bounds[i] > n)) return EGADS_NOLOAD;
+  }
+
+  return EGADS_SUCCESS;
+}
+
+
+/* checks the Faces & triangles that an Edge refers to */
+
+static int
+EG_tessCheckEdge(const egTessel *btess, const egTess1D *tess1d)
+{
+  int i, k, m, nf, face;
+
+  for (k = 0; k < 2; k++) {
+    nf = tess1d->faces[k].nface;
+    if ((tess1d->faces[k].index < 0) ||
+        (tess1d->faces[k].index > btess->nFace)) return EGADS_NOLOAD;
+    if (nf > 1)
+      for (m = 0; m < nf; m++)
+        if ((tess1d->faces[k].faces[m] < 1) ||
+            (tess1d->faces[k].faces[m] > btess->nFace)) return EGADS_NOLOAD;
+    if (tess1d->faces[k].tric == NULL) continue;
+    for (m = 0; m < nf; m++) {
+      face = tess1d->faces[k].index;
+      if (nf > 1) face = tess1d->faces[k].faces[m];
+      if (face < 1) return EGADS_NOLOAD;
+      for (i = 0; i < tess1d->npts-1; i++)
+        if ((tess1d->faces[k].tric[i*nf+m] < 0) ||
+            (tess1d->faces[k].tric[i*nf+m] > btess->tess2d[face-1].ntris))
+          return EGADS_NOLOAD;
+    }
+  }
+
+  return EGADS_SUCCESS;
+}
+
+
+/* rebuilds the Edge & Face discretizations from the mapped records --
+ * every count & index is checked before it is used */
+
+static int
+EG_tessLoadBody(egTessel *btess, int nnode, egTessMap *map, egObject **edges)
+{
+  int                 i, j, k, n, nf, npts, ntris, stat, *ints;
+  size_t              nbytes, nipts, nquad;
+  const int           *irec;
+  const double        *drec;
+  const egTessEdgeRec *erec;
+  const egTessFaceRec *frec = NULL;
+  egTess1D            *tess1d;
+  egTess2D            *tess2d;
+  egPatch             *patch;
+
+  /* the Edges */
+  if (!EG_tessFits(map, btess->nEdge, sizeof(egTessEdgeRec)))
+    return EGADS_NOLOAD;
+  erec = (const egTessEdgeRec *)
+         EG_tessRecord(map, btess->nEdge*sizeof(egTessEdgeRec));
+  if (erec == NULL) return EGADS_NOLOAD;
+  for (i = 0; i < btess->nEdge; i++) {
+    tess1d           = &btess->tess1d[i];
+    tess1d->obj      = edges[i];
+    if ((erec[i].nodes[0] < 1) || (erec[i].nodes[0] > nnode) ||
+        (erec[i].nodes[1] < 1) || (erec[i].nodes[1] > nnode))
+      return EGADS_NOLOAD;
+    tess1d->nodes[0] = erec[i].nodes[0];
+    tess1d->nodes[1] = erec[i].nodes[1];
+    if ((erec[i].flags & ~3) != 0) return EGADS_NOLOAD;
+    for (k = 0; k < 2; k++) {
+      if ((erec[i].nface[k] < 0) || (erec[i].nface[k] > btess->nFace))
+        return EGADS_NOLOAD;
+      if (((erec[i].flags & (k+1)) != 0) && (erec[i].nface[k] < 1))
+        return EGADS_NOLOAD;
+    }
+    npts = erec[i].npts;
+    if ((npts < 0) || ((npts < 2) && (erec[i].flags != 0)))
+      return EGADS_NOLOAD;
+    if (!EG_tessFits(map, npts, 4*sizeof(double))) return EGADS_NOLOAD;
+
+    drec = (const double *) EG_tessRecord(map, 4*(size_t) npts*sizeof(double));
+    if (drec == NULL) return EGADS_NOLOAD;
+    if (npts > 0) {
+      tess1d->xyz = (double *) drec;
+      tess1d->t   = &tess1d->xyz[3*npts];
+    }
+    tess1d->npts = npts;
+
+    for (nbytes = k = 0; k < 2; k++) {
+      nf = erec[i].nface[k];
+      if (nf > 1) nbytes += (size_t) nf*sizeof(int);
+      if ((erec[i].flags & (k+1)) == 0) continue;
+      if (!EG_tessFits(map, (size_t) nf*(npts-1), sizeof(int)))
+        return EGADS_NOLOAD;
+      nbytes += (size_t) nf*(npts-1)*sizeof(int);
+    }
+    irec = (const int *) EG_tessRecord(map, nbytes);
+    if (irec == NULL) return EGADS_NOLOAD;
+    for (k = 0; k < 2; k++) {
+      nf = erec[i].nface[k];
+      if (nf <= 1) continue;
+      ints = (int *) EG_alloc(nf*sizeof(int));
+      if (ints == NULL) return EGADS_MALLOC;
+      memcpy(ints, irec, nf*sizeof(int));
+      tess1d->faces[k].faces = ints;
+      irec += nf;
+    }
+    for (k = 0; k < 2; k++) {
+      tess1d->faces[k].index = erec[i].index[k];
+      tess1d->faces[k].nface = erec[i].nface[k];
+      if ((erec[i].flags & (k+1)) == 0) continue;
+      nf    = erec[i].nface[k];
+      ints  = (int *) EG_alloc((size_t) nf*(npts-1)*sizeof(int));
+      if (ints == NULL) return EGADS_MALLOC;
+      memcpy(ints, irec, (size_t) nf*(npts-1)*sizeof(int));
+      tess1d->faces[k].tric = ints;
+      irec += (size_t) nf*(npts-1);
+    }
+  }
+
+  /* the Faces */
+  if (btess->tess2d != NULL) {
+    if (!EG_tessFits(map, 2*(size_t) btess->nFace, sizeof(egTessFaceRec)))
+      return EGADS_NOLOAD;
+    frec = (const egTessFaceRec *)
+           EG_tessRecord(map, 2*(size_t) btess->nFace*sizeof(egTessFaceRec));
+    if (frec == NULL) return EGADS_NOLOAD;
+  }
+  for (i = 0; i < 2*btess->nFace; i++) {
+    tess2d = &btess->tess2d[i];
+    npts   = frec[i].npts;
+    ntris  = frec[i].ntris;
+    if ((npts < 0) || (ntris < 0) || (frec[i].npatch < 0))
+      return EGADS_NOLOAD;
+    if ((i < btess->nFace) && (frec[i].npatch != 0)) return EGADS_NOLOAD;
+    if ((i >= btess->nFace) && (ntris != 0))         return EGADS_NOLOAD;
+    if ((npts == 0) && ((ntris != 0) || (frec[i].npatch != 0)))
+      return EGADS_NOLOAD;
+    if (npts == 0) continue;
+
+    /* no copy -- the record has the layout of the Face storage */
+    if (!EG_tessFits(map, npts,  5*sizeof(double)+2*sizeof(int)) ||
+        !EG_tessFits(map, ntris, 6*sizeof(int))) return EGADS_NOLOAD;
+    nbytes = 5*(size_t) npts*sizeof(double) +
+             (2*(size_t) npts + 6*(size_t) ntris)*sizeof(int);
+    drec   = (const double *) EG_tessRecord(map, nbytes);
+    if (drec == NULL) return EGADS_NOLOAD;
+    EG_tessView2D(tess2d, (double *) drec, npts, ntris);
+    tess2d->npts  = npts;
+    tess2d->ntris = ntris;
+
+    n = frec[i].npatch;
+    if (n != 0) {
+      if (!EG_tessFits(map, n, 2*sizeof(int))) return EGADS_NOLOAD;
+      irec = (const int *) EG_tessRecord(map, 2*(size_t) n*sizeof(int));
+      if (irec == NULL) return EGADS_NOLOAD;
+      patch = (egPatch *) EG_alloc(n*sizeof(egPatch));
+      if (patch == NULL) return EGADS_MALLOC;
+      for (nbytes = nquad = j = 0; j < n; j++) {
+        patch[j].nu     = irec[2*j  ];
+        patch[j].nv     = irec[2*j+1];
+        patch[j].ipts   = NULL;
+        patch[j].bounds = NULL;
+        if ((patch[j].nu < 2) || (patch[j].nv < 2) ||
+            ((size_t) patch[j].nu*patch[j].nv > (size_t) npts)) {
+          EG_free(patch);
+          return EGADS_NOLOAD;
+        }
+        nquad  += (size_t) (patch[j].nu-1)*(patch[j].nv-1);
+        nbytes += ((size_t) patch[j].nu*patch[j].nv +
+                   2*(size_t) (patch[j].nu-1) +
+                   2*(size_t) (patch[j].nv-1))*sizeof(int);
+        if (!EG_tessFits(map, nbytes, 1) || (nquad > INT_MAX)) {
+          EG_free(patch);
+          return EGADS_NOLOAD;
+        }
+      }
+      tess2d->patch  = patch;
+      tess2d->npatch = n;
+      irec = (const int *) EG_tessRecord(map, nbytes);
+      if (irec == NULL) return EGADS_NOLOAD;
+      for (j = 0; j < n; j++) {
+        nipts = (size_t) patch[j].nu*patch[j].nv;
+        patch[j].ipts = (int *) EG_alloc(nipts*sizeof(int));
+        if (patch[j].ipts == NULL) return EGADS_MALLOC;
+        memcpy(patch[j].ipts, irec, nipts*sizeof(int));
+        irec += nipts;
+        k = 2*(patch[j].nu-1) + 2*(patch[j].nv-1);
+        patch[j].bounds = (int *) EG_alloc(k*sizeof(int));
+        if (patch[j].bounds == NULL) return EGADS_MALLOC;
+        memcpy(patch[j].bounds, irec, k*sizeof(int));
+        irec += k;
+      }
+    }
+
+    stat = EG_tessCheckFace(btess, nnode, tess2d);
+    if (stat != EGADS_SUCCESS) return stat;
+  }
+
+  /* the Edge triangle references need the Face triangle counts */
+  for (i = 0; i < btess->nEdge; i++) {
+    if ((btess->tess2d == NULL) && ((btess->tess1d[i].faces[0].nface != 0) ||
+                                    (btess->tess1d[i].faces[1].nface != 0)))
+      return EGADS_NOLOAD;
+    if (btess->tess2d == NULL) continue;
+    stat = EG_tessCheckEdge(btess, &btess->tess1d[i]);
+    if (stat != EGADS_SUCCESS) return stat;
+  }
+
+  return EGADS_SUCCESS;
+}
+
+
+int
+EG_loadTess(egObject *body, const char *name, egObject **tess)
+{
+  int                i, nnode, nedge, nface, stat, outLevel;
+  unsigned long long print;
+  egTessMap          map;
+  const egTessHead   *head;
+  egTessel           *btess;
+  egObject           *context, *ttess, **edges;
+#ifdef WIN32
+  char               *buffer;
+  FILE               *fp;
+#else
+  int                fd;
+  void               *addr;
+  struct stat        sbuf;
+#endif
+
+  *tess = NULL;
+  if (body == NULL)               return EGADS_NULLOBJ;
+  if (body->magicnumber != MAGIC) return EGADS_NOTOBJ;
+  if (body->oclass != BODY)       return EGADS_NOTBODY;
+  outLevel = EG_outLevel(body);
+  context  = EG_context(body);
+
+  if (name == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Warning: NULL Filename (EG_loadTess)!\n");
+    return EGADS_NONAME;
+  }
+  stat = EG_tessPrint(body, &nnode, &nedge, &nface, &print);
+  if (stat != EGADS_SUCCESS) return stat;
+
+  /* map the file */
+
+#ifdef WIN32
+  fp = fopen(name, "rb");
+  if (fp == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Warning: File %s Not Found (EG_loadTess)!\n", name);
+    return EGADS_NOTFOUND;
+  }
+  fseek(fp, 0, SEEK_END);
+  map.size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  buffer = (char *) EG_alloc(map.size+1);
+  if (buffer == NULL) {
+    fclose(fp);
+    return EGADS_MALLOC;
+  }
+  if (fread(buffer, 1, map.size, fp) != map.size) {
+    EG_free(buffer);
+    fclose(fp);
+    return EGADS_NOLOAD;
+  }
+  fclose(fp);
+  map.base = buffer;
+#else
+  fd = open(name, O_RDONLY);
+  if (fd < 0) {
+    if (outLevel > 0)
+      printf(" EGADS Warning: File %s Not Found (EG_loadTess)!\n", name);
+    return EGADS_NOTFOUND;
+  }
+  if ((fstat(fd, &sbuf) != 0) || (sbuf.st_size < (off_t) sizeof(egTessHead))) {
+    close(fd);
+    if (outLevel > 0)
+      printf(" EGADS Error: File %s is too short (EG_loadTess)!\n", name);
+    return EGADS_NOLOAD;
+  }
+  map.size = sbuf.st_size;
+  /* private -- the views are never written back to the file */
+  addr     = mmap(NULL, map.size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Cannot map %s (EG_loadTess)!\n", name);
+    return EGADS_NOLOAD;
+  }
+  map.base = (const char *) addr;
+#endif
+  map.off = 0;
+
+  /* check the header against the Body */
+
+  stat = EGADS_SUCCESS;
+  head = (const egTessHead *) EG_tessRecord(&map, sizeof(egTessHead));
+  if ((head == NULL) || (memcmp(head->magic, TESSMAGIC, 8) != 0) ||
+      (head->endian != TESSENDIAN)) {
+    if (outLevel > 0)
+      printf(" EGADS Error: %s is not a Tessellation file (EG_loadTess)!\n",
+             name);
+    stat = EGADS_NOLOAD;
+  } else if (head->version != TESSVERSION) {
+    if (outLevel > 0)
+      printf(" EGADS Error: %s is version %d not %d (EG_loadTess)!\n",
+             name, head->version, TESSVERSION);
+    stat = EGADS_NOLOAD;
+  } else if ((head->mtype != body->mtype) || (head->nNode != nnode) ||
+             (head->nEdge != nedge)       || (head->nFace != nface) ||
+             (head->print != print)) {
+    if (outLevel > 0)
+      printf(" EGADS Error: %s is for a different Body (EG_loadTess)!\n",
+             name);
+    stat = EGADS_TOPOERR;
+  }
+  btess = NULL;
+  if (stat == EGADS_SUCCESS) {
+    btess = (egTessel *) EG_alloc(sizeof(egTessel));
+    if (btess == NULL) stat = EGADS_MALLOC;
+  }
+  if (stat != EGADS_SUCCESS) goto done;
+  btess->src       = body;
+  btess->xyzs      = NULL;
+  btess->tess1d    = NULL;
+  btess->tess2d    = NULL;
+  btess->nEdge     = 0;
+  btess->nFace     = 0;
+  btess->nu        = 0;
+  btess->nv        = 0;
+  btess->nbytes    = 0;
+  btess->global    = NULL;
+  btess->single    = NULL;
+  btess->mapped    = NULL;
+  btess->msize     = 0;
+  btess->params[0] = head->params[0];
+  btess->params[1] = head->params[1];
+  btess->params[2] = head->params[2];
+
+  /* make the (empty) Tessellation Object so it can be cleaned up */
+
+  stat = EG_makeObject(context, &ttess);
+  if (stat != EGADS_SUCCESS) {
+    EG_free(btess);
+    goto done;
+  }
+  ttess->oclass = TESSELLATION;
+  ttess->blind  = btess;
+  EG_referenceObject(ttess, context);
+  EG_referenceTopObj(body,  ttess);
+
+  /* the Tessellation now holds the file -- its blocks are views into it */
+#ifdef WIN32
+  btess->mapped = buffer;
+  buffer        = NULL;
+#else
+  btess->mapped = addr;
+  addr          = NULL;
+#endif
+  btess->msize  = map.size;
+
+  stat = EG_getBodyTopos(body, NULL, EDGE, &nedge, &edges);
+  if (stat != EGADS_SUCCESS) {
+    EG_deleteObject(ttess);
+    goto done;
+  }
+  btess->tess1d = (egTess1D *) EG_alloc(nedge*sizeof(egTess1D));
+  if ((nface != 0) && (btess->tess1d != NULL)) {
+    btess->tess2d = (egTess2D *) EG_alloc(2*nface*sizeof(egTess2D));
+    if (btess->tess2d == NULL) {
+      EG_free(btess->tess1d);
+      btess->tess1d = NULL;
+    }
+  }
+  if (btess->tess1d == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Alloc %d Edges %d Faces (EG_loadTess)!\n",
+             nedge, nface);
+    EG_free(edges);
+    EG_deleteObject(ttess);
+    stat = EGADS_MALLOC;
+    goto done;
+  }
+  for (i = 0; i < nedge; i++) {
+    btess->tess1d[i].obj            = edges[i];
+    btess->tess1d[i].faces[0].faces = NULL;
+    btess->tess1d[i].faces[0].tric  = NULL;
+    btess->tess1d[i].faces[1].faces = NULL;
+    btess->tess1d[i].faces[1].tric  = NULL;
+    btess->tess1d[i].faces[0].nface = 0;
+    btess->tess1d[i].faces[1].nface = 0;
+    btess->tess1d[i].xyz            = NULL;
+    btess->tess1d[i].t              = NULL;
+    btess->tess1d[i].npts           = 0;
+  }
+  btess->nEdge = nedge;
+  for (i = 0; i < 2*nface; i++) {
+    btess->tess2d[i].xyz    = NULL;
+    btess->tess2d[i].uv     = NULL;
+    btess->tess2d[i].ptype  = NULL;
+    btess->tess2d[i].pindex = NULL;
+    btess->tess2d[i].tris   = NULL;
+    btess->tess2d[i].tric   = NULL;
+    btess->tess2d[i].patch  = NULL;
+    btess->tess2d[i].npts   = 0;
+    btess->tess2d[i].ntris  = 0;
+    btess->tess2d[i].npatch = 0;
+  }
+  btess->nFace = nface;
+
+  stat = EG_tessLoadBody(btess, nnode, &map, edges);
+  EG_free(edges);
+  if (stat != EGADS_SUCCESS) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Reading %s = %d (EG_loadTess)!\n", name, stat);
+    EG_deleteObject(ttess);
+    goto done;
+  }
+  EG_statsTess(ttess, 0);
+  *tess = ttess;
+
+done:
+#ifdef WIN32
+  if (buffer != NULL) EG_free(buffer);
+#else
+  if (addr   != NULL) munmap(addr, map.size);
+#endif
+  return stat;
+}
+
+
+/* drops the views into the loaded file & releases it */
+
+void
+EG_unmapTess(egTessel *btess)
+{
+  int i;
+
+  if (btess->mapped == NULL) return;
+  if (btess->tess1d != NULL)
+    for (i = 0; i < btess->nEdge; i++)
+      if (EG_tessInMap(btess, btess->tess1d[i].xyz))
+        btess->tess1d[i].xyz = btess->tess1d[i].t = NULL;
+  if (btess->tess2d != NULL)
+    for (i = 0; i < 2*btess->nFace; i++)
+      if (EG_tessInMap(btess, btess->tess2d[i].xyz)) {
+        btess->tess2d[i].xyz   = btess->tess2d[i].uv     = NULL;
+        btess->tess2d[i].ptype = btess->tess2d[i].pindex = NULL;
+        btess->tess2d[i].tris  = btess->tess2d[i].tric   = NULL;
+      }
+
+#ifdef WIN32
+  EG_free(btess->mapped);
+#else
+  munmap(btess->mapped, btess->msize);
+#endif
+  btess->mapped = NULL;
+  btess->msize  = 0;
+}
+
+
+/* copies the views into owned storage -- needed before the Tessellation
+ * is changed (the blocks get freed & replaced) */
+
+int
+EG_ownTess(egTessel *btess)
+{
+  int      i, npts, ntris;
+  egTess1D etess;
+  egTess2D ftess;
+
+  if (btess->mapped == NULL) return EGADS_SUCCESS;
+  if (btess->tess1d != NULL)
+    for (i = 0; i < btess->nEdge; i++) {
+      if (!EG_tessInMap(btess, btess->tess1d[i].xyz)) continue;
+      npts = btess->tess1d[i].npts;
+      if (EG_allocTess1D(&etess, npts) != EGADS_SUCCESS) return EGADS_MALLOC;
+      memcpy(etess.xyz, btess->tess1d[i].xyz, 4*(size_t) npts*sizeof(double));
+      btess->tess1d[i].xyz = etess.xyz;
+      btess->tess1d[i].t   = etess.t;
+    }
+  if (btess->tess2d != NULL)
+    for (i = 0; i < 2*btess->nFace; i++) {
+      if (!EG_tessInMap(btess, btess->tess2d[i].xyz)) continue;
+      npts  = btess->tess2d[i].npts;
+      ntris = btess->tess2d[i].ntris;
+      if (EG_allocTess2D(&ftess, npts, ntris) != EGADS_SUCCESS)
+        return EGADS_MALLOC;
+      memcpy(ftess.xyz, btess->tess2d[i].xyz, 5*(size_t) npts*sizeof(double) +
+             (2*(size_t) npts + 6*(size_t) ntris)*sizeof(int));
+      btess->tess2d[i].xyz    = ftess.xyz;
+      btess->tess2d[i].uv     = ftess.uv;
+      btess->tess2d[i].ptype  = ftess.ptype;
+      btess->tess2d[i].pindex = ftess.pindex;
+      btess->tess2d[i].tris   = ftess.tris;
+      btess->tess2d[i].tric   = ftess.tric;
+    }
+
+  EG_unmapTess(btess);
+  return EGADS_SUCCESS;
+}
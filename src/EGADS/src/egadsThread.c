@@ -0,0 +1,210 @@
+/*
+ *      EGADS: Electronic Geometry Aircraft Design System
+ *
+ *             Thread & Lock Functions
+ *
+ *      Copyright 2011-2012, Massachusetts Institute of Technology
+ *      Licensed under The GNU Lesser General Public License, version 2.1
+ *      See http://www.opensource.org/licenses/lgpl-2.1.php
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <unistd.h>
+#include <pthread.h>
+#endif
+
+#include "egadsTypes.h"
+#include "egadsInternals.h"
+
+
+#define MAXTHREAD 64                    /* max threads in EG_runThreads */
+
+
+  typedef struct {
+    void (*entry)(void *);              /* the function to run */
+    void *arg;                          /* its argument */
+  } egThread;
+
+
+#ifdef WIN32
+
+int
+EG_numProcs()
+{
+  SYSTEM_INFO info;
+
+  GetSystemInfo(&info);
+  if (info.dwNumberOfProcessors < 1) return 1;
+  return info.dwNumberOfProcessors;
+}
+
+
+void *
+EG_mutexCreate()
+{
+  CRITICAL_SECTION *mutex;
+
+  mutex = (CRITICAL_SECTION *) EG_alloc(sizeof(CRITICAL_SECTION));
+  if (mutex == NULL) return NULL;
+  InitializeCriticalSection(mutex);
+  return mutex;
+}
+
+
+void
+EG_mutexLock(void *mutex)
+{
+  if (mutex == NULL) return;
+  EnterCriticalSection((CRITICAL_SECTION *) mutex);
+}
+
+
+void
+EG_mutexUnlock(void *mutex)
+{
+  if (mutex == NULL) return;
+  LeaveCriticalSection((CRITICAL_SECTION *) mutex);
+}
+
+
+void
+EG_mutexDestroy(void *mutex)
+{
+  if (mutex == NULL) return;
+  DeleteCriticalSection((CRITICAL_SECTION *) mutex);
+  EG_free(mutex);
+}
+
+
+static unsigned __stdcall
+EG_threadEntry(void *arg)
+{
+  egThread *thread = (egThread *) arg;
+
+  thread->entry(thread->arg);
+  return 0;
+}
+
+
+int
+EG_runThreads(int nthread, void (*entry)(void *), void *arg)
+{
+  int       i, n;
+  HANDLE    handles[MAXTHREAD];
+  egThread  thread;
+
+  if (nthread > MAXTHREAD) nthread = MAXTHREAD;
+  thread.entry = entry;
+  thread.arg   = arg;
+
+  /* the caller is the first worker */
+  for (n = i = 0; i < nthread-1; i++) {
+    handles[n] = (HANDLE) _beginthreadex(NULL, 0, EG_threadEntry, &thread,
+                                         0, NULL);
+    if (handles[n] != 0) n++;
+  }
+  entry(arg);
+
+  for (i = 0; i < n; i++) {
+    WaitForSingleObject(handles[i], INFINITE);
+    CloseHandle(handles[i]);
+  }
+  return n+1;
+}
+
+#else
+
+int
+EG_numProcs()
+{
+  long nproc;
+
+  nproc = sysconf(_SC_NPROCESSORS_ONLN);
+  if (nproc < 1) return 1;
+  return (int) nproc;
+}
+
+
+void *
+EG_mutexCreate()
+{
+  pthread_mutex_t     *mutex;
+  pthread_mutexattr_t attr;
+
+  /* recursive -- the same as a Windows critical section */
+  mutex = (pthread_mutex_t *) EG_alloc(sizeof(pthread_mutex_t));
+  if (mutex == NULL) return NULL;
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  if (pthread_mutex_init(mutex, &attr) != 0) {
+    pthread_mutexattr_destroy(&attr);
+    EG_free(mutex);
+    return NULL;
+  }
+  pthread_mutexattr_destroy(&attr);
+  return mutex;
+}
+
+
+void
+EG_mutexLock(void *mutex)
+{
+  if (mutex == NULL) return;
+  pthread_mutex_lock((pthread_mutex_t *) mutex);
+}
+
+
+void
+EG_mutexUnlock(void *mutex)
+{
+  if (mutex == NULL) return;
+  pthread_mutex_unlock((pthread_mutex_t *) mutex);
+}
+
+
+void
+EG_mutexDestroy(void *mutex)
+{
+  if (mutex == NULL) return;
+  pthread_mutex_destroy((pthread_mutex_t *) mutex);
+  EG_free(mutex);
+}
+
+
+static void *
+EG_threadEntry(void *arg)
+{
+  egThread *thread = (egThread *) arg;
+
+  thread->entry(thread->arg);
+  return NULL;
+}
+
+
+int
+EG_runThreads(int nthread, void (*entry)(void *), void *arg)
+{
+  int       i, n;
+  pthread_t threads[MAXTHREAD];
+  egThread  thread;
+
+  if (nthread > MAXTHREAD) nthread = MAXTHREAD;
+  thread.entry = entry;
+  thread.arg   = arg;
+
+  /* the caller is the first worker */
+  for (n = i = 0; i < nthread-1; i++)
+    if (pthread_create(&threads[n], NULL, EG_threadEntry, &thread) == 0) n++;
+  entry(arg);
+
+  for (i = 0; i < n; i++) pthread_join(threads[i], NULL);
+  return n+1;
+}
+
+#endif
@@ -51,7 +51,9 @@
                                 int sense, double t, double *result );
 
   extern     int  EG_attriBodyDup( const egObject *src, egObject *dst );
-  extern     int  EG_attriBodyCopy( const egObject *src, egObject *dst );
+  extern     int  EG_attriBodyCopy( const egObject *src, egObject *dst,
+                                    /*@null@*/ int **imaps,
+                           /*@null@*/ BRepBuilderAPI_Transform *xForm );
   extern     void EG_completePCurve( egObject *g, Handle(Geom2d_Curve) &hCurv );
   extern     void EG_completeCurve(  egObject *g, Handle(Geom_Curve)   &hCurv );
   extern     void EG_completeSurf(   egObject *g, Handle(Geom_Surface) &hSurf );
@@ -70,12 +72,89 @@ segfault_handler(int x)
 static void
 EG_cleanMaps(egadsMap *map)
 {
+  int i;
+
+  for (i = 0; i < 4; i++) {
+    if (map->ancs[i] != NULL) EG_free(map->ancs[i]);
+    map->ancs[i] = NULL;
+  }
   if (map->objs == NULL) return;
   EG_free(map->objs);
   map->objs = NULL;
 }
 
 
+/* ancestor table of the entities in map within the parents --
+ *     ancs[0..n] are offsets & ancs[n+1+ancs[i]..n+1+ancs[i+1]-1] are the
+ *     (0 bias & ascending) parent indices of map entity i+1
+ * left NULL on allocation failure (EG_getBodyTopos then searches) */
+
+static void
+EG_fillAncestors(egadsMap *map, TopAbs_ShapeEnum senum, egadsMap *parents,
+                 int pclass)
+{
+  int i, j, k, n, np, len, *ancs;
+
+  map->ancs[pclass-EDGE] = NULL;
+  n  = map->map.Extent();
+  np = parents->map.Extent();
+  if ((n == 0) || (np == 0)) return;
+
+  for (len = j = 0; j < np; j++) {
+    TopTools_IndexedMapOfShape smap;
+    TopExp::MapShapes(parents->map(j+1), senum, smap);
+    len += smap.Extent();
+  }
+  ancs = (int *) EG_alloc((n+1+len)*sizeof(int));
+  if (ancs == NULL) return;
+  for (i = 0; i <= n; i++) ancs[i] = 0;
+
+  // collect the pairs, count, make the offsets & then fill backwards
+  int *list = (int *) EG_alloc(2*len*sizeof(int));
+  if (list == NULL) {
+    EG_free(ancs);
+    return;
+  }
+  for (len = j = 0; j < np; j++) {
+    TopTools_IndexedMapOfShape smap;
+    TopExp::MapShapes(parents->map(j+1), senum, smap);
+    for (k = 1; k <= smap.Extent(); k++) {
+      i = map->map.FindIndex(smap(k));
+      if (i == 0) continue;
+      list[2*len  ] = i-1;
+      list[2*len+1] = j;
+      ancs[i-1]++;
+      len++;
+    }
+  }
+  for (i = 1; i < n; i++) ancs[i] += ancs[i-1];
+  ancs[n] = len;
+  for (k = len-1; k >= 0; k--) {
+    i = list[2*k];
+    ancs[i]--;
+    ancs[n+1+ancs[i]] = list[2*k+1];
+  }
+  EG_free(list);
+
+  map->ancs[pclass-EDGE] = ancs;
+}
+
+
+static void
+EG_derefBodyObjs(egadsMap *map, egObject *body)
+{
+  int i, n;
+
+  if (map->objs == NULL) return;
+  n = map->map.Extent();
+  for (i = 0; i < n; i++) {
+    if (map->objs[i] == NULL)        continue;
+    if (map->objs[i]->blind == NULL) continue;
+    EG_dereferenceObject(map->objs[i], body);
+  }
+}
+
+
 static void
 EG_checkStatus(const Handle_BRepCheck_Result tResult)
 {
@@ -183,7 +262,15 @@ EG_destroyTopology(egObject *topo)
   
     egadsBody *pbody = (egadsBody *) topo->blind;
     if (pbody != NULL) {
-      if (topo->mtype == WIREBODY) {
+      if (pbody->lazy != 0) {
+        // all filled egos are referenced by the Body
+        EG_derefBodyObjs(&pbody->shells, topo);
+        EG_derefBodyObjs(&pbody->faces,  topo);
+        EG_derefBodyObjs(&pbody->loops,  topo);
+        EG_derefBodyObjs(&pbody->edges,  topo);
+        EG_derefBodyObjs(&pbody->nodes,  topo);
+        if (topo->mtype == SOLIDBODY) delete [] pbody->senses;
+      } else if (topo->mtype == WIREBODY) {
         int nwire = pbody->loops.map.Extent();
         for (int i = 0; i < nwire; i++)
           EG_dereferenceObject(pbody->loops.objs[i], topo);
@@ -474,7 +561,7 @@ EG_fillTopoObjs(egObject *object, egObject *topObj)
     TopExp::Vertices(Edge, V2, V1, Standard_True);
     EG_makeObject(context, &pn1);
     if (pn1 != NULL) {
-      egadsNode *pnode = new egadsNode;
+      egadsNode *pnode = new (context) egadsNode;
       gp_Pnt pv        = BRep_Tool::Pnt(V1);
       pnode->node      = V1;
       pnode->xyz[0]    = pv.X();
@@ -495,7 +582,7 @@ EG_fillTopoObjs(egObject *object, egObject *topObj)
       object->mtype = TWONODE;
       EG_makeObject(context, &pn2);
       if (pn2 != NULL) {
-        egadsNode *pnode = new egadsNode;
+        egadsNode *pnode = new (context) egadsNode;
         gp_Pnt pv        = BRep_Tool::Pnt(V2);
         pnode->node      = V2;
         pnode->xyz[0]    = pv.X();
@@ -570,7 +657,7 @@ EG_fillTopoObjs(egObject *object, egObject *topObj)
         stat = EG_makeObject(context, &edgeo[k]);
         if (stat != EGADS_SUCCESS) continue;
         edgeo[k]->oclass = EDGE;
-        egadsEdge *pedge = new egadsEdge;
+        egadsEdge *pedge = new (context) egadsEdge;
         pedge->edge      = Edge;
         pedge->curve     = NULL;
         pedge->nodes[0]  = NULL;
@@ -603,18 +690,534 @@ EG_fillTopoObjs(egObject *object, egObject *topObj)
 }
 
 
+/* fill the ego (made if need be) for the entities of a Body --
+ *     lazy Bodies get here on first access & reference all that is filled */
+
+static int
+EG_bodyEgo(egObject *context, egObject **objs, int j)
+{
+  if (objs[j] != NULL) return EGADS_SUCCESS;
+  return EG_makeObject(context, &objs[j]);
+}
+
+
+static int
+EG_fillNode(egObject *context, egObject *bobj, egObject *topObj,
+            egadsBody *body, int j)
+{
+  int      stat;
+  egObject *obj;
+
+  stat = EG_bodyEgo(context, body->nodes.objs, j);
+  if (stat != EGADS_SUCCESS) return stat;
+  obj = body->nodes.objs[j];
+  if (obj->blind != NULL) return EGADS_SUCCESS;
+
+  egadsNode *pnode   = new (context) egadsNode;
+  TopoDS_Shape shape = body->nodes.map(j+1);
+  TopoDS_Vertex Vert = TopoDS::Vertex(shape);
+  gp_Pnt pv          = BRep_Tool::Pnt(Vert);
+  pnode->node        = Vert;
+  pnode->xyz[0]      = pv.X();
+  pnode->xyz[1]      = pv.Y();
+  pnode->xyz[2]      = pv.Z();
+  pnode->bIndex      = j+1;
+  obj->oclass        = NODE;
+  obj->blind         = pnode;
+  obj->topObj        = topObj;
+  if (body->lazy == 1) EG_referenceObject(obj, bobj);
+
+  return EGADS_SUCCESS;
+}
+
+
+static int
+EG_fillEdge(egObject *context, egObject *bobj, egObject *topObj,
+            egadsBody *body, int j)
+{
+  int           n1, n2, stat, outLevel, degen = 0;
+  egObject      *obj, *geom;
+  TopoDS_Vertex V1, V2;
+  Standard_Real t1, t2;
+
+  int nEdge = body->edges.map.Extent();
+  stat = EG_bodyEgo(context, body->edges.objs, j);
+  if (stat != EGADS_SUCCESS) return stat;
+  obj = body->edges.objs[j];
+  if (obj->blind != NULL) return EGADS_SUCCESS;
+  stat = EG_bodyEgo(context, body->edges.objs, j+nEdge);
+  if (stat != EGADS_SUCCESS) return stat;
+  outLevel = EG_outLevel(context);
+
+  egadsEdge *pedge   = new (context) egadsEdge;
+  geom               = body->edges.objs[j+nEdge];
+  TopoDS_Shape shape = body->edges.map(j+1);
+  geom->topObj       = topObj;
+  TopoDS_Edge Edge   = TopoDS::Edge(shape);
+  if (BRep_Tool::Degenerated(Edge)) {
+    degen        = 1;
+    geom->oclass = CURVE;
+    geom->mtype  = DEGENERATE;
+    geom->blind  = NULL;
+  } else {
+    Handle(Geom_Curve) hCurve = BRep_Tool::Curve(Edge, t1, t2);
+    EG_completeCurve(geom, hCurve);
+  }
+
+  TopExp::Vertices(Edge, V2, V1, Standard_True);
+  if (Edge.Orientation() != TopAbs_REVERSED) {
+    n1 = body->nodes.map.FindIndex(V2);
+    n2 = body->nodes.map.FindIndex(V1);
+  } else {
+    n1 = body->nodes.map.FindIndex(V1);
+    n2 = body->nodes.map.FindIndex(V2);
+  }
+  if (outLevel > 2)
+    printf(" Edge %d:  nodes = %d %d  degen = %d (%lf, %lf)\n",
+           j+1, n1, n2, degen, t1, t2);
+  egObject *pn1 = NULL;
+  egObject *pn2 = NULL;
+  if ((n1 == 0) || (n2 == 0))
+    printf(" EGADS Warning: Node(s) not found for Edge!\n");
+  if (n1 != 0) {
+    stat = EG_fillNode(context, bobj, topObj, body, n1-1);
+    if (stat == EGADS_SUCCESS) pn1 = body->nodes.objs[n1-1];
+  }
+  if (n2 != 0) {
+    stat = EG_fillNode(context, bobj, topObj, body, n2-1);
+    if (stat == EGADS_SUCCESS) pn2 = body->nodes.objs[n2-1];
+  }
+
+  pedge->edge     = Edge;
+  pedge->curve    = geom;
+  pedge->nodes[0] = pn1;
+  pedge->nodes[1] = pn2;
+  pedge->topFlg   = 0;
+  pedge->bIndex   = j+1;
+  obj->oclass     = EDGE;
+  obj->blind      = pedge;
+  obj->topObj     = topObj;
+  obj->mtype      = TWONODE;
+  if (n1 == n2) obj->mtype = ONENODE;
+  if (degen == 1) {
+    obj->mtype = DEGENERATE;
+  } else {
+    EG_referenceObject(geom, obj);
+  }
+  EG_referenceObject(pn1, obj);
+  EG_referenceObject(pn2, obj);
+  if (body->lazy == 1) EG_referenceObject(obj, bobj);
+
+  return EGADS_SUCCESS;
+}
+
+
+static int
+EG_fillLoop(egObject *context, egObject *bobj, egObject *topObj,
+            egadsBody *body, int j)
+{
+  int      k, hit, stat, outLevel, *senses = NULL, closed = 0, ne = 0;
+  egObject *obj, *geom, **edgeo = NULL;
+
+  stat = EG_bodyEgo(context, body->loops.objs, j);
+  if (stat != EGADS_SUCCESS) return stat;
+  obj = body->loops.objs[j];
+  if (obj->blind != NULL) return EGADS_SUCCESS;
+  outLevel = EG_outLevel(context);
+  int nFace = body->faces.map.Extent();
+
+  egadsLoop *ploop   = new (context) egadsLoop;
+  TopoDS_Shape shape = body->loops.map(j+1);
+  obj->oclass        = LOOP;
+  if (shape.Closed()) closed = 1;
+  TopoDS_Wire Wire = TopoDS::Wire(shape);
+  BRepTools_WireExplorer ExpWE;
+  for (ExpWE.Init(Wire); ExpWE.More(); ExpWE.Next()) ne++;
+  if (outLevel > 2)
+    printf(" Loop %d: # edges = %d, closed = %d\n", j+1, ne, closed);
+
+  // find the Face -- the first in the ancestor table or by searching
+  TopoDS_Face Face;
+  int *ancs = body->loops.ancs[FACE-EDGE];
+  if (ancs != NULL) {
+    int nLoop = body->loops.map.Extent();
+    hit = ancs[j+1] - ancs[j];
+    k   = 0;
+    if (hit != 0) {
+      k    = ancs[nLoop+1+ancs[j]];
+      Face = TopoDS::Face(body->faces.map(k+1));
+    }
+  } else {
+    for (hit = k = 0; k < nFace; k++) {
+      TopoDS_Shape shapf = body->faces.map(k+1);
+      Face = TopoDS::Face(shapf);
+      TopExp_Explorer ExpW;
+      for (ExpW.Init(shapf, TopAbs_WIRE); ExpW.More(); ExpW.Next()) {
+        TopoDS_Shape shapw = ExpW.Current();
+        TopoDS_Wire  fwire = TopoDS::Wire(shapw);
+        if (fwire.IsSame(Wire)) {
+          hit++;
+          break;
+        }
+      }
+      if (hit != 0) break;
+    }
+  }
+  if ((hit == 0) && (outLevel > 0) && (nFace != 0))
+    printf(" EGADS Internal: Loop without a Face!\n");
+  geom = NULL;
+  if (hit != 0) {
+    stat = EG_bodyEgo(context, body->faces.objs, k+nFace);
+    if (stat != EGADS_SUCCESS) {
+      delete ploop;
+      return stat;
+    }
+    geom = body->faces.objs[k+nFace];
+    if (geom->oclass != SURFACE) {
+      Handle(Geom_Surface) hSurface = BRep_Tool::Surface(Face);
+      geom->topObj = topObj;
+      EG_completeSurf(geom, hSurface);
+    }
+    hit = 2;
+    if (geom->mtype == PLANE) hit = 1;
+  } else {
+    hit = 1;
+  }
+  if (hit == 1) {
+    geom = NULL;
+  } else {
+    EG_referenceObject(geom, obj);
+  }
+
+  if (ne > 0) {
+    edgeo  = new egObject*[hit*ne];
+    senses = new int[ne];
+  }
+  k = 0;
+#ifdef FACEWIRE
+  if (hit != 0) {
+    for (ExpWE.Init(Wire, Face); ExpWE.More(); ExpWE.Next()) {
+      TopoDS_Shape shapW = ExpWE.Current();
+      TopoDS_Edge  Edge  = TopoDS::Edge(shapW);
+      int          ed    = body->edges.map.FindIndex(Edge);
+      edgeo[k]           = NULL;
+      senses[k]          = 1;
+      if (shapW.Orientation() == TopAbs_REVERSED) senses[k] = -1;
+      if (ed != 0) {
+        stat = EG_fillEdge(context, bobj, topObj, body, ed-1);
+        if (stat != EGADS_SUCCESS) ed = 0;
+      }
+      if (ed != 0) {
+        egObject *eobj = body->edges.objs[ed-1];
+        edgeo[k]       = eobj;
+        if (hit == 2) edgeo[k+ne] = NULL;
+        EG_referenceObject(eobj, obj);
+      } else {
+        printf(" EGADS Warning: Edge not found for Loop!\n");
+      }
+      if (outLevel > 2)
+        printf("        %d  edge = %d   sense = %d\n", k, ed, senses[k]);
+      k++;
+    }
+  } else {
+#endif
+    for (ExpWE.Init(Wire); ExpWE.More(); ExpWE.Next()) {
+      TopoDS_Shape shapW = ExpWE.Current();
+      TopoDS_Edge  Edge  = TopoDS::Edge(shapW);
+      int          ed    = body->edges.map.FindIndex(Edge);
+      edgeo[k]           = NULL;
+      senses[k]          = 1;
+      if (shapW.Orientation() == TopAbs_REVERSED) senses[k] = -1;
+      if (ed != 0) {
+        stat = EG_fillEdge(context, bobj, topObj, body, ed-1);
+        if (stat != EGADS_SUCCESS) ed = 0;
+      }
+      if (ed != 0) {
+        egObject *eobj = body->edges.objs[ed-1];
+        edgeo[k]       = eobj;
+        if (hit == 2) edgeo[k+ne] = NULL;
+        EG_referenceObject(eobj, obj);
+      } else {
+        printf(" EGADS Warning: Edge not found for Loop!\n");
+      }
+      if (outLevel > 2)
+        printf("        %d  edge = %d   sense = %d\n", k, ed, senses[k]);
+      k++;
+    }
+#ifdef FACEWIRE
+  }
+#endif
+  ploop->loop    = Wire;
+  ploop->surface = geom;
+  ploop->nedges  = ne;
+  ploop->edges   = edgeo;
+  ploop->senses  = senses;
+  ploop->topFlg  = 0;
+  ploop->bIndex  = j+1;
+  obj->blind     = ploop;
+  obj->topObj    = topObj;
+  obj->mtype     = OPEN;
+  if (closed == 1) obj->mtype = CLOSED;
+  if ((body->lazy == 1) || (bobj->mtype == WIREBODY))
+    EG_referenceObject(obj, bobj);
+
+  return EGADS_SUCCESS;
+}
+
+
+static int
+EG_fillFace(egObject *context, egObject *bobj, egObject *topObj,
+            egadsBody *body, int j)
+{
+  int      k, stat, outLevel, *senses = NULL;
+  egObject *obj, *geom, **loopo = NULL;
+
+  int nFace = body->faces.map.Extent();
+  stat = EG_bodyEgo(context, body->faces.objs, j);
+  if (stat != EGADS_SUCCESS) return stat;
+  obj = body->faces.objs[j];
+  if (obj->blind != NULL) return EGADS_SUCCESS;
+  stat = EG_bodyEgo(context, body->faces.objs, j+nFace);
+  if (stat != EGADS_SUCCESS) return stat;
+  outLevel = EG_outLevel(context);
+
+  egadsFace *pface   = new (context) egadsFace;
+  geom               = body->faces.objs[j+nFace];
+  TopoDS_Shape shape = body->faces.map(j+1);
+  obj->oclass        = FACE;
+  TopoDS_Face Face   = TopoDS::Face(shape);
+  if (geom->oclass != SURFACE) {
+    Handle(Geom_Surface) hSurface = BRep_Tool::Surface(Face);
+    geom->topObj = topObj;
+    EG_completeSurf(geom, hSurface);
+  }
+  EG_referenceObject(geom, obj);
+
+  int nl = 0;
+  TopExp_Explorer ExpW;
+  for (ExpW.Init(shape, TopAbs_WIRE); ExpW.More(); ExpW.Next()) nl++;
+  if (outLevel > 2)
+    printf(" Face %d: # loops = %d\n", j+1, nl);
+  TopoDS_Wire oWire = BRepTools::OuterWire(Face);
+
+  if (nl > 0) {
+    loopo  = new egObject*[nl];
+    senses = new int[nl];
+  }
+  k = 0;
+  for (ExpW.Init(shape, TopAbs_WIRE); ExpW.More(); ExpW.Next()) {
+    TopoDS_Shape shapw = ExpW.Current();
+    TopoDS_Wire  Wire  = TopoDS::Wire(shapw);
+    loopo[k]           = NULL;
+    senses[k]          = -1;
+    if (Wire.IsSame(oWire)) senses[k] = 1;
+    int lp = body->loops.map.FindIndex(Wire);
+    if (lp != 0) {
+      stat = EG_fillLoop(context, bobj, topObj, body, lp-1);
+      if (stat != EGADS_SUCCESS) lp = 0;
+    }
+    if (lp != 0) {
+      loopo[k] = body->loops.objs[lp-1];
+      EG_fillPCurves(Face, geom, loopo[k], topObj);
+      EG_referenceObject(loopo[k], obj);
+    } else {
+      printf(" EGADS Warning: Loop not found for Face!\n");
+    }
+    if (outLevel > 2)
+      printf("        %d  loop = %d     outer = %d\n", k, lp, senses[k]);
+    k++;
+  }
+  pface->face    = Face;
+  pface->surface = geom;
+  pface->nloops  = nl;
+  pface->loops   = loopo;
+  pface->senses  = senses;
+  pface->topFlg  = 0;
+  pface->bIndex  = j+1;
+  obj->blind     = pface;
+  obj->topObj    = topObj;
+  obj->mtype     = SFORWARD;
+  if (Face.Orientation() == TopAbs_REVERSED) obj->mtype = SREVERSE;
+  if ((body->lazy == 1) || (bobj->mtype == FACEBODY))
+    EG_referenceObject(obj, bobj);
+
+  return EGADS_SUCCESS;
+}
+
+
+static int
+EG_fillShell(egObject *context, egObject *bobj, egObject *topObj,
+             egadsBody *body, int j)
+{
+  int      k, stat, outLevel;
+  egObject *obj, **faceo = NULL;
+
+  stat = EG_bodyEgo(context, body->shells.objs, j);
+  if (stat != EGADS_SUCCESS) return stat;
+  obj = body->shells.objs[j];
+  if (obj->blind != NULL) return EGADS_SUCCESS;
+  outLevel = EG_outLevel(context);
+
+  egadsShell *pshell = new (context) egadsShell;
+  TopoDS_Shape shape = body->shells.map(j+1);
+  obj->oclass        = SHELL;
+  TopoDS_Shell Shell = TopoDS::Shell(shape);
+
+  int nf = 0;
+  TopExp_Explorer ExpF;
+  for (ExpF.Init(shape, TopAbs_FACE); ExpF.More(); ExpF.Next()) nf++;
+
+  if (nf > 0) faceo = new egObject*[nf];
+
+  k = 0;
+  for (ExpF.Init(shape, TopAbs_FACE); ExpF.More(); ExpF.Next()) {
+    TopoDS_Shape shapf = ExpF.Current();
+    TopoDS_Face  Face  = TopoDS::Face(shapf);
+    faceo[k]           = NULL;
+    int fa = body->faces.map.FindIndex(Face);
+    if (fa != 0) {
+      stat = EG_fillFace(context, bobj, topObj, body, fa-1);
+      if (stat != EGADS_SUCCESS) fa = 0;
+    }
+    if (fa != 0) {
+      faceo[k] = body->faces.objs[fa-1];
+      EG_referenceObject(faceo[k], obj);
+    } else {
+      printf(" EGADS Warning: Face not found for Shell!\n");
+    }
+    if (outLevel > 2)
+      printf(" Shell %d/%d: Face = %d\n", k, j+1, fa);
+    k++;
+  }
+  pshell->shell  = Shell;
+  pshell->nfaces = nf;
+  pshell->faces  = faceo;
+  pshell->topFlg = 0;
+  pshell->bIndex = j+1;
+  obj->blind     = pshell;
+  obj->topObj    = topObj;
+  obj->mtype     = EG_shellClosure(pshell, 0);
+  if ((body->lazy == 1) || (bobj->mtype >= SHEETBODY))
+    EG_referenceObject(obj, bobj);
+
+  return EGADS_SUCCESS;
+}
+
+
+/* materialize entity index (bias 0) of oclass -- Context mutex held */
+
+static int
+EG_fillBodyEnt(egObject *context, egObject *bobj, egObject *topObj,
+               egadsBody *pbody, int oclass, int index)
+{
+  if (oclass == NODE) {
+    return EG_fillNode(context,  bobj, topObj, pbody, index);
+  } else if (oclass == EDGE) {
+    return EG_fillEdge(context,  bobj, topObj, pbody, index);
+  } else if (oclass == LOOP) {
+    return EG_fillLoop(context,  bobj, topObj, pbody, index);
+  } else if (oclass == FACE) {
+    return EG_fillFace(context,  bobj, topObj, pbody, index);
+  }
+  return EG_fillShell(context, bobj, topObj, pbody, index);
+}
+
+
+/* materialize entity index (bias 0) of oclass for a lazy Body */
+
 int
-EG_traverseBody(egObject *context, int i, egObject *bobj, 
-                egObject *topObj, egadsBody *body)
+EG_fillBodyObj(egObject *bobj, int oclass, int index)
 {
-  int          j, k, outLevel, stat, solid = 0;
-  TopoDS_Shape shape;
-  egObject     *obj, *geom;
-  
+  int       stat = EGADS_SUCCESS;
+  egObject  *context, *topObj;
+  egadsBody *pbody = (egadsBody *) bobj->blind;
+
+  if (pbody->lazy != 1) return EGADS_SUCCESS;
+  context = EG_context(bobj);
+  topObj  = bobj;
+  if (bobj->topObj->oclass == MODEL) topObj = bobj->topObj;
+
+  // one filler at a time -- the Body may be shared between threads
+  egCntxt *cntx = (egCntxt *) context->blind;
+  EG_mutexLock(cntx->mutex);
+  if (pbody->lazy == 1)
+    stat = EG_fillBodyEnt(context, bobj, topObj, pbody, oclass, index);
+  EG_mutexUnlock(cntx->mutex);
+
+  return stat;
+}
+
+
+/* materialize everything in a lazy Body (for code that walks the maps) */
+
+int
+EG_fillBody(const egObject *body)
+{
+  int       i, j, n, stat = EGADS_SUCCESS;
+  egObject  *context, *topObj;
+  egObject  *bobj  = (egObject *) body;
+  egadsBody *pbody = (egadsBody *) bobj->blind;
+  int       oclass[5] = {NODE, EDGE, LOOP, FACE, SHELL};
+
+  if (pbody == NULL)    return EGADS_NODATA;
+  if (bobj->oclass == MODEL) {
+    egadsModel *pmodel = (egadsModel *) bobj->blind;
+    for (i = 0; i < pmodel->nbody; i++) {
+      stat = EG_fillBody(pmodel->bodies[i]);
+      if (stat != EGADS_SUCCESS) return stat;
+    }
+    return EGADS_SUCCESS;
+  }
+  if (bobj->oclass != BODY) return EGADS_SUCCESS;
+  if (pbody->lazy != 1)     return EGADS_SUCCESS;
+  context = EG_context(bobj);
+  topObj  = bobj;
+  if (bobj->topObj->oclass == MODEL) topObj = bobj->topObj;
+
+  // hold the mutex for the whole fill so no filler sees a partial switch
+  egCntxt *cntx = (egCntxt *) context->blind;
+  EG_mutexLock(cntx->mutex);
+  if (pbody->lazy == 1) {
+    for (j = 0; j < 5; j++) {
+      if (oclass[j] == NODE) {
+        n = pbody->nodes.map.Extent();
+      } else if (oclass[j] == EDGE) {
+        n = pbody->edges.map.Extent();
+      } else if (oclass[j] == LOOP) {
+        n = pbody->loops.map.Extent();
+      } else if (oclass[j] == FACE) {
+        n = pbody->faces.map.Extent();
+      } else {
+        n = pbody->shells.map.Extent();
+      }
+      for (i = 0; i < n; i++) {
+        stat = EG_fillBodyEnt(context, bobj, topObj, pbody, oclass[j], i);
+        if (stat != EGADS_SUCCESS) break;
+      }
+      if (stat != EGADS_SUCCESS) break;
+    }
+    if (stat == EGADS_SUCCESS)
+      pbody->lazy = 2;                  // complete -- still Body referenced
+  }
+  EG_mutexUnlock(cntx->mutex);
+
+  return stat;
+}
+
+
+static int
+EG_traverse(egObject *context, int i, egObject *bobj, egObject *topObj,
+            egadsBody *body, int lazy)
+{
+  int j, outLevel, stat, solid = 0;
+
   outLevel = EG_outLevel(context);
   if (body->shape.ShapeType() == TopAbs_SOLID) solid = 1;
-  
-  TopExp_Explorer Exp;
+  body->lazy = lazy;
+  for (j = 0; j < 4; j++)
+    body->nodes.ancs[j] = body->edges.ancs[j] = body->loops.ancs[j] =
+    body->faces.ancs[j] = body->shells.ancs[j] = NULL;
+
   TopExp::MapShapes(body->shape, TopAbs_VERTEX, body->nodes.map);
   TopExp::MapShapes(body->shape, TopAbs_EDGE,   body->edges.map);
   TopExp::MapShapes(body->shape, TopAbs_WIRE,   body->loops.map);
@@ -634,17 +1237,19 @@ EG_traverseBody(egObject *context, int i, egObject *bobj,
       if (solid == 1) bobj->mtype = SOLIDBODY;
     }
   }
-  
+
   if (outLevel > 1)
     printf(" EGADS Info: Shape %d has %d Nodes, %d Edges, %d Loops, %d Faces and %d Shells\n",
            i+1, nNode, nEdge, nLoop, nFace, nShell);
-  
-  // allocate ego storage
-  
+
+  // allocate ego storage (lazy Bodies make the egos when asked)
+
   if (nNode > 0) {
     body->nodes.objs = (egObject **) EG_alloc(nNode*sizeof(egObject *));
     if (body->nodes.objs == NULL) return EGADS_MALLOC;
     for (j = 0; j < nNode; j++) {
+      body->nodes.objs[j] = NULL;
+      if (lazy == 1) continue;
       stat = EG_makeObject(context, &body->nodes.objs[j]);
       if (stat != EGADS_SUCCESS) {
         EG_cleanMaps(&body->nodes);
@@ -659,6 +1264,8 @@ EG_traverseBody(egObject *context, int i, egObject *bobj,
       return EGADS_MALLOC;
     }
     for (j = 0; j < 2*nEdge; j++) {
+      body->edges.objs[j] = NULL;
+      if (lazy == 1) continue;
       stat = EG_makeObject(context, &body->edges.objs[j]);
       if (stat != EGADS_SUCCESS) {
         EG_cleanMaps(&body->edges);
@@ -675,6 +1282,8 @@ EG_traverseBody(egObject *context, int i, egObject *bobj,
       return EGADS_MALLOC;
     }
     for (j = 0; j < nLoop; j++) {
+      body->loops.objs[j] = NULL;
+      if (lazy == 1) continue;
       stat = EG_makeObject(context, &body->loops.objs[j]);
       if (stat != EGADS_SUCCESS) {
         EG_cleanMaps(&body->loops);
@@ -693,6 +1302,8 @@ EG_traverseBody(egObject *context, int i, egObject *bobj,
       return EGADS_MALLOC;
     }
     for (j = 0; j < 2*nFace; j++) {
+      body->faces.objs[j] = NULL;
+      if (lazy == 1) continue;
       stat = EG_makeObject(context, &body->faces.objs[j]);
       if (stat != EGADS_SUCCESS) {
         EG_cleanMaps(&body->faces);
@@ -713,6 +1324,8 @@ EG_traverseBody(egObject *context, int i, egObject *bobj,
       return EGADS_MALLOC;
     }
     for (j = 0; j < nShell; j++) {
+      body->shells.objs[j] = NULL;
+      if (lazy == 1) continue;
       stat = EG_makeObject(context, &body->shells.objs[j]);
       if (stat != EGADS_SUCCESS) {
         EG_cleanMaps(&body->shells);
@@ -725,313 +1338,61 @@ EG_traverseBody(egObject *context, int i, egObject *bobj,
     }
   }
 
-  // fill our stuff
-
-  for (j = 0; j < nNode; j++) {
-    egadsNode *pnode   = new egadsNode;
-    obj                = body->nodes.objs[j];
-    shape              = body->nodes.map(j+1);
-    TopoDS_Vertex Vert = TopoDS::Vertex(shape);
-    gp_Pnt pv          = BRep_Tool::Pnt(Vert);
-    pnode->node        = Vert;
-    pnode->xyz[0]      = pv.X();
-    pnode->xyz[1]      = pv.Y();
-    pnode->xyz[2]      = pv.Z();
-    obj->oclass        = NODE;
-    obj->blind         = pnode;
-    obj->topObj        = topObj;
-  }
-  
-  for (j = 0; j < nEdge; j++) {
-    int           n1, n2, degen = 0;
-    TopoDS_Vertex V1, V2;
-    Standard_Real t1, t2;
-
-    egadsEdge *pedge = new egadsEdge;
-    obj              = body->edges.objs[j];
-    geom             = body->edges.objs[j+nEdge];
-    shape            = body->edges.map(j+1);
-    geom->topObj     = topObj;
-    TopoDS_Edge Edge = TopoDS::Edge(shape);
-    if (BRep_Tool::Degenerated(Edge)) {
-      degen        = 1;
-      geom->oclass = CURVE;
-      geom->mtype  = DEGENERATE;
-      geom->blind  = NULL;
-    } else {
-      Handle(Geom_Curve) hCurve = BRep_Tool::Curve(Edge, t1, t2);
-      EG_completeCurve(geom, hCurve);
-    }
-    
-    TopExp::Vertices(Edge, V2, V1, Standard_True);
-    if (Edge.Orientation() != TopAbs_REVERSED) {
-      n1 = body->nodes.map.FindIndex(V2);
-      n2 = body->nodes.map.FindIndex(V1);    
-    } else {
-      n1 = body->nodes.map.FindIndex(V1);
-      n2 = body->nodes.map.FindIndex(V2);
-    }
-    if (outLevel > 2)
-      printf(" Edge %d:  nodes = %d %d  degen = %d (%lf, %lf)\n", 
-             j+1, n1, n2, degen, t1, t2);
-    egObject *pn1 = NULL;
-    egObject *pn2 = NULL;
-    if ((n1 == 0) || (n2 == 0))
-      printf(" EGADS Warning: Node(s) not found for Edge!\n");
-    if (n1 != 0) pn1 = body->nodes.objs[n1-1];
-    if (n2 != 0) pn2 = body->nodes.objs[n2-1];
-
-    pedge->edge     = Edge;
-    pedge->curve    = geom;
-    pedge->nodes[0] = pn1;
-    pedge->nodes[1] = pn2;
-    pedge->topFlg   = 0;
-    obj->oclass     = EDGE;
-    obj->blind      = pedge;
-    obj->topObj     = topObj;
-    obj->mtype      = TWONODE;
-    if (n1 == n2) obj->mtype = ONENODE;
-    if (degen == 1) {
-      obj->mtype = DEGENERATE;
-    } else {
-      EG_referenceObject(geom, obj);
-    }
-    EG_referenceObject(pn1, obj);
-    EG_referenceObject(pn2, obj);
-  }
-  
-  for (j = 0; j < nLoop; j++) {
-    int      *senses = NULL, closed = 0, ne = 0;
-    egObject **edgeo = NULL;
-
-    egadsLoop *ploop = new egadsLoop;
-    obj              = body->loops.objs[j];
-    shape            = body->loops.map(j+1);
-    obj->oclass      = LOOP;
-    if (shape.Closed()) closed = 1;
-    TopoDS_Wire Wire = TopoDS::Wire(shape);
-    BRepTools_WireExplorer ExpWE;
-    for (ExpWE.Init(Wire); ExpWE.More(); ExpWE.Next()) ne++;
-    if (outLevel > 2)
-      printf(" Loop %d: # edges = %d, closed = %d\n", j+1, ne, closed);
-
-    // find the Face
-    TopoDS_Face Face;
-    int         hit;
-    for (hit = k = 0; k < nFace; k++) {
-      TopoDS_Shape shapf = body->faces.map(k+1);
-      Face = TopoDS::Face(shapf);
-      TopExp_Explorer ExpW;
-      for (ExpW.Init(shapf, TopAbs_WIRE); ExpW.More(); ExpW.Next()) {
-        TopoDS_Shape shapw = ExpW.Current();
-        TopoDS_Wire  fwire = TopoDS::Wire(shapw);
-        if (fwire.IsSame(Wire)) {
-          hit++;
-          break;
-        }
-      }
-      if (hit != 0) break;
-    }
-    if ((hit == 0) && (outLevel > 0) && (nFace != 0))
-      printf(" EGADS Internal: Loop without a Face!\n");
-    if (hit != 0) {
-      geom = body->faces.objs[k+nFace];
-      if (geom->oclass != SURFACE) {
-        Handle(Geom_Surface) hSurface = BRep_Tool::Surface(Face);
-        geom->topObj = topObj;
-        EG_completeSurf(geom, hSurface);
-      }
-      hit = 2;
-      if (geom->mtype == PLANE) hit = 1;
-    } else {
-      hit = 1;
-    }
-    if (hit == 1) {
-      geom = NULL;
-    } else {
-      EG_referenceObject(geom, obj);
-    }
-
-    if (ne > 0) {
-      edgeo  = new egObject*[hit*ne];
-      senses = new int[ne];
-    }
-    k = 0;
-#ifdef FACEWIRE
-    if (hit != 0) {
-      for (ExpWE.Init(Wire, Face); ExpWE.More(); ExpWE.Next()) {
-        TopoDS_Shape shapW = ExpWE.Current();
-        TopoDS_Edge  Edge  = TopoDS::Edge(shapW);
-        int          ed    = body->edges.map.FindIndex(Edge);
-        edgeo[k]           = NULL;
-        senses[k]          = 1;
-        if (shapW.Orientation() == TopAbs_REVERSED) senses[k] = -1;
-        if (ed != 0) {
-          egObject *eobj = body->edges.objs[ed-1];
-          edgeo[k]       = eobj;
-          if (hit == 2) edgeo[k+ne] = NULL;
-          EG_referenceObject(eobj, obj);
-        } else {
-          printf(" EGADS Warning: Edge not found for Loop!\n");
-        }
-        if (outLevel > 2)
-          printf("        %d  edge = %d   sense = %d\n", k, ed, senses[k]);
-        k++;
-      }
-    } else {
-#endif
-      for (ExpWE.Init(Wire); ExpWE.More(); ExpWE.Next()) {
-        TopoDS_Shape shapW = ExpWE.Current();
-        TopoDS_Edge  Edge  = TopoDS::Edge(shapW);
-        int          ed    = body->edges.map.FindIndex(Edge);
-        edgeo[k]           = NULL;
-        senses[k]          = 1;
-        if (shapW.Orientation() == TopAbs_REVERSED) senses[k] = -1;
-        if (ed != 0) {
-          egObject *eobj = body->edges.objs[ed-1];
-          edgeo[k]       = eobj;
-          if (hit == 2) edgeo[k+ne] = NULL;
-          EG_referenceObject(eobj, obj);
-        } else {
-          printf(" EGADS Warning: Edge not found for Loop!\n");
-        }
-        if (outLevel > 2)
-          printf("        %d  edge = %d   sense = %d\n", k, ed, senses[k]);
-        k++;
-      }
-#ifdef FACEWIRE
-    }
-#endif
-    ploop->loop    = Wire;
-    ploop->surface = geom;
-    ploop->nedges  = ne;
-    ploop->edges   = edgeo;
-    ploop->senses  = senses;
-    ploop->topFlg  = 0;
-    obj->blind     = ploop;
-    obj->topObj    = topObj;
-    obj->mtype     = OPEN;
-    if (closed == 1) obj->mtype = CLOSED;
-    if (bobj->mtype == WIREBODY) EG_referenceObject(obj, bobj);
-  }
-
-  for (j = 0; j < nFace; j++) {
-    int      *senses = NULL;
-    egObject **loopo = NULL;
-    
-    egadsFace *pface = new egadsFace;
-    obj              = body->faces.objs[j];
-    geom             = body->faces.objs[j+nFace];
-    shape            = body->faces.map(j+1);
-    obj->oclass      = FACE;
-    TopoDS_Face Face = TopoDS::Face(shape);
-    if (geom->oclass != SURFACE) {
-      Handle(Geom_Surface) hSurface = BRep_Tool::Surface(Face);
-      geom->topObj = topObj;
-      EG_completeSurf(geom, hSurface);
-    }
-    EG_referenceObject(geom, obj);
+  // upward adjacency (for EG_getBodyTopos & finding the Face of a Loop)
 
-    int nl = 0;
-    TopExp_Explorer ExpW;
-    for (ExpW.Init(shape, TopAbs_WIRE); ExpW.More(); ExpW.Next()) nl++;
-    if (outLevel > 2)
-      printf(" Face %d: # loops = %d\n", j+1, nl);
-    TopoDS_Wire oWire = BRepTools::OuterWire(Face);
+  EG_fillAncestors(&body->nodes, TopAbs_VERTEX, &body->edges,  EDGE);
+  EG_fillAncestors(&body->nodes, TopAbs_VERTEX, &body->loops,  LOOP);
+  EG_fillAncestors(&body->nodes, TopAbs_VERTEX, &body->faces,  FACE);
+  EG_fillAncestors(&body->nodes, TopAbs_VERTEX, &body->shells, SHELL);
+  EG_fillAncestors(&body->edges, TopAbs_EDGE,   &body->loops,  LOOP);
+  EG_fillAncestors(&body->edges, TopAbs_EDGE,   &body->faces,  FACE);
+  EG_fillAncestors(&body->edges, TopAbs_EDGE,   &body->shells, SHELL);
+  EG_fillAncestors(&body->loops, TopAbs_WIRE,   &body->faces,  FACE);
+  EG_fillAncestors(&body->loops, TopAbs_WIRE,   &body->shells, SHELL);
+  EG_fillAncestors(&body->faces, TopAbs_FACE,   &body->shells, SHELL);
 
-    if (nl > 0) {
-      loopo  = new egObject*[nl];
-      senses = new int[nl];
-    }
-    k = 0;
-    for (ExpW.Init(shape, TopAbs_WIRE); ExpW.More(); ExpW.Next()) {
-      TopoDS_Shape shapw = ExpW.Current();
-      TopoDS_Wire  Wire  = TopoDS::Wire(shapw);
-      loopo[k]           = NULL;
-      senses[k]          = -1;
-      if (Wire.IsSame(oWire)) senses[k] = 1;
-      int lp = body->loops.map.FindIndex(Wire);
-      if (lp != 0) {
-        loopo[k] = body->loops.objs[lp-1];
-        EG_fillPCurves(Face, geom, loopo[k], topObj);
-        EG_referenceObject(loopo[k], obj);
-      } else {
-        printf(" EGADS Warning: Loop not found for Face!\n");
-      }
-      if (outLevel > 2)
-        printf("        %d  loop = %d     outer = %d\n", k, lp, senses[k]);
-      k++;
-    }
-    pface->face    = Face;
-    pface->surface = geom;
-    pface->nloops  = nl;
-    pface->loops   = loopo;
-    pface->senses  = senses;
-    pface->topFlg  = 0;
-    obj->blind     = pface;
-    obj->topObj    = topObj;
-    obj->mtype     = SFORWARD;
-    if (Face.Orientation() == TopAbs_REVERSED) obj->mtype = SREVERSE;
-    if (bobj->mtype == FACEBODY) EG_referenceObject(obj, bobj);
-  }
-  
   if (nShell > 0) {
-    TopoDS_Shell oShell;
     if (solid == 1) {
-      TopoDS_Solid Solid = TopoDS::Solid(body->shape);
-      oShell = BRepTools::OuterShell(Solid);
+      TopoDS_Solid Solid  = TopoDS::Solid(body->shape);
+      TopoDS_Shell oShell = BRepTools::OuterShell(Solid);
       body->senses = new int[nShell];
-    }
-
-    for (j = 0; j < nShell; j++) {
-      egObject   **faceo = NULL;
-      egadsShell *pshell = new egadsShell;
-      obj                = body->shells.objs[j];
-      shape              = body->shells.map(j+1);
-      obj->oclass        = SHELL;
-      TopoDS_Shell Shell = TopoDS::Shell(shape);
-      if (solid == 1) {
+      for (j = 0; j < nShell; j++) {
+        TopoDS_Shell Shell = TopoDS::Shell(body->shells.map(j+1));
         body->senses[j] = -1;
         if (Shell.IsSame(oShell)) body->senses[j] = 1;
       }
-
-      int nf = 0;
-      TopExp_Explorer ExpF;
-      for (ExpF.Init(shape, TopAbs_FACE); ExpF.More(); ExpF.Next()) nf++;
-      
-      if (nf > 0) faceo = new egObject*[nf];
-
-      k = 0;
-      for (ExpF.Init(shape, TopAbs_FACE); ExpF.More(); ExpF.Next()) {
-        TopoDS_Shape shapf = ExpF.Current();
-        TopoDS_Face  Face  = TopoDS::Face(shapf);
-        faceo[k]           = NULL;
-        int fa = body->faces.map.FindIndex(Face);
-        if (fa != 0) {
-          faceo[k] = body->faces.objs[fa-1];
-          EG_referenceObject(faceo[k], obj);
-        } else {
-          printf(" EGADS Warning: Face not found for Shell!\n");
-        }
-        if (outLevel > 2)
-          printf(" Shell %d/%d: Face = %d\n", k, j+1, fa);
-        k++;
-      }
-      pshell->shell  = Shell;
-      pshell->nfaces = nf;
-      pshell->faces  = faceo;
-      pshell->topFlg = 0;
-      obj->blind     = pshell;
-      obj->topObj    = topObj;
-      obj->mtype     = EG_shellClosure(pshell, 0);
-      if (bobj->mtype >= SHEETBODY) EG_referenceObject(obj, bobj);
     }
   }
+  if (lazy == 1) return EGADS_SUCCESS;
+
+  // fill our stuff
+
+  for (j = 0; j < nNode; j++)  EG_fillNode(context,  bobj, topObj, body, j);
+  for (j = 0; j < nEdge; j++)  EG_fillEdge(context,  bobj, topObj, body, j);
+  for (j = 0; j < nLoop; j++)  EG_fillLoop(context,  bobj, topObj, body, j);
+  for (j = 0; j < nFace; j++)  EG_fillFace(context,  bobj, topObj, body, j);
+  for (j = 0; j < nShell; j++) EG_fillShell(context, bobj, topObj, body, j);
 
   return EGADS_SUCCESS;
 }
 
 
+int
+EG_traverseBody(egObject *context, int i, egObject *bobj,
+                egObject *topObj, egadsBody *body)
+{
+  return EG_traverse(context, i, bobj, topObj, body, 0);
+}
+
+
+int
+EG_traverseLazy(egObject *context, int i, egObject *bobj,
+                egObject *topObj, egadsBody *body)
+{
+  return EG_traverse(context, i, bobj, topObj, body, 1);
+}
+
+
 int
 EG_getTolerance(const egObject *topo, double *tol)
 {
@@ -1169,18 +1530,27 @@ EG_getTopology(const egObject *topo, egObject **geom, int *oclass,
   } else if (topo->oclass == BODY) {
   
     egadsBody *pbody = (egadsBody *) topo->blind;
-    if (pbody != NULL)
+    if (pbody != NULL) {
+      int cls;
       if (topo->mtype == WIREBODY) {
         *nChildren = pbody->loops.map.Extent();
         *children  = pbody->loops.objs;
+        cls        = LOOP;
       } else if (topo->mtype == FACEBODY) {
         *nChildren = pbody->faces.map.Extent();
         *children  = pbody->faces.objs;
+        cls        = FACE;
       } else {
         *nChildren = pbody->shells.map.Extent();
         *children  = pbody->shells.objs;
+        cls        = SHELL;
         if (topo->mtype == SOLIDBODY) *senses = pbody->senses;
       }
+      // lazy Bodies -- fill the children before they are seen
+      if (pbody->lazy == 1)
+        for (int i = 0; i < *nChildren; i++)
+          EG_fillBodyObj((egObject *) topo, cls, i);
+    }
     
   } else {
   
@@ -1333,7 +1703,7 @@ EG_makeTopology(egObject *context, /*@null@*/ egObject *geom,
         printf(" EGADS Error: Cannot make Node object (EG_makeTopology)!\n");
       return stat;
     }        
-    egadsNode *pnode   = new egadsNode;
+    egadsNode *pnode   = new (context) egadsNode;
     pnode->node        = vert;
     pnode->xyz[0]      = limits[0];
     pnode->xyz[1]      = limits[1];
@@ -1409,7 +1779,7 @@ EG_makeTopology(egObject *context, /*@null@*/ egObject *geom,
           printf(" EGADS Error: Cannot make Degen Edge object (EG_makeTopology)!\n");
         return stat;
       }
-      egadsEdge *pedge = new egadsEdge;
+      egadsEdge *pedge = new (context) egadsEdge;
       pedge->edge      = Edge;
       pedge->curve     = NULL;
       pedge->nodes[0]  = children[0];
@@ -1545,7 +1915,7 @@ EG_makeTopology(egObject *context, /*@null@*/ egObject *geom,
         printf(" EGADS Error: Cannot make Edge object (EG_makeTopology)!\n");
       return stat;
     }
-    egadsEdge *pedge = new egadsEdge;
+    egadsEdge *pedge = new (context) egadsEdge;
     pedge->edge      = Edge;
     pedge->curve     = geom;
     pedge->nodes[0]  = children[0];
@@ -1703,7 +2073,7 @@ EG_makeTopology(egObject *context, /*@null@*/ egObject *geom,
     }
     obj->oclass = LOOP;
 
-    egadsLoop *ploop  = new egadsLoop;
+    egadsLoop *ploop  = new (context) egadsLoop;
     egObject  **edgeo = new egObject*[n*nChildren];
     int       *esense = new int[nChildren];
     int       closed  = 0;
@@ -1899,7 +2269,7 @@ EG_makeTopology(egObject *context, /*@null@*/ egObject *geom,
     }
     obj->oclass = FACE;
 
-    egadsFace *pface = new egadsFace;
+    egadsFace *pface = new (context) egadsFace;
     egObject **loopo = new egObject*[nChildren];
     int      *lsense = new int[nChildren];
     for (i = 0; i < nChildren; i++) {
@@ -1975,7 +2345,7 @@ EG_makeTopology(egObject *context, /*@null@*/ egObject *geom,
     }
    obj->oclass = SHELL;
 
-    egadsShell *pshell = new egadsShell;
+    egadsShell *pshell = new (context) egadsShell;
     egObject   **faceo = new egObject*[nChildren];
     for (i = 0; i < nChildren; i++) {
       faceo[i] = children[i];
@@ -2413,7 +2783,7 @@ EG_makeFace(egObject *object, int mtype,
         return stat;
       }
       loop->oclass      = LOOP;
-      egadsLoop *ploop  = new egadsLoop;
+      egadsLoop *ploop  = new (context) egadsLoop;
       loop->blind       = ploop;
       ploop->loop       = Wire;
       ploop->nedges     = 0;
@@ -2503,7 +2873,7 @@ EG_makeFace(egObject *object, int mtype,
 
   }
   
-  egadsFace *pface = new egadsFace;
+  egadsFace *pface = new (context) egadsFace;
   egObject **loopo = new egObject*[nl];
   int *senses      = new int[nl];
   loopo[0]         = loop;
@@ -2526,6 +2896,50 @@ EG_makeFace(egObject *object, int mtype,
 }
 
 
+/* the index of src when it is one of body's own egos (0 otherwise) --
+ *     the cached index is only trusted when the map entry is src itself */
+
+static int
+EG_ownedIndex(const egObject *body, egadsBody *pbody, const egObject *src)
+{
+  int      index;
+  egadsMap *map;
+  egObject *model = body->topObj;
+
+  if (src->topObj != body) {
+    if (model == NULL)           return 0;
+    if (model->oclass != MODEL)  return 0;
+    if (src->topObj   != model)  return 0;
+  }
+
+  if (src->oclass == NODE) {
+    egadsNode *pnode = (egadsNode *) src->blind;
+    index = pnode->bIndex;
+    map   = &pbody->nodes;
+  } else if (src->oclass == EDGE) {
+    egadsEdge *pedge = (egadsEdge *) src->blind;
+    index = pedge->bIndex;
+    map   = &pbody->edges;
+  } else if (src->oclass == LOOP) {
+    egadsLoop *ploop = (egadsLoop *) src->blind;
+    index = ploop->bIndex;
+    map   = &pbody->loops;
+  } else if (src->oclass == FACE) {
+    egadsFace *pface = (egadsFace *) src->blind;
+    index = pface->bIndex;
+    map   = &pbody->faces;
+  } else {
+    egadsShell *pshell = (egadsShell *) src->blind;
+    index = pshell->bIndex;
+    map   = &pbody->shells;
+  }
+  if ((index < 1) || (index > map->map.Extent())) return 0;
+  if (map->objs[index-1] != src)                   return 0;
+
+  return index;
+}
+
+
 int
 EG_getBodyTopos(const egObject *body, /*@null@*/ egObject *src,
                 int oclass, int *ntopo, egObject ***topos)
@@ -2549,6 +2963,7 @@ EG_getBodyTopos(const egObject *body, /*@null@*/ egObject *src,
     return EGADS_NOTTOPO;
   }
 
+  egObject  *bobj  = (egObject *) body;
   egadsBody *pbody = (egadsBody *) body->blind;
   if (oclass == NODE) {
     map = &pbody->nodes;
@@ -2573,7 +2988,10 @@ EG_getBodyTopos(const egObject *body, /*@null@*/ egObject *src,
                oclass, n);
       return EGADS_MALLOC;
     }
-    for (i = 0; i < n; i++) objs[i] = map->objs[i];
+    for (i = 0; i < n; i++) {
+      if (pbody->lazy == 1) EG_fillBodyObj(bobj, oclass, i);
+      objs[i] = map->objs[i];
+    }
 
   } else {
 
@@ -2661,13 +3079,48 @@ EG_getBodyTopos(const egObject *body, /*@null@*/ egObject *src,
             printf(" EGADS Warning: %d/%d NotFound oclass = %d (EG_getBodyTopos)!\n", 
                    i+1, n, oclass);
         } else {
+          if (pbody->lazy == 1) EG_fillBodyObj(bobj, oclass, index-1);
           objs[i] = map->objs[index-1];
         }
       }
       
     } else {
   
-      // look up (get super-shapes)
+      // look up (get super-shapes) -- use the ancestor tables
+      egadsMap *amap;
+      if (src->oclass == NODE) {
+        amap = &pbody->nodes;
+      } else if (src->oclass == EDGE) {
+        amap = &pbody->edges;
+      } else if (src->oclass == LOOP) {
+        amap = &pbody->loops;
+      } else {
+        amap = &pbody->faces;
+      }
+      int *ancs = amap->ancs[oclass-EDGE];
+      if (ancs != NULL) {
+        index = EG_ownedIndex(body, pbody, src);
+        if (index == 0) index = amap->map.FindIndex(shape);
+        if (index == 0) return EGADS_SUCCESS;
+        int  nm   = amap->map.Extent();
+        int *list = &ancs[nm+1+ancs[index-1]];
+        n = ancs[index] - ancs[index-1];
+        if (n == 0) return EGADS_SUCCESS;
+        objs = (egObject **) EG_alloc(n*sizeof(egObject *));
+        if (objs == NULL) {
+          if (outLevel > 0)
+            printf(" EGADS Error: Malloc oclass = %d, N = %d (EG_getBodyTopos)!\n", 
+                   oclass, n);
+          return EGADS_MALLOC;
+        }
+        for (i = 0; i < n; i++) {
+          if (pbody->lazy == 1) EG_fillBodyObj(bobj, oclass, list[i]);
+          objs[i] = map->objs[list[i]];
+        }
+        *ntopo = n;
+        *topos = objs;
+        return EGADS_SUCCESS;
+      }
       for (n = i = 0; i < map->map.Extent(); i++) {
         TopoDS_Shape shapo = map->map(i+1);
         TopTools_IndexedMapOfShape smap;
@@ -2687,6 +3140,7 @@ EG_getBodyTopos(const egObject *body, /*@null@*/ egObject *src,
         TopTools_IndexedMapOfShape smap;
         TopExp::MapShapes(shapo, senum, smap);
         if (smap.FindIndex(shape) != 0) {
+          if (pbody->lazy == 1) EG_fillBodyObj(bobj, oclass, i);
           objs[n] = map->objs[i];
           n++;
         }
@@ -2722,11 +3176,6 @@ EG_indexBodyTopo(const egObject *body, const egObject *src)
       printf(" EGADS Error: src not a Topo (EG_indexBodyTopo)!\n");
     return EGADS_NOTTOPO;
   }
-  if (EG_context(body) != EG_context(src)) {
-    if (outLevel > 0)
-      printf(" EGADS Error: Context mismatch (EG_indexBodyTopo)!\n");
-    return EGADS_MIXCNTX;
-  }
   if (src->blind == NULL) {
     if (outLevel > 0)
       printf(" EGADS Error: NULL src pointer (EG_indexBodyTopo)!\n");
@@ -2734,6 +3183,14 @@ EG_indexBodyTopo(const egObject *body, const egObject *src)
   }
 
   egadsBody *pbody = (egadsBody *) body->blind;
+  index = EG_ownedIndex(body, pbody, src);
+  if (index != 0) return index;
+
+  if (EG_context(body) != EG_context(src)) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Context mismatch (EG_indexBodyTopo)!\n");
+    return EGADS_MIXCNTX;
+  }
   if (src->oclass == NODE) {
     egadsNode *pnode = (egadsNode *) src->blind;
     index = pbody->nodes.map.FindIndex(pnode->node);
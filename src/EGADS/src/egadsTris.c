@@ -10,6 +10,7 @@
  */
  
 #include "egads.h"
+#include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <float.h>      /* Needed in some systems for DBL_MAX definition */
@@ -18,6 +19,7 @@
 
 
 #define FLOODEPTH        6	/* flood depth for marking tri neighbors */
+#define MAXWALK        128      /* bound on tris within 5 neighbors */
 #define NOTFILLED       -1      /* Not yet filled flag */
 #define TOBEFILLED      -2
 #define PI              3.14159265358979323846
@@ -39,22 +41,16 @@
 
 
 /*
- * table of primes just below 2^n, n=2..31 for use in finding the right prime
- * number to be the table size.
+ * reference triangle side definition
  */
 
-  static unsigned int primetab[] = { 127, 251, 509, 1021, 2039, 4093, 8191, 
-                                     16381, 32749, 65521, 131071, 262139, 
-                                     524287, 1048573, 2097143, 4194301, 
-                                     8388593, 16777213, 33554393,
-                                     67108859, 134217689, 268435399, 
-                                     536870909, 1073741789, 2147483647 };
+  static int sides[3][2] = {1,2, 2,0, 0,1};
 
 /*
- * reference triangle side definition
+ * side vertex order used when checking bounding sides
  */
 
-  static int sides[3][2] = {1,2, 2,0, 0,1};
+  static int bsides[3][2] = {{1,2}, {0,2}, {0,1}};
 
 
 
@@ -117,73 +113,103 @@ EG_checkTess(triStruct *ts)
 #endif
 
 
-/* simple hash function based on mod of number of elems in hash table */
+/* hashit --- mix the sorted vertex indices into a table slot */
 
-static int 
-EG_hashit(KEY key, triStruct *ts)
+static unsigned int
+EG_hashMix(unsigned int h)
 {
-  return (key.keys[0]+key.keys[1]+key.keys[2]) % ts->numElem;
+  h ^= h >> 16;
+  h *= 0x85ebca6bU;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35U;
+  h ^= h >> 16;
+  return h;
 }
 
 
-/* idestroy --- destroy a single element on a chain */
-
-static void
-EG_idestroy(/*@null@*/ ELEMENT *elem)
+static int 
+EG_hashit(KEY key, int hashSize)
 {
-  if (elem != NULL) {
-    EG_idestroy(elem->next);
-    EG_free(elem);
-  }
+  unsigned int h;
+
+  h = EG_hashMix((unsigned int) key.keys[0]);
+  h = EG_hashMix(h ^ (unsigned int) key.keys[1]);
+  h = EG_hashMix(h ^ (unsigned int) key.keys[2]);
+  return (int) (h & (unsigned int) (hashSize-1));
 }
 
 
-/* hdestroy --- nuke the existing hash table */
+/* hdestroy --- retire the existing hash table (storage is kept for reuse) */
 
 static void 
 EG_hdestroy(triStruct *ts)
 {
-  int i;
-
-  if (ts->hashTab != NULL) {
-    /* free all the chains */
-    for (i = 0; i < ts->numElem; i++) EG_idestroy(ts->hashTab[i]);
-
-    /* now the table itself */
-    EG_free(ts->hashTab);
-    ts->numElem = -1;
-    ts->hashTab = NULL;
-  }
+  ts->numElem = -1;
 }
 
 
-/* hcreate --- create a hash table at least how_many big */
+/* hcreate --- open an empty hash table at least how_many big */
 
 static int 
 EG_hcreate(int how_many, triStruct *ts)
 {
-  int i, j;
+  int   i, n;
+  ENTRY *tab;
 
-  /*
-   * find first prime number >= how_many, and use it for table size
-   */
+  /* size for a load factor of at most 1/2 */
+  for (n = CHUNK; n < 2*how_many; n *= 2);
 
-  if (ts->numElem != -1)	/* already a table out there */
-    EG_hdestroy(ts);		/* remove it */
-  
-  j = sizeof(primetab) / sizeof(primetab[0]);
-  for (i = 0; i < j; i++) if (primetab[i] >= how_many) break;
-  
-  if (i >= j)		/* how_many bigger than any prime we have, use it */
-    ts->numElem = how_many;
-  else
-    ts->numElem = primetab[i];
+  if ((ts->hashTab == NULL) || (ts->hashSize < n)) {
+    tab = (ENTRY *) EG_alloc(n*sizeof(ENTRY));
+    if (tab == NULL) {
+      ts->numElem = -1;
+      return 0;
+    }
+    if (ts->hashTab != NULL) EG_free(ts->hashTab);
+    for (i = 0; i < n; i++) tab[i].stamp = 0;
+    ts->hashTab  = tab;
+    ts->hashSize = n;
+    ts->stamp    = 0;
+  }
 
-  if ((ts->hashTab = (ELEMENT **) EG_calloc(ts->numElem, 
-                                            sizeof(ELEMENT *))) == NULL)
-    return 0;
-  else
-    return 1;
+  /* a new generation empties the table without touching it */
+  ts->stamp++;
+  if (ts->stamp <= 0) {
+    for (i = 0; i < ts->hashSize; i++) ts->hashTab[i].stamp = 0;
+    ts->stamp = 1;
+  }
+  ts->numElem = 0;
+
+  return 1;
+}
+
+
+/* hgrow --- double the table & reinsert the current entries */
+
+static int 
+EG_hgrow(triStruct *ts)
+{
+  int   i, n, hindex;
+  ENTRY *tab;
+
+  n   = 2*ts->hashSize;
+  tab = (ENTRY *) EG_alloc(n*sizeof(ENTRY));
+  if (tab == NULL) return EGADS_MALLOC;
+  for (i = 0; i < n; i++) tab[i].stamp = 0;
+
+  for (i = 0; i < ts->hashSize; i++) {
+    if (ts->hashTab[i].stamp != ts->stamp) continue;
+    hindex = EG_hashit(ts->hashTab[i].key, n);
+    while (tab[hindex].stamp != 0) hindex = (hindex+1) & (n-1);
+    tab[hindex]       = ts->hashTab[i];
+    tab[hindex].stamp = 1;
+  }
+  EG_free(ts->hashTab);
+  ts->hashTab  = tab;
+  ts->hashSize = n;
+  ts->stamp    = 1;
+
+  return EGADS_SUCCESS;
 }
 
 
@@ -206,26 +232,25 @@ EG_hmakeKEY(int i0, int i1, int i2)
 static int 
 EG_hfind(int i0, int i1, int i2, int *close, double *xyz, triStruct *ts)
 {
-  ELEMENT *ep;
-  ENTRY   entry;
-  int     hindex;
-
-  if (ts->hashTab == NULL) return NOTFILLED;
-
-  entry.key = EG_hmakeKEY(i0, i1, i2);
-  hindex    = EG_hashit(entry.key, ts);
-
-  if (ts->hashTab[hindex] == NULL) return NOTFILLED;
-
-  for (ep = ts->hashTab[hindex]; ep != NULL; ep = ep->next)
-    if ((ep->item.key.keys[0] == entry.key.keys[0]) &&
-        (ep->item.key.keys[1] == entry.key.keys[1]) && 
-        (ep->item.key.keys[2] == entry.key.keys[2])) {
-       /* ...yes,its on the chain */
-      *close = ep->item.data.close;
-      xyz[0] = ep->item.data.xyz[0];
-      xyz[1] = ep->item.data.xyz[1];
-      xyz[2] = ep->item.data.xyz[2];
+  KEY   key;
+  ENTRY *ep;
+  int   hindex;
+
+  if (ts->numElem < 0) return NOTFILLED;
+
+  key    = EG_hmakeKEY(i0, i1, i2);
+  hindex = EG_hashit(key, ts->hashSize);
+
+  /* linear probe until an empty slot */
+  for (ep = &ts->hashTab[hindex]; ep->stamp == ts->stamp; 
+       hindex = (hindex+1) & (ts->hashSize-1), ep = &ts->hashTab[hindex])
+    if ((ep->key.keys[0] == key.keys[0]) &&
+        (ep->key.keys[1] == key.keys[1]) && 
+        (ep->key.keys[2] == key.keys[2])) {
+      *close = ep->data.close;
+      xyz[0] = ep->data.xyz[0];
+      xyz[1] = ep->data.xyz[1];
+      xyz[2] = ep->data.xyz[2];
       return 0;
     }
 
@@ -238,50 +263,143 @@ EG_hfind(int i0, int i1, int i2, int *close, double *xyz, triStruct *ts)
 static int 
 EG_hadd(int i0, int i1, int i2, int close, double *xyz, triStruct *ts)
 {
-  ELEMENT e, *ep = NULL, *ep2 = NULL;
-  ENTRY   entry;
-  int     hindex;
-
-  if (ts->hashTab == NULL) return NOTFILLED;
-
-  entry.key         = EG_hmakeKEY(i0, i1, i2);
-  entry.data.close  = close;
-  entry.data.xyz[0] = xyz[0];
-  entry.data.xyz[1] = xyz[1];
-  entry.data.xyz[2] = xyz[2];
-  hindex            = EG_hashit(entry.key, ts);
-
-  if (ts->hashTab[hindex] == NULL) {	/* nothing there */
-    /* add it to the table */
-    e.item = entry;
-    e.next = NULL;
-    if ((ts->hashTab[hindex] = (ELEMENT *) EG_calloc(1, sizeof(ELEMENT))) == NULL)
-      return NOTFILLED;
-    *ts->hashTab[hindex] = e;
-    return 0;
-  } else {
-    /* something in bucket, see if already on chain */
-    for (ep = ts->hashTab[hindex]; ep != NULL; ep = ep->next)
-      if ((ep->item.key.keys[0] == entry.key.keys[0]) &&
-          (ep->item.key.keys[1] == entry.key.keys[1]) && 
-          (ep->item.key.keys[2] == entry.key.keys[2])) {
-        /* ...yes, its on the chain */
-        return 1;		/* indicate found */
-      } else {
-        ep2 = ep;
-      }
+  KEY   key;
+  ENTRY *ep;
+  int   hindex;
+
+  if (ts->numElem < 0) return NOTFILLED;
+  if (2*(ts->numElem+1) > ts->hashSize)
+    if (EG_hgrow(ts) != EGADS_SUCCESS) return NOTFILLED;
+
+  key    = EG_hmakeKEY(i0, i1, i2);
+  hindex = EG_hashit(key, ts->hashSize);
+
+  for (ep = &ts->hashTab[hindex]; ep->stamp == ts->stamp; 
+       hindex = (hindex+1) & (ts->hashSize-1), ep = &ts->hashTab[hindex])
+    if ((ep->key.keys[0] == key.keys[0]) &&
+        (ep->key.keys[1] == key.keys[1]) && 
+        (ep->key.keys[2] == key.keys[2])) return 1;	/* indicate found */
+
+  /* at this point, item was not in table -- ep is the empty slot */
+  ep->key         = key;
+  ep->data.close  = close;
+  ep->data.xyz[0] = xyz[0];
+  ep->data.xyz[1] = xyz[1];
+  ep->data.xyz[2] = xyz[2];
+  ep->stamp       = ts->stamp;
+  ts->numElem++;
 
-    /* at this point, item was not in table */
-    /* ep2 points at last element on the list */
-    if ((ep2->next = (ELEMENT *) EG_calloc(1, sizeof(ELEMENT))) == NULL)
-        return NOTFILLED;
-    ep2->next->item = entry;
-    ep2->next->next = NULL;
-    return 0;
+  return 0;
+}
+
+
+/* ehash --- mix the bits of a UV pair into a cache slot */
+
+static int
+EG_ehash(const double *uv, int evalSize)
+{
+  unsigned int h, bits[4];
+
+  memcpy(bits, uv, 2*sizeof(double));
+  h = EG_hashMix(bits[0]);
+  h = EG_hashMix(h ^ bits[1]);
+  h = EG_hashMix(h ^ bits[2]);
+  h = EG_hashMix(h ^ bits[3]);
+  return (int) (h & (unsigned int) (evalSize-1));
+}
+
+
+/* eclear --- empty the evaluation cache for a new Face */
+
+static void
+EG_eclear(triStruct *ts)
+{
+  int i;
+
+  ts->numEval = 0;
+  ts->nEvals  = 0;
+  ts->nHits   = 0;
+  if (ts->evalTab == NULL) return;
+  ts->evalStamp++;
+  if (ts->evalStamp <= 0) {
+    for (i = 0; i < ts->evalSize; i++) ts->evalTab[i].stamp = 0;
+    ts->evalStamp = 1;
   }
 }
 
 
+/* egrow --- get (or double) the cache & reinsert the current entries */
+
+static int
+EG_egrow(triStruct *ts)
+{
+  int  i, n, hindex;
+  EVAL *tab;
+
+  n = 2*ts->evalSize;
+  if (n < CHUNK) n = CHUNK;
+  tab = (EVAL *) EG_alloc(n*sizeof(EVAL));
+  if (tab == NULL) return EGADS_MALLOC;
+  for (i = 0; i < n; i++) tab[i].stamp = 0;
+
+  if (ts->evalTab != NULL) {
+    for (i = 0; i < ts->evalSize; i++) {
+      if (ts->evalTab[i].stamp != ts->evalStamp) continue;
+      hindex = EG_ehash(ts->evalTab[i].uv, n);
+      while (tab[hindex].stamp != 0) hindex = (hindex+1) & (n-1);
+      tab[hindex]       = ts->evalTab[i];
+      tab[hindex].stamp = 1;
+    }
+    EG_free(ts->evalTab);
+  }
+  ts->evalTab   = tab;
+  ts->evalSize  = n;
+  ts->evalStamp = 1;
+
+  return EGADS_SUCCESS;
+}
+
+
+/* evalFace --- EG_evaluate on the Face through the cache
+ *              only the position & first derivatives are returned */
+
+static int
+EG_evalFace(triStruct *ts, double *uv, double *result)
+{
+  int  i, hindex, stat;
+  EVAL *ep;
+
+  ts->nEvals++;
+  if (ts->evalTab != NULL) {
+    hindex = EG_ehash(uv, ts->evalSize);
+    for (ep = &ts->evalTab[hindex]; ep->stamp == ts->evalStamp;
+         hindex = (hindex+1) & (ts->evalSize-1), ep = &ts->evalTab[hindex])
+      if (memcmp(ep->uv, uv, 2*sizeof(double)) == 0) {
+        for (i = 0; i < 9; i++) result[i] = ep->result[i];
+        ts->nHits++;
+        return EGADS_SUCCESS;
+      }
+  }
+
+  stat = EG_evaluate(ts->face, uv, result);
+  if (stat != EGADS_SUCCESS) return stat;
+
+  /* remember it -- a full cache is not an error */
+  if (2*(ts->numEval+1) > ts->evalSize)
+    if (EG_egrow(ts) != EGADS_SUCCESS) return EGADS_SUCCESS;
+  hindex = EG_ehash(uv, ts->evalSize);
+  for (ep = &ts->evalTab[hindex]; ep->stamp == ts->evalStamp;
+       hindex = (hindex+1) & (ts->evalSize-1), ep = &ts->evalTab[hindex]);
+  ep->uv[0] = uv[0];
+  ep->uv[1] = uv[1];
+  for (i = 0; i < 9; i++) ep->result[i] = result[i];
+  ep->stamp = ts->evalStamp;
+  ts->numEval++;
+
+  return EGADS_SUCCESS;
+}
+
+
 static double
 EG_getIntersect(double *pt0, double *pt1, double *pt2)
 {
@@ -334,70 +452,6 @@ EG_getIntersect(double *pt0, double *pt1, double *pt2)
 }
 
 
-static int
-EG_recClose2Edge(int t0, double *xyz, int depth, triStruct *ts)
-{
-  int    i0, i1, i2, tn;
-  double dist;
-
-  if (depth <= 0) return 0;
-
-  i0 = ts->tris[t0].indices[0]-1;
-  i1 = ts->tris[t0].indices[1]-1;
-  i2 = ts->tris[t0].indices[2]-1;
-
-  tn = ts->tris[t0].neighbors[0];
-  if (tn <= 0) {
-    if ((dist = EG_getIntersect(ts->verts[i1].xyz, ts->verts[i2].xyz, xyz)) < 
-        ts->edist2) {
-#ifdef DEBUG
-      printf(" dist = %le, edist = %le\n", dist, ts->edist2);
-#endif
-      return 1;
-    }
-  } else {
-    if (EG_recClose2Edge(tn-1, xyz, depth-1, ts) == 1) return 1;
-  }
-
-  tn = ts->tris[t0].neighbors[1];
-  if (tn <= 0) {
-    if (EG_getIntersect(ts->verts[i0].xyz, ts->verts[i2].xyz, xyz) < 
-        ts->edist2) {
-#ifdef DEBUG
-      printf(" dist = %le, edist = %le\n", dist, ts->edist2);
-#endif
-      return 1;
-    }
-  } else {
-    if (EG_recClose2Edge(tn-1, xyz, depth-1, ts) == 1) return 1;
-  }
-
-  tn = ts->tris[t0].neighbors[2];
-  if (tn <= 0) {
-    if (EG_getIntersect(ts->verts[i0].xyz, ts->verts[i1].xyz, xyz) < 
-        ts->edist2) {
-#ifdef DEBUG
-      printf(" dist = %le, edist = %le\n", dist, ts->edist2);
-#endif
-      return 1;
-    }
-  } else {
-    if (EG_recClose2Edge(tn-1, xyz, depth-1, ts) == 1) return 1;
-  }
-
-  return 0;
-}
-
-
-static int
-EG_close2Edge(int t0, double *xyz, triStruct *ts)
-{
-  /* look down as many as 6 neighbors for an edge */
-
-  return EG_recClose2Edge(t0, xyz, 6, ts);
-}
-
-
 static double
 EG_rayIntersect(double *pt0, double *pt1, double *pt2)
 {
@@ -435,41 +489,60 @@ EG_rayIntersect(double *pt0, double *pt1, double *pt2)
 
 
 static int
-EG_recCloseEdge(int t0, double *xyz, int depth, triStruct *ts)
+EG_walkEdge(int t0, double *xyz, int depth, int ray, triStruct *ts)
 {
-  int i0, i1, i2, tn;
-
-  if (depth <= 0) return 0;
+  int    i, j, k, n, t, tn, i1, i2, end, walk[MAXWALK];
+  double dist;
 
-  i0 = ts->tris[t0].indices[0]-1;
-  i1 = ts->tris[t0].indices[1]-1;
-  i2 = ts->tris[t0].indices[2]-1;
+  /* breadth-first over the tris within depth-1 neighbors of t0 -- each tri
+     is looked at once (the recursive walk revisited the same tris) */
 
-  tn = ts->tris[t0].neighbors[0];
-  if (tn <= 0) {
-    if (EG_rayIntersect(ts->verts[i1].xyz, ts->verts[i2].xyz, xyz) < 0.125)
-      return 1;
-  } else {
-    if (EG_recCloseEdge(tn-1, xyz, depth-1, ts) == 1) return 1;
+  walk[0] = t0;
+  n       = 1;
+  for (i = 0; i < n; depth--) {
+    if (depth <= 0) break;
+    end = n;
+    for (; i < end; i++) {
+      t = walk[i];
+      for (j = 0; j < 3; j++) {
+        tn = ts->tris[t].neighbors[j];
+        if (tn <= 0) {
+          i1 = ts->tris[t].indices[bsides[j][0]]-1;
+          i2 = ts->tris[t].indices[bsides[j][1]]-1;
+          if (ray == 1) {
+            if (EG_rayIntersect(ts->verts[i1].xyz, ts->verts[i2].xyz,
+                                xyz) < 0.125) return 1;
+          } else {
+            dist = EG_getIntersect(ts->verts[i1].xyz, ts->verts[i2].xyz, xyz);
+            if (dist < ts->edist2) {
+#ifdef DEBUG
+              printf(" dist = %le, edist = %le\n", dist, ts->edist2);
+#endif
+              return 1;
+            }
+          }
+        } else {
+          if (depth <= 1) continue;
+          for (k = 0; k < n; k++)
+            if (walk[k] == tn-1) break;
+          if ((k < n) || (n >= MAXWALK)) continue;
+          walk[n] = tn-1;
+          n++;
+        }
+      }
+    }
   }
 
-  tn = ts->tris[t0].neighbors[1];
-  if (tn <= 0) {
-    if (EG_rayIntersect(ts->verts[i0].xyz, ts->verts[i2].xyz, xyz) < 0.125)
-      return 1;
-  } else {
-    if (EG_recCloseEdge(tn-1, xyz, depth-1, ts) == 1) return 1;
-  }
+  return 0;
+}
 
-  tn = ts->tris[t0].neighbors[2];
-  if (tn <= 0) {
-    if (EG_rayIntersect(ts->verts[i0].xyz, ts->verts[i1].xyz, xyz) < 0.125)
-      return 1;
-  } else {
-    if (EG_recCloseEdge(tn-1, xyz, depth-1, ts) == 1) return 1;
-  }
 
-  return 0;
+static int
+EG_close2Edge(int t0, double *xyz, triStruct *ts)
+{
+  /* look down as many as 6 neighbors for an edge */
+
+  return EG_walkEdge(t0, xyz, 6, 0, ts);
 }
 
 
@@ -478,7 +551,7 @@ EG_closeEdge(int t0, double *xyz, triStruct *ts)
 {
   /* look down as many as 4 neighbors for an edge */
 
-  return EG_recCloseEdge(t0, xyz, 4, ts);
+  return EG_walkEdge(t0, xyz, 4, 1, ts);
 }
 
 
@@ -898,13 +971,13 @@ EG_fillMid(int t1, int close, triStruct *ts)
            ts->verts[i2].uv[0]) / 3.0;
   uv[1] = (ts->verts[i0].uv[1] + ts->verts[i1].uv[1] +
            ts->verts[i2].uv[1]) / 3.0;
-  if (EG_evaluate(ts->face, uv, result) != EGADS_SUCCESS) return;
+  if (EG_evalFace(ts, uv, result) != EGADS_SUCCESS) return;
 
-  ts->tris[t1].mid[0] = result[0];
-  ts->tris[t1].mid[1] = result[1];
-  ts->tris[t1].mid[2] = result[2];
+  ts->mids[t1].mid[0] = result[0];
+  ts->mids[t1].mid[1] = result[1];
+  ts->mids[t1].mid[2] = result[2];
   ts->tris[t1].close  = close;
-  if (close != 0) ts->tris[t1].close = EG_closeEdge(t1, ts->tris[t1].mid, ts);
+  if (close != 0) ts->tris[t1].close = EG_closeEdge(t1, ts->mids[t1].mid, ts);
 }
 
 
@@ -939,11 +1012,11 @@ EG_swapTris(int (*test)(int, int, int, triStruct *), /*@unused@*/ char *string,
           if (ts->tris[t1].close != TOBEFILLED) 
             EG_hadd(ts->tris[t1].indices[0], ts->tris[t1].indices[1],
                     ts->tris[t1].indices[2], ts->tris[t1].close,
-                    ts->tris[t1].mid, ts);
+                    ts->mids[t1].mid, ts);
           if (ts->tris[t2].close != TOBEFILLED) 
             EG_hadd(ts->tris[t2].indices[0], ts->tris[t2].indices[1],
                     ts->tris[t2].indices[2], ts->tris[t2].close,
-                    ts->tris[t2].mid, ts);
+                    ts->mids[t2].mid, ts);
         }
 
                                                 os = 0;
@@ -1077,6 +1150,7 @@ EG_collapsEdge(int node, int tnode, triStruct *ts)
   int     i, j, nt, *tin, t[2], in[2][2], t1, t2, nn;
   triVert save;
   triTri  hold;
+  triMid  mhold;
 
   /* is this a FACE node? */
 
@@ -1165,6 +1239,9 @@ EG_collapsEdge(int node, int tnode, triStruct *ts)
     hold           = ts->tris[t1];
     ts->tris[t1]   = ts->tris[t[0]];
     ts->tris[t[0]] = hold;
+    mhold          = ts->mids[t1];
+    ts->mids[t1]   = ts->mids[t[0]];
+    ts->mids[t[0]] = mhold;
     if (t[1] == t1) t[1] = t[0];
     for (i = 0; i < ts->ntris; i++)
       for (j = 0; j < 3; j++)
@@ -1179,6 +1256,9 @@ EG_collapsEdge(int node, int tnode, triStruct *ts)
     hold           = ts->tris[t2];
     ts->tris[t2]   = ts->tris[t[1]];
     ts->tris[t[1]] = hold;
+    mhold          = ts->mids[t2];
+    ts->mids[t2]   = ts->mids[t[1]];
+    ts->mids[t[1]] = mhold;
     for (i = 0; i < ts->ntris; i++)
       for (j = 0; j < 3; j++)
         if (ts->tris[i].neighbors[j] == t2+1) {
@@ -1241,10 +1321,14 @@ EG_splitTri(int t0, double *uv, double *point, triStruct *ts)
 {
   int    i, j, n, node, indices[3], neighbr[3], t1, t2, t[3];
   triTri *tmp;
+  triMid *mtmp;
 
   if (ts->ntris+1 >= ts->mtris) {
-    n   = ts->mtris + CHUNK;
-    tmp = (triTri *) EG_reall(ts->tris, n*sizeof(triTri));
+    n    = ts->mtris + CHUNK;
+    mtmp = (triMid *) EG_reall(ts->mids, n*sizeof(triMid));
+    if (mtmp == NULL) return EGADS_MALLOC;
+    ts->mids = mtmp;
+    tmp  = (triTri *) EG_reall(ts->tris, n*sizeof(triTri));
     if (tmp == NULL) return EGADS_MALLOC;
     ts->tris  = tmp;
     ts->mtris = n;
@@ -1332,10 +1416,14 @@ EG_splitSide(int t1, int side, int t2, int sideMid, triStruct *ts)
   int    i, j, n, node, status, t[4], i0, i1, i2, i3, n11, n12, n21, n22, os;
   double point[18], xyz[3], uv[2], d0, d1, d2;
   triTri *tmp;
+  triMid *mtmp;
 
   if (ts->ntris+1 >= ts->mtris) {
-    n   = ts->mtris + CHUNK;
-    tmp = (triTri *) EG_reall(ts->tris, n*sizeof(triTri));
+    n    = ts->mtris + CHUNK;
+    mtmp = (triMid *) EG_reall(ts->mids, n*sizeof(triMid));
+    if (mtmp == NULL) return EGADS_MALLOC;
+    ts->mids = mtmp;
+    tmp  = (triTri *) EG_reall(ts->tris, n*sizeof(triTri));
     if (tmp == NULL) return EGADS_MALLOC;
     ts->tris  = tmp;
     ts->mtris = n;
@@ -1361,7 +1449,7 @@ EG_splitSide(int t1, int side, int t2, int sideMid, triStruct *ts)
   } else {
     uv[0]  = 0.5*(ts->verts[i1-1].uv[0] + ts->verts[i2-1].uv[0]);
     uv[1]  = 0.5*(ts->verts[i1-1].uv[1] + ts->verts[i2-1].uv[1]);
-    status = EG_evaluate(ts->face, uv, point);
+    status = EG_evalFace(ts, uv, point);
   }
   if (status != EGADS_SUCCESS) return status;
 
@@ -1497,6 +1585,18 @@ EG_dotNorm(double *p0, double *p1, double *p2, double *p3)
 }
 
 
+static int
+EG_cmpTriKey(const void *a, const void *b)
+{
+  const triKey *ka = (const triKey *) a;
+  const triKey *kb = (const triKey *) b;
+
+  if (ka->key > kb->key) return -1;
+  if (ka->key < kb->key) return  1;
+  return ka->tri - kb->tri;
+}
+
+
 static void
 EG_floodTriGraph(int t, int depth, triStruct *ts)
 {
@@ -1517,8 +1617,9 @@ EG_floodTriGraph(int t, int depth, triStruct *ts)
 static int
 EG_breakTri(int mode, int stri, int *eg_split, triStruct *ts)
 {
-  int    i, j, side, i0, i1, i2, i3, t1, t2, split;
-  double uv[2], xyz[18], x1[3], x2[3], n[3], area, mina, dot;
+  int    i, j, k, side, i0, i1, i2, i3, t1, t2, split, ncand;
+  double uv[2], xyz[18], x1[3], x2[3], n[3], mina, dot;
+  triKey *cand;
 
   /* initialize area if new tessellation */
 
@@ -1538,8 +1639,8 @@ EG_breakTri(int mode, int stri, int *eg_split, triStruct *ts)
     x1[2] = ts->verts[i1].xyz[2] - ts->verts[i0].xyz[2];
     x2[2] = ts->verts[i2].xyz[2] - ts->verts[i0].xyz[2];
     CROSS(n, x1, x2);
-    ts->tris[i].area = DOT(n, n);
-    if (ts->tris[i].area == 0.0) continue;
+    ts->mids[i].area = DOT(n, n);
+    if (ts->mids[i].area == 0.0) continue;
 
     /* skip if more than 1 edge  or  dot of normals is OK (mode = -1) */
     dot  = 1.0;
@@ -1568,7 +1669,7 @@ EG_breakTri(int mode, int stri, int *eg_split, triStruct *ts)
       }
     if (j <= 1) continue;
     if (mode == -1)
-      if ((dot > -0.9) && (mina/ts->tris[i].area > 0.001)) continue;
+      if ((dot > -0.9) && (mina/ts->mids[i].area > 0.001)) continue;
 
     /* are we too small? */
     i0 = ts->tris[i].indices[0]-1;
@@ -1581,21 +1682,32 @@ EG_breakTri(int mode, int stri, int *eg_split, triStruct *ts)
     /* mark as OK */
     ts->tris[i].hit = 0;
   }
-  
-  do {
+
+  /* order the candidates by area -- the areas of unhit tris do not change
+     and split tris (and their neighbors) get flooded, so walking this list
+     is the same as repeatedly picking the largest remaining area */
+
+  cand = (triKey *) EG_alloc(ts->ntris*sizeof(triKey));
+  if (cand == NULL) {
+    printf(" EGADS Error: Malloc of %d Tris (EG_breakTri)!\n", ts->ntris);
+    return 0;
+  }
+  for (ncand = i = 0; i < ts->ntris; i++) {
+    if (ts->tris[i].hit != 0) continue;
+    if (!(ts->mids[i].area > 0.0)) continue;
+    cand[ncand].key  = ts->mids[i].area;
+    cand[ncand].tri  = i;
+    cand[ncand].side = 0;
+    ncand++;
+  }
+  qsort(cand, ncand, sizeof(triKey), EG_cmpTriKey);
+
+  for (k = 0; k < ncand; k++) {
 
     /* pick the largest area */
 
-    t1   = -1;
-    area = 0.0;
-    for (i = 0; i < ts->ntris; i++) {
-      if (ts->tris[i].hit != 0) continue;
-      if (ts->tris[i].area > area) {
-        t1   = i;
-        area = ts->tris[i].area;
-      }
-    }
-    if (t1 == -1) continue;
+    t1 = cand[k].tri;
+    if (ts->tris[t1].hit != 0) continue;
 
     /* are we a valid candidate? */
 
@@ -1614,7 +1726,7 @@ EG_breakTri(int mode, int stri, int *eg_split, triStruct *ts)
           ((ts->verts[i2].type == NODE) && (ts->verts[i2].edge == -1)))
         continue;
       if (EG_hfind(i0, i1, i2, &j, xyz, ts) == NOTFILLED) {
-        if (EG_evaluate(ts->face, uv, xyz) != EGADS_SUCCESS) continue;
+        if (EG_evalFace(ts, uv, xyz) != EGADS_SUCCESS) continue;
         EG_hadd(i0, i1, i2, 0, xyz, ts);
       }
 
@@ -1637,7 +1749,7 @@ EG_breakTri(int mode, int stri, int *eg_split, triStruct *ts)
                  ts->verts[i2].xyz[2]) / 3.0;
         if (EG_invEvaluate(ts->face, x1, uv, xyz) != EGADS_SUCCESS) continue;
       } else {
-        if (EG_evaluate(ts->face, uv, xyz) != EGADS_SUCCESS) continue;
+        if (EG_evalFace(ts, uv, xyz) != EGADS_SUCCESS) continue;
       }
     }
     if (EG_closeEdge(t1, xyz, ts) == 1) continue;
@@ -1654,8 +1766,9 @@ EG_breakTri(int mode, int stri, int *eg_split, triStruct *ts)
     }
     EG_floodTriGraph(t1, FLOODEPTH, ts);
 
-  } while (t1 != -1);
+  }
 
+  EG_free(cand);
   return split;
 }
 
@@ -1685,9 +1798,9 @@ EG_addFacetNorm(triStruct *ts)
       continue;
     if (EG_maxUVangle(i0, i1, i2, ts) > CUTANG) continue;
 
-    mid[0] = ts->tris[t1].mid[0];
-    mid[1] = ts->tris[t1].mid[1];
-    mid[2] = ts->tris[t1].mid[2];
+    mid[0] = ts->mids[t1].mid[0];
+    mid[1] = ts->mids[t1].mid[1];
+    mid[2] = ts->mids[t1].mid[2];
     if (DIST2(ts->verts[i0].xyz, mid) < ts->devia2) continue;
     if (DIST2(ts->verts[i1].xyz, mid) < ts->devia2) continue;
     if (DIST2(ts->verts[i2].xyz, mid) < ts->devia2) continue;
@@ -1770,11 +1883,11 @@ EG_addFacetDist(triStruct *ts)
 
     cmp = MAX(ts->chord*ts->chord, ts->devia2);
 
-    if (DIST2(xyz, ts->tris[t1].mid)  <= cmp)    continue;
+    if (DIST2(xyz, ts->mids[t1].mid)  <= cmp)    continue;
     if (EG_maxUVangle(i0, i1, i2, ts) >  DEVANG) continue;
-    xyz[0] = ts->tris[t1].mid[0];
-    xyz[1] = ts->tris[t1].mid[1];
-    xyz[2] = ts->tris[t1].mid[2];
+    xyz[0] = ts->mids[t1].mid[0];
+    xyz[1] = ts->mids[t1].mid[1];
+    xyz[2] = ts->mids[t1].mid[2];
     if (EG_inTri(t1, xyz, 0.10, ts) == 1) continue;
     if (EG_dotNorm(ts->verts[i0].xyz, ts->verts[i1].xyz, xyz,
                    ts->verts[i2].xyz) < 0.0) continue;
@@ -1857,11 +1970,199 @@ EG_splitInter(int sideMid, triStruct *ts)
 }
 
 
+/* the vertex -> triangle index -- each vertex has a run of tris (in
+ *   ascending order) with some room, so a collapse only patches the runs
+ *   of the vertices it touches */
+
+#define VTROOM           4      /* spare entries in each vertex's run */
+
+  typedef struct {
+    int nvert;                  /* number of vertices indexed */
+    int *beg;                   /* start of each vertex's run in tris */
+    int *len;                   /* entries in each run */
+    int *room;                  /* storage for each run */
+    int ntri;                   /* used length of tris */
+    int mtri;                   /* allocated length of tris */
+    int *tris;                  /* the runs */
+  } vertTris;
+
+
+static void
+EG_freeVertTris(vertTris *vt)
+{
+  if (vt->beg  != NULL) EG_free(vt->beg);
+  if (vt->len  != NULL) EG_free(vt->len);
+  if (vt->room != NULL) EG_free(vt->room);
+  if (vt->tris != NULL) EG_free(vt->tris);
+  vt->beg  = vt->len = vt->room = vt->tris = NULL;
+  vt->nvert = vt->ntri = vt->mtri = 0;
+}
+
+
+static int
+EG_fillVertTris(triStruct *ts, vertTris *vt)
+{
+  int i, j, k;
+
+  vt->nvert = ts->nverts;
+  vt->ntri  = 3*ts->ntris + VTROOM*ts->nverts;
+  vt->mtri  = vt->ntri + CHUNK;
+  vt->beg   = (int *) EG_alloc(ts->nverts*sizeof(int));
+  vt->len   = (int *) EG_alloc(ts->nverts*sizeof(int));
+  vt->room  = (int *) EG_alloc(ts->nverts*sizeof(int));
+  vt->tris  = (int *) EG_alloc(vt->mtri*sizeof(int));
+  if ((vt->beg == NULL) || (vt->len  == NULL) || (vt->room == NULL) ||
+      (vt->tris == NULL)) {
+    EG_freeVertTris(vt);
+    return EGADS_MALLOC;
+  }
+
+  for (i = 0; i < ts->nverts; i++) vt->len[i] = 0;
+  for (i = 0; i < ts->ntris; i++)
+    for (j = 0; j < 3; j++) vt->len[ts->tris[i].indices[j]-1]++;
+  for (k = i = 0; i < ts->nverts; i++) {
+    vt->beg[i]  = k;
+    vt->room[i] = vt->len[i] + VTROOM;
+    k          += vt->room[i];
+    vt->len[i]  = 0;
+  }
+
+  /* a tri with a vertex twice is in its run twice (side by side) */
+  for (i = 0; i < ts->ntris; i++)
+    for (j = 0; j < 3; j++) {
+      k = ts->tris[i].indices[j]-1;
+      vt->tris[vt->beg[k]+vt->len[k]] = i;
+      vt->len[k]++;
+    }
+
+  return EGADS_SUCCESS;
+}
+
+
+/* drop all entries of tri t from the run of vertex v (bias 0) */
+
+static void
+EG_delVertTri(vertTris *vt, int v, int t)
+{
+  int i, n, *run;
+
+  run = &vt->tris[vt->beg[v]];
+  for (n = i = 0; i < vt->len[v]; i++)
+    if (run[i] != t) run[n++] = run[i];
+  vt->len[v] = n;
+}
+
+
+/* put tri t in the run of vertex v (bias 0) -- a full run moves to the end */
+
+static int
+EG_addVertTri(vertTris *vt, int v, int t)
+{
+  int i, n, *run, *tmp;
+
+  if (vt->len[v] == vt->room[v]) {
+    n = 2*vt->room[v] + VTROOM;
+    if (vt->ntri+n > vt->mtri) {
+      tmp = (int *) EG_reall(vt->tris, (vt->ntri+n+CHUNK)*sizeof(int));
+      if (tmp == NULL) return EGADS_MALLOC;
+      vt->tris  = tmp;
+      vt->mtri  = vt->ntri+n+CHUNK;
+    }
+    for (i = 0; i < vt->len[v]; i++)
+      vt->tris[vt->ntri+i] = vt->tris[vt->beg[v]+i];
+    vt->beg[v]  = vt->ntri;
+    vt->room[v] = n;
+    vt->ntri   += n;
+  }
+
+  run = &vt->tris[vt->beg[v]];
+  for (i = vt->len[v]; i > 0; i--) {
+    if (run[i-1] <= t) break;
+    run[i] = run[i-1];
+  }
+  run[i] = t;
+  vt->len[v]++;
+
+  return EGADS_SUCCESS;
+}
+
+
+/* collapse node onto tnode and patch the index -- only the tris on node
+ *   or on the last vertex (renumbered to node) change their vertices, and
+ *   the last 2 tris move down into the slots of the 2 that go */
+
+static int
+EG_collapseIndexed(int node, int tnode, triStruct *ts, vertTris *vt,
+                   int *mtouch, int **touch)
+{
+  int i, j, k, n, nv, nt, *tmp;
+
+  nv = ts->nverts;
+  nt = ts->ntris;
+  n  = vt->len[node-1] + vt->len[nv-1] + 2;
+  if (n > *mtouch) {
+    tmp = (int *) EG_reall(*touch, (n+CHUNK)*sizeof(int));
+    if (tmp == NULL) return EGADS_MALLOC;
+    *touch  = tmp;
+    *mtouch = n+CHUNK;
+  }
+  tmp = *touch;
+  for (n = i = 0; i < vt->len[node-1]; i++)
+    tmp[n++] = vt->tris[vt->beg[node-1]+i];
+  for (i = 0; i < vt->len[nv-1]; i++)
+    tmp[n++] = vt->tris[vt->beg[nv-1]+i];
+  if (nt > 1) tmp[n++] = nt-2;
+  if (nt > 0) tmp[n++] = nt-1;
+
+  for (i = 0; i < n; i++)
+    for (j = 0; j < 3; j++)
+      EG_delVertTri(vt, ts->tris[tmp[i]].indices[j]-1, tmp[i]);
+
+  EG_collapsEdge(node, tnode, ts);
+
+  /* the last vertex's run goes with it (EG_collapsEdge may give up) */
+  if ((ts->nverts != nv) && (node != nv)) {
+    k                = vt->beg[node-1];
+    vt->beg[node-1]  = vt->beg[nv-1];
+    vt->beg[nv-1]    = k;
+    k                = vt->len[node-1];
+    vt->len[node-1]  = vt->len[nv-1];
+    vt->len[nv-1]    = k;
+    k                = vt->room[node-1];
+    vt->room[node-1] = vt->room[nv-1];
+    vt->room[nv-1]   = k;
+  }
+  vt->nvert = ts->nverts;
+
+  for (i = 0; i < n; i++) {
+    if (tmp[i] >= ts->ntris) continue;
+    for (k = 0; k < i; k++)
+      if (tmp[k] == tmp[i]) break;
+    if (k != i) continue;
+    for (j = 0; j < 3; j++)
+      if (EG_addVertTri(vt, ts->tris[tmp[i]].indices[j]-1,
+                        tmp[i]) != EGADS_SUCCESS) return EGADS_MALLOC;
+  }
+
+  return EGADS_SUCCESS;
+}
+
+
 static int
 EG_removePhaseB(triStruct *ts)
 {
-  int    i, j, n, t1, t2, vert, tnode, i0, i1, i2, count = 0;
-  double d, dist, dots[2], x1[3], x2[3], n2[3], n1[3];
+  int      i, j, k, n, t1, t2, vert, tnode, i0, i1, i2, count = 0;
+  int      *run, mtouch = 0, *touch = NULL;
+  double   d, dist, dots[2], x1[3], x2[3], n2[3], n1[3];
+  vertTris vt;
+
+  /* build the vertex -> triangle index once (patched by the collapses) */
+
+  if (EG_fillVertTris(ts, &vt) != EGADS_SUCCESS) {
+    printf(" EGADS Error: Malloc of %d Verts (EG_removePhaseB)!\n",
+           ts->nverts);
+    return EGADS_MALLOC;
+  }
 
   for (t1 = 0; t1 < ts->ntris; t1++) {
     for (n = j = 0; j < 3; j++)
@@ -1879,8 +2180,11 @@ EG_removePhaseB(triStruct *ts)
 
     tnode = -1;
     dist  = DBL_MAX;
-    for (t2 = 0; t2 < ts->ntris; t2++) {
+    run   = &vt.tris[vt.beg[vert-1]];
+    for (k = 0; k < vt.len[vert-1]; k++) {
+      t2 = run[k];
       if (t1 == t2) continue;
+      if ((k > 0) && (t2 == run[k-1])) continue;
       for (n = j = 0; j < 3; j++)
         if (ts->tris[t2].indices[j] == vert) n++;
       if (n != 1) continue;
@@ -1950,10 +2254,18 @@ EG_removePhaseB(triStruct *ts)
     printf(" removal for node %d -> %d, tri = %d, dots = %le %le\n", 
            vert, tnode, t1, dots[0], dots[1]);
 #endif
-    EG_collapsEdge(vert, tnode, ts);
+    if (EG_collapseIndexed(vert, tnode, ts, &vt, &mtouch,
+                           &touch) != EGADS_SUCCESS) {
+      printf(" EGADS Error: Malloc on the Vert index (EG_removePhaseB)!\n");
+      EG_freeVertTris(&vt);
+      if (touch != NULL) EG_free(touch);
+      return EGADS_MALLOC;
+    }
     count++;
   }
 
+  EG_freeVertTris(&vt);
+  if (touch != NULL) EG_free(touch);
   return count;
 }
 
@@ -1961,41 +2273,57 @@ EG_removePhaseB(triStruct *ts)
 static int
 EG_addSideDist(int iter, double maxlen2, int sideMid, triStruct *ts)
 {
-  int    i, j, i0, i1, i2, t1, t2, side, split;
+  int    i, j, k, i0, i1, i2, t1, t2, side, split, ncand;
   double cmp, d, dist, mindist, emndist, xyz[3];
+  triKey *cand;
 
   for (split = t1 = 0; t1 < ts->ntris; t1++) ts->tris[t1].hit = 0;
   mindist = MAX(maxlen2, ts->devia2);
   emndist = MAX(mindist, ts->edist2);
   emndist = MAX(emndist, ts->eps2);
 
-  do {
-    dist = 0.0;
-    t1   = -1;
-    for (i = 0; i < ts->ntris; i++) {
-      if (ts->tris[i].hit != 0) continue;
-      i0  = ts->tris[i].indices[0]-1;
-      i1  = ts->tris[i].indices[1]-1;
-      i2  = ts->tris[i].indices[2]-1;
-      cmp = mindist;
-      if ((ts->verts[i0].type != FACE) || (ts->verts[i1].type != FACE) ||
-          (ts->verts[i2].type != FACE)) cmp = emndist;
+  /* get the longest side of each tri -- like EG_breakTri, the list is
+     visited longest first and a tri is only ever picked once */
 
-      for (j = 0; j < 3; j++) {
-        t2 = ts->tris[i].neighbors[j]-1;
-        if (t2 < i) continue;
-        i1 = ts->tris[i].indices[sides[j][0]]-1;
-        i2 = ts->tris[i].indices[sides[j][1]]-1;
-        d  = DIST2(ts->verts[i1].xyz, ts->verts[i2].xyz);
-        if (d <= cmp) continue;
-        if (d > dist) {
-          t1   = i;
-          side = j;
-          dist = d;
-        }
+  cand = (triKey *) EG_alloc(ts->ntris*sizeof(triKey));
+  if (cand == NULL) {
+    printf(" EGADS Error: Malloc of %d Tris (EG_addSideDist)!\n", ts->ntris);
+    return 0;
+  }
+  for (ncand = i = 0; i < ts->ntris; i++) {
+    i0  = ts->tris[i].indices[0]-1;
+    i1  = ts->tris[i].indices[1]-1;
+    i2  = ts->tris[i].indices[2]-1;
+    cmp = mindist;
+    if ((ts->verts[i0].type != FACE) || (ts->verts[i1].type != FACE) ||
+        (ts->verts[i2].type != FACE)) cmp = emndist;
+
+    dist = 0.0;
+    side = -1;
+    for (j = 0; j < 3; j++) {
+      t2 = ts->tris[i].neighbors[j]-1;
+      if (t2 < i) continue;
+      i1 = ts->tris[i].indices[sides[j][0]]-1;
+      i2 = ts->tris[i].indices[sides[j][1]]-1;
+      d  = DIST2(ts->verts[i1].xyz, ts->verts[i2].xyz);
+      if (d <= cmp) continue;
+      if (d > dist) {
+        side = j;
+        dist = d;
       }
     }
-    if (t1 == -1) continue;
+    if (side == -1) continue;
+    cand[ncand].key  = dist;
+    cand[ncand].tri  = i;
+    cand[ncand].side = side;
+    ncand++;
+  }
+  qsort(cand, ncand, sizeof(triKey), EG_cmpTriKey);
+
+  for (k = 0; k < ncand; k++) {
+    t1   = cand[k].tri;
+    side = cand[k].side;
+    if (ts->tris[t1].hit != 0) continue;
 
     if (ts->phase == 3) {
       i1     = ts->tris[t1].indices[sides[side][0]]-1;
@@ -2003,7 +2331,10 @@ EG_addSideDist(int iter, double maxlen2, int sideMid, triStruct *ts)
       xyz[0] = 0.5*(ts->verts[i1].xyz[0] + ts->verts[i2].xyz[0]);
       xyz[1] = 0.5*(ts->verts[i1].xyz[1] + ts->verts[i2].xyz[1]);
       xyz[2] = 0.5*(ts->verts[i1].xyz[2] + ts->verts[i2].xyz[2]);
-      if (EG_close2Edge(t1, xyz, ts) == 1) continue;
+      if (EG_close2Edge(t1, xyz, ts) == 1) {
+        ts->tris[t1].hit = 1;
+        continue;
+      }
     }
     t2 = ts->tris[t1].neighbors[side]-1;
     if (EG_splitSide(t1, side, t2, sideMid, ts) == EGADS_SUCCESS) {
@@ -2015,8 +2346,9 @@ EG_addSideDist(int iter, double maxlen2, int sideMid, triStruct *ts)
       ts->tris[t1].hit = 1;
     }
 
-  } while (t1 != -1);
+  }
 
+  EG_free(cand);
   return split;
 }
 
@@ -2037,13 +2369,14 @@ EG_tessellate(int outLevel, triStruct *ts)
   ts->devia2 = 0.0;             /* largest edge deviation */
   eg_split   = sideMid = 0;
   stri       = ts->ntris;
+  EG_eclear(ts);
 
   /* get UV scaling and max edge deviation */
 
   ts->VoverU = 1.0;
   trange[0]  = trange[1] = 0.0;
   for (i = 0; i < ts->nverts; i++) {
-    if (EG_evaluate(ts->face, ts->verts[i].uv, result) != EGADS_SUCCESS)
+    if (EG_evalFace(ts, ts->verts[i].uv, result) != EGADS_SUCCESS)
       continue;
     dist = (ts->verts[i].xyz[0]-result[0])*(ts->verts[i].xyz[0]-result[0]) +
            (ts->verts[i].xyz[1]-result[1])*(ts->verts[i].xyz[1]-result[1]) +
@@ -2180,6 +2513,7 @@ EG_tessellate(int outLevel, triStruct *ts)
     /* remove problem Phase B additions */
 
     if (count != 0) count = EG_removePhaseB(ts);
+    if (count == EGADS_MALLOC) return EGADS_MALLOC;
     if (count >  0) {
       EG_swapTris(EG_angUVTest, "angleUV",  0.0, ts);
       lang = ts->accum;
@@ -2255,7 +2589,7 @@ EG_tessellate(int outLevel, triStruct *ts)
           for (i = 0; i < ts->ntris; i++)
             if (ts->tris[i].close == TOBEFILLED)
               if (EG_hfind(ts->tris[i].indices[0], ts->tris[i].indices[1],
-                           ts->tris[i].indices[2], &j, ts->tris[i].mid, ts)
+                           ts->tris[i].indices[2], &j, ts->mids[i].mid, ts)
                   != NOTFILLED){
                 ts->tris[i].close = j;
               } else {
@@ -2295,7 +2629,7 @@ EG_tessellate(int outLevel, triStruct *ts)
           for (i = 0; i < ts->ntris; i++)
             if (ts->tris[i].close == TOBEFILLED)
               if (EG_hfind(ts->tris[i].indices[0], ts->tris[i].indices[1],
-                           ts->tris[i].indices[2], &j, ts->tris[i].mid, ts)
+                           ts->tris[i].indices[2], &j, ts->mids[i].mid, ts)
                   != NOTFILLED){
                 ts->tris[i].close = j;
               } else {
@@ -2352,7 +2686,7 @@ EG_tessellate(int outLevel, triStruct *ts)
                      ts->verts[n2].xyz[1]) / 3.0;
           xvec[2] = (ts->verts[n0].xyz[2] + ts->verts[n1].xyz[2] +
                      ts->verts[n2].xyz[2]) / 3.0;
-          dot     = DIST2(xvec, ts->tris[i].mid);
+          dot     = DIST2(xvec, ts->mids[i].mid);
           dist    = MAX(dist, dot);
           if (dot <= ts->chord*ts->chord) {
             stat[1]++;
@@ -2432,6 +2766,9 @@ EG_tessellate(int outLevel, triStruct *ts)
   if (outLevel > 1) {
     printf("Face %d: npts = %d,  ntris = %d\n", 
            ts->fIndex, ts->nverts, ts->ntris);
+    if (ts->nEvals != 0)
+      printf("   Eval cache    = %d hits of %d (%.1f%%)\n", ts->nHits,
+             ts->nEvals, 100.0*ts->nHits/ts->nEvals);
     if (ts->planar == 0) {
       if ((ts->accum < -0.1) || (lang > MAXANG)) 
         printf("           **Tessellation problem**  %le  %le\n",
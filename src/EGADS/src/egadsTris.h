@@ -24,15 +24,17 @@
   typedef struct {
     KEY  key;
     DATA data;
+    int  stamp;                 /* table generation (empty if not current) */
   } ENTRY;
-
-  typedef struct element {
-    ENTRY          item;
-    /*@null@*/
-    struct element *next;
-  } ELEMENT;
   
 
+  typedef struct {
+    double uv[2];               /* parameter (compared bit for bit) */
+    double result[9];           /* position & first derivatives */
+    int    stamp;               /* cache generation (empty if not current) */
+  } EVAL;
+
+
   typedef struct {
     int    type;			/* Topology type */
     int    edge;			/* Edge tessellation index */
@@ -54,8 +56,6 @@
   typedef struct {
     int    indices[3];		/* triVert indices for triangle */
     int    neighbors[3];	/* neighboring tri index (- seg) */
-    double mid[3];              /* midpoint xyz */
-    double area;                /* area of triangle */
     short  mark;                /* temp storage for marking tri */
     short  close;               /* mid marked too close to edge */
     short  hit;                 /* hit this before */
@@ -63,6 +63,22 @@
   } triTri;
 
 
+  /* the rarely touched tri data -- kept out of triTri so that the swap and
+     split sweeps stream through 32 byte records */
+
+  typedef struct {
+    double mid[3];              /* midpoint xyz */
+    double area;                /* area of triangle */
+  } triMid;
+
+
+  typedef struct {
+    double key;                 /* sort value (largest first) */
+    int    tri;                 /* triangle index (lowest first on ties) */
+    int    side;                /* triangle side (if needed) */
+  } triKey;
+
+
   typedef struct {
     int indices[2];             /* indices for the bounding segment */
     int neighbor;		/* triangle neighbor index */
@@ -91,9 +107,18 @@
     int      mtris;		/* triangle storage */
     int      ntris;
     triTri   *tris;
+    triMid   *mids;             /* parallel to tris (mtris long) */
     int      msegs;		/* bounding segment (edge) storage */
     int      nsegs;
     triSeg   *segs;
     int      numElem;		/* hash table -- number of elements */
-    ELEMENT  **hashTab;
+    int      hashSize;          /* table size (a power of 2) */
+    int      stamp;             /* current table generation */
+    ENTRY    *hashTab;          /* open addressed & reused across Faces */
+    int      numEval;           /* surface evaluation cache -- entries */
+    int      evalSize;          /* table size (a power of 2) */
+    int      evalStamp;         /* current cache generation (one per Face) */
+    int      nEvals;            /* evaluations asked for on this Face */
+    int      nHits;             /* ... and those found in the cache */
+    EVAL     *evalTab;
   } triStruct;
@@ -34,6 +34,12 @@
                              int *len, /*@null@*/ const int **ints, 
                                        /*@null@*/ const double **reals,
                                        /*@null@*/ const char **str);
+  extern int EG_attributeAtom(const egObject *obj, const char *name, 
+                              int *atom);
+  extern int EG_attributeRetAtom(const egObject *obj, int atom, int *atype, 
+                                 int *len, /*@null@*/ const int **ints, 
+                                           /*@null@*/ const double **reals,
+                                           /*@null@*/ const char **str);
 
 
 int
@@ -148,6 +154,52 @@ ig_attributeret_(INT8 *obj, char *name, int *atype, int *len,
 }
 
 
+int
+#ifdef WIN32
+IG_ATTRIBUTEATOM (INT8 *obj, char *name, int *atom, int nameLen)
+#else
+ig_attributeatom_(INT8 *obj, char *name, int *atom, int nameLen)
+#endif
+{
+  int      stat;
+  char     *fname;
+  egObject *object;
+
+  *atom  = 0;
+  object = (egObject *) *obj;
+  fname  = EG_f2c(name, nameLen);
+  if (fname == NULL) return EGADS_NONAME;
+  stat   = EG_attributeAtom(object, fname, atom);
+  EG_free(fname);
+  return stat;
+}
+
+
+int
+#ifdef WIN32
+IG_ATTRIBUTERETATOM (INT8 *obj, int *atom, int *atype, int *len,
+                     const int **ints, const double **reals, char *str,
+                     int strLen)
+#else
+ig_attributeretatom_(INT8 *obj, int *atom, int *atype, int *len, 
+                     const int **ints, const double **reals, char *str, 
+                     int strLen)
+#endif
+{
+  int        stat;
+  const char *fstr;
+  egObject   *object;
+
+  *ints  = NULL;
+  *reals = NULL;  
+  object = (egObject *) *obj;
+  stat   = EG_attributeRetAtom(object, *atom, atype, len, 
+                               ints, reals, &fstr);
+  EG_c2f(fstr, str, strLen);
+  return stat;
+}
+
+
 int
 #ifdef WIN32
 IG_ATTRIBUTEDUP (INT8 *src, INT8 *dst)
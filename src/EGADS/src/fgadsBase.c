@@ -33,6 +33,11 @@
                             egObject **copy);
   extern int  EG_flipObject(const egObject *object, egObject **copy);
   extern int  EG_close(egObject *context);
+  extern int  EG_getSlabInfo(const egObject *context, int index, int *size,
+                             int *nblock, int *inUse, int *hiWater);
+  extern int  EG_getMemoryStats(const egObject *context, int oclass, 
+                                int mtype, int *count, int *hiCount, 
+                                size_t *bytes, size_t *hiBytes);
 
 
 
@@ -240,3 +245,41 @@ ig_close_(INT8 *obj)
   object = (egObject *) *obj;
   return EG_close(object);
 }
+
+
+int
+#ifdef WIN32
+IG_GETSLABINFO (INT8 *cntxt, int *index, int *size, int *nblock, int *inUse,
+                int *hiWater)
+#else
+ig_getslabinfo_(INT8 *cntxt, int *index, int *size, int *nblock, int *inUse,
+                int *hiWater)
+#endif
+{
+  egObject *context;
+
+  context = (egObject *) *cntxt;
+  return EG_getSlabInfo(context, *index, size, nblock, inUse, hiWater);
+}
+
+
+int
+#ifdef WIN32
+IG_GETMEMORYSTATS (INT8 *cntxt, int *oclass, int *mtype, int *count, 
+                   int *hiCount, INT8 *bytes, INT8 *hiBytes)
+#else
+ig_getmemorystats_(INT8 *cntxt, int *oclass, int *mtype, int *count, 
+                   int *hiCount, INT8 *bytes, INT8 *hiBytes)
+#endif
+{
+  int      stat;
+  size_t   nbytes, hbytes;
+  egObject *context;
+
+  context  = (egObject *) *cntxt;
+  stat     = EG_getMemoryStats(context, *oclass, *mtype, count, hiCount,
+                               &nbytes, &hbytes);
+  *bytes   = nbytes;
+  *hiBytes = hbytes;
+  return stat;
+}
@@ -29,6 +29,10 @@
                          double *results);
   extern int EG_invEvaluate(const egObject *geom, double *xyz, double *param, 
                             double *results);
+  extern int EG_evaluateMany(const egObject *geom, int npts, int deriv,
+                             const double *params, double *results);
+  extern int EG_invEvaluateMany(const egObject *geom, int npts, double *xyzs,
+                                double *params, double *results);
   extern int EG_approximate(egObject *context, int maxdeg, double tol,
                             const int *sizes, const double *xyzs, 
                             egObject **bspline);
@@ -127,6 +131,38 @@ ig_invevaluate_(INT8 *obj, double *xyz, double *param, double *results)
 }
 
 
+int
+#ifdef WIN32
+IG_EVALUATEMANY (INT8 *obj, int *npts, int *deriv, double *params, 
+                 double *results)
+#else
+ig_evaluatemany_(INT8 *obj, int *npts, int *deriv, double *params, 
+                 double *results)
+#endif
+{
+  egObject *object;
+
+  object = (egObject *) *obj;
+  return EG_evaluateMany(object, *npts, *deriv, params, results);
+}
+
+
+int
+#ifdef WIN32
+IG_INVEVALUATEMANY (INT8 *obj, int *npts, double *xyzs, double *params, 
+                    double *results)
+#else
+ig_invevaluatemany_(INT8 *obj, int *npts, double *xyzs, double *params, 
+                    double *results)
+#endif
+{
+  egObject *object;
+
+  object = (egObject *) *obj;
+  return EG_invEvaluateMany(object, *npts, xyzs, params, results);
+}
+
+
 int
 #ifdef WIN32
 IG_APPROXIMATE (INT8 *cntx, int *maxdeg, double *tol, const int *size, 
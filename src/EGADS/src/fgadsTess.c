@@ -22,6 +22,8 @@
                              egObject **tess);
   extern int EG_getTessGeom(const egObject *tess, int *sizes, double **xyz);
 
+  extern int EG_setTessParam(egObject *context, int iparam, double value,
+                             double *oldvalue);
   extern int EG_makeTessBody(egObject *object, double *params, egObject **tess);
   extern int EG_remakeTess(egObject *tess, int nobj, /*@null@*/ egObject **objs,
                            double *params);
@@ -31,9 +33,26 @@
                             const double **xyz, const double **uv, 
                             const int **ptype, const int **pindex, 
                             int *ntri, const int **tris, const int **tric);
+  extern int EG_getTessBodyGlobal(const egObject *tess, int *nvert,
+                                  const double **xyz, const int **ptype,
+                                  const int **pindex, int *ntri,
+                                  const int **tris);
+  extern int EG_getTessFaceGlobal(const egObject *tess, int index, int *len,
+                                  const int **gIndex, int *ntri,
+                                  const int **tris);
+  extern int EG_getTessEdgeFloat(const egObject *tess, int index, int *len,
+                                 const float **xyz, const float **t);
+  extern int EG_getTessFaceFloat(const egObject *tess, int index, int *len,
+                                 const float **xyz, const float **uv,
+                                 int *ntri, const int **tris);
+
+  extern int EG_saveTess(const egObject *tess, const char *name);
+  extern int EG_loadTess(egObject *body, const char *name, egObject **tess);
+  extern /*@null@*/ char *EG_f2c(const char *name, int nameLen);
 
   extern int EG_getTessQuads(const egObject *tess, int *nquad, int **fIndices);
   extern int EG_makeQuads(egObject *tess, double *params, int fIndex);
+  extern int EG_makeQuadsBody(egObject *tess, double *params, int *nquad);
   extern int EG_getQuads(const egObject *tess, int fIndex, int *len, 
                          const double **xyz, const double **uv, 
                          const int **ptype, const int **pindex, int *npatch);
@@ -80,6 +99,20 @@ ig_gettessgeom_(INT8 *obj, int *sizes, double **xyz)
 }
 
 
+int
+#ifdef WIN32
+IG_SETTESSPARAM (INT8 *cntxt, int *iparam, double *value, double *oldvalue)
+#else
+ig_settessparam_(INT8 *cntxt, int *iparam, double *value, double *oldvalue)
+#endif
+{
+  egObject *context;
+
+  context = (egObject *) *cntxt;
+  return EG_setTessParam(context, *iparam, *value, oldvalue);
+}
+
+
 int
 #ifdef WIN32
 IG_MAKETESSBODY (INT8 *obj, double *params, INT8 *itess)  
@@ -166,6 +199,129 @@ ig_gettessface_(INT8 *obj, int *index, int *len, const double **xyz,
 }
 
 
+int
+#ifdef WIN32
+IG_GETTESSBODYGLOBAL (INT8 *obj, int *nvert, const double **xyz, 
+                      const int **ptype, const int **pindex, int *ntri,
+                      const int **tris)
+#else
+ig_gettessbodyglobal_(INT8 *obj, int *nvert, const double **xyz, 
+                      const int **ptype, const int **pindex, int *ntri,
+                      const int **tris)
+#endif
+{
+  egObject *object;
+
+  *nvert  = *ntri = 0;
+  *xyz    = NULL;
+  *ptype  = NULL;
+  *pindex = NULL;
+  *tris   = NULL;
+  object  = (egObject *) *obj;
+  return EG_getTessBodyGlobal(object, nvert, xyz, ptype, pindex, ntri, tris);
+}
+
+
+int
+#ifdef WIN32
+IG_GETTESSFACEGLOBAL (INT8 *obj, int *index, int *len, const int **gIndex,
+                      int *ntri, const int **tris)
+#else
+ig_gettessfaceglobal_(INT8 *obj, int *index, int *len, const int **gIndex,
+                      int *ntri, const int **tris)
+#endif
+{
+  egObject *object;
+
+  *len    = *ntri = 0;
+  *gIndex = NULL;
+  *tris   = NULL;
+  object  = (egObject *) *obj;
+  return EG_getTessFaceGlobal(object, *index, len, gIndex, ntri, tris);
+}
+
+
+int
+#ifdef WIN32
+IG_GETTESSEDGEFLOAT (INT8 *obj, int *index, int *len, const float **xyz,
+                     const float **t)
+#else
+ig_gettessedgefloat_(INT8 *obj, int *index, int *len, const float **xyz,
+                     const float **t)
+#endif
+{
+  egObject *object;
+
+  *len   = 0;
+  *xyz   = NULL;
+  *t     = NULL;
+  object = (egObject *) *obj;
+  return EG_getTessEdgeFloat(object, *index, len, xyz, t);
+}
+
+
+int
+#ifdef WIN32
+IG_GETTESSFACEFLOAT (INT8 *obj, int *index, int *len, const float **xyz,
+                     const float **uv, int *ntri, const int **tris)
+#else
+ig_gettessfacefloat_(INT8 *obj, int *index, int *len, const float **xyz,
+                     const float **uv, int *ntri, const int **tris)
+#endif
+{
+  egObject *object;
+
+  *len   = *ntri = 0;
+  *xyz   = NULL;
+  *uv    = NULL;
+  *tris  = NULL;
+  object = (egObject *) *obj;
+  return EG_getTessFaceFloat(object, *index, len, xyz, uv, ntri, tris);
+}
+
+
+int
+#ifdef WIN32
+IG_SAVETESS (INT8 *obj, const char *name, int nameLen)
+#else
+ig_savetess_(INT8 *obj, const char *name, int nameLen)
+#endif
+{
+  int      stat;
+  char     *fname;
+  egObject *object;
+
+  object = (egObject *) *obj;
+  fname  = EG_f2c(name, nameLen);
+  if (fname == NULL) return EGADS_NONAME;
+  stat = EG_saveTess(object, fname);
+  EG_free(fname);
+  return stat;
+}
+
+
+int
+#ifdef WIN32
+IG_LOADTESS (INT8 *obj, const char *name, INT8 *itess, int nameLen)
+#else
+ig_loadtess_(INT8 *obj, const char *name, INT8 *itess, int nameLen)
+#endif
+{
+  int      stat;
+  char     *fname;
+  egObject *object, *tess;
+
+  *itess = 0;
+  object = (egObject *) *obj;
+  fname  = EG_f2c(name, nameLen);
+  if (fname == NULL) return EGADS_NONAME;
+  stat = EG_loadTess(object, fname, &tess);
+  EG_free(fname);
+  if (stat == EGADS_SUCCESS) *itess = (INT8) tess;
+  return stat;
+}
+
+
 int
 #ifdef WIN32
 IG_GETTESSQUADS (INT8 *obj, int *nquad, int **fIndices)
@@ -196,6 +352,20 @@ ig_makequads_(INT8 *obj, double *parms, int *fIndex)
 }
 
 
+int
+#ifdef WIN32
+IG_MAKEQUADSBODY (INT8 *obj, double *parms, int *nquad)
+#else
+ig_makequadsbody_(INT8 *obj, double *parms, int *nquad)
+#endif
+{
+  egObject *object;
+
+  object = (egObject *) *obj;
+  return EG_makeQuadsBody(object, parms, nquad);
+}
+
+
 int
 #ifdef WIN32
 IG_GETQUADS (INT8 *obj, int *index, int *len, const double **xyz, 